@@ -751,6 +751,58 @@ namespace moris
 
     //------------------------------------------------------------------------------
 
+    /**
+     * This function concatenates the column vectors of all procs ordered
+     * by proc rank and makes the result known to all procs
+     *
+     * @param[in]  aLocalVector    vector of current processor
+     * @param[out] aGlobalVector   vector containing values from all processors
+     *
+     */
+    template< typename T >
+    void
+    all_gather_and_concatenate(
+            const Matrix< T >& aLocalVector,
+            Matrix< T >&       aGlobalVector )
+    {
+        // get number of entries on each proc
+        Matrix< DDSMat > tCounts;
+        comm_gather_and_broadcast( (sint)aLocalVector.numel(), tCounts );
+
+        moris_id tParSize = par_size();
+
+        Matrix< DDSMat > tOffsets( tParSize, 1, 0 );
+
+        for ( moris_id p = 1; p < tParSize; ++p )
+        {
+            tOffsets( p ) = tOffsets( p - 1 ) + tCounts( p - 1 );
+        }
+
+        aGlobalVector.set_size( tOffsets( tParSize - 1 ) + tCounts( tParSize - 1 ), 1 );
+
+        if ( tParSize > 1 )
+        {
+            // get data type
+            MPI_Datatype tDataType = get_comm_datatype( (typename Matrix< T >::Data_Type)0 );
+
+            MPI_Allgatherv(
+                    aLocalVector.data(),
+                    aLocalVector.numel(),
+                    tDataType,
+                    aGlobalVector.data(),
+                    tCounts.data(),
+                    tOffsets.data(),
+                    tDataType,
+                    gMorisComm.get_global_comm() );
+        }
+        else if ( aLocalVector.numel() > 0 )
+        {
+            aGlobalVector = aLocalVector;
+        }
+    }
+
+    //------------------------------------------------------------------------------
+
     inline std::string
     parallelize_path( const std::string& aFilePath )
     {
@@ -54,6 +54,9 @@ namespace moris
 
         void Constitutive_Model::reset_eval_flags()
         {
+            // store the evaluation state of the field interpolators the flags are reset for
+            mEvaluationState = mFIManager != nullptr ? mFIManager->get_evaluation_state() : MORIS_LUINT_MAX;
+
             // reset the flux value and derivative flags
             mFluxEval = true;
             mdFluxdDofEval.fill( true );
@@ -136,6 +139,17 @@ namespace moris
 
         //------------------------------------------------------------------------------
 
+        void Constitutive_Model::update_eval_flags()
+        {
+            // reset only if the field interpolators changed since the last reset
+            if ( mFIManager == nullptr || mEvaluationState != mFIManager->get_evaluation_state() )
+            {
+                this->reset_eval_flags();
+            }
+        }
+
+        //------------------------------------------------------------------------------
+
         void Constitutive_Model::set_dof_type_list(
                 moris::Cell< moris::Cell< MSI::Dof_Type > > aDofTypes )
         {
@@ -152,6 +166,9 @@ namespace moris
         {
             // set parameters
             mParameters = aParameters;
+
+            // evaluations depend on the parameters
+            this->invalidate_eval_cache();
         }
 
         //------------------------------------------------------------------------------
@@ -850,6 +867,9 @@ namespace moris
             // set the field interpolator manager for the constitutive model
             mFIManager = aFieldInterpolatorManager;
 
+            // evaluations depend on the field interpolators
+            this->invalidate_eval_cache();
+
             // loop over the underlying properties
             for( const std::shared_ptr< Property > & tProp : this->get_properties() )
             {
@@ -1125,6 +1145,10 @@ namespace moris
             fd_scheme( aFDSchemeType, tFDScheme );
             uint tNumPoints = tFDScheme( 0 ).size();
 
+            // reset the evaluation flags if the field interpolators changed since the last
+            // reset, such that the unperturbed quantities are taken from the cache if valid
+            this->update_eval_flags();
+
             // get the field interpolator for type
             Field_Interpolator* tFI = mFIManager->get_field_interpolators_for_type( aDofTypes( 0 ) );
 
@@ -1133,9 +1157,6 @@ namespace moris
             uint tDerNumBases  = tFI->get_number_of_space_time_bases();
             uint tDerNumFields = tFI->get_number_of_fields();
 
-            // reset properties
-            this->reset_eval_flags();
-
             // evaluate unperturbed value
             const Matrix< DDRMat >& tUnperturbed = this->select_derivative_FD(
                     aCMRequestType,
@@ -1208,6 +1229,9 @@ namespace moris
             // reset the coefficients values
             tFI->set_coeff( tCoeff );
 
+            // evaluate on the unperturbed coefficients from here on
+            this->reset_eval_flags();
+
             // set value to storage
             this->set_derivative_FD(
                     aCMRequestType,
@@ -1317,6 +1341,10 @@ namespace moris
             fd_scheme( aFDSchemeType, tFDScheme );
             uint tNumPoints = tFDScheme( 0 ).size();
 
+            // reset the evaluation flags if the field interpolators changed since the last
+            // reset, such that the unperturbed quantities are taken from the cache if valid
+            this->update_eval_flags();
+
             // get the derivative dof type index
             uint tDofIndex = mGlobalDofTypeMap( static_cast< uint >( aDofTypes( 0 ) ) );
 
@@ -1398,6 +1426,9 @@ namespace moris
             // reset the coefficients values
             tFI->set_coeff( tCoeff );
 
+            // evaluate on the unperturbed coefficients from here on
+            this->reset_eval_flags();
+
             // set value to storage
             mdFluxdDof( tDofIndex ) = adFluxdDOF_FD;
         }
@@ -1417,6 +1448,10 @@ namespace moris
             fd_scheme( aFDSchemeType, tFDScheme );
             uint tNumPoints = tFDScheme( 0 ).size();
 
+            // reset the evaluation flags if the field interpolators changed since the last
+            // reset, such that the unperturbed quantities are taken from the cache if valid
+            this->update_eval_flags();
+
             // get the derivative dof type index
             uint tDofIndex = mGlobalDofTypeMap( static_cast< uint >( aDofTypes( 0 ) ) );
 
@@ -1499,6 +1534,9 @@ namespace moris
             // reset the coefficients values
             tFIDerivative->set_coeff( tCoeff );
 
+            // evaluate on the unperturbed coefficients from here on
+            this->reset_eval_flags();
+
             // set value for storage
             mdTractiondDof( tDofIndex ) = adtractiondu_FD;
         }
@@ -1520,6 +1558,10 @@ namespace moris
             fd_scheme( aFDSchemeType, tFDScheme );
             uint tNumPoints = tFDScheme( 0 ).size();
 
+            // reset the evaluation flags if the field interpolators changed since the last
+            // reset, such that the unperturbed quantities are taken from the cache if valid
+            this->update_eval_flags();
+
             // get the test dof index
             uint tTestDofIndex = mDofTypeMap( static_cast< uint >( aTestDofTypes( 0 ) ) );
 
@@ -1608,6 +1650,9 @@ namespace moris
             // reset the coefficients values
             tFIDerivative->set_coeff( tCoeff );
 
+            // evaluate on the unperturbed coefficients from here on
+            this->reset_eval_flags();
+
             // set value for storage
             mdTestTractiondDof( tTestDofIndex )( tDofIndex ) = adtesttractiondu_FD;
         }
@@ -1628,6 +1673,10 @@ namespace moris
             fd_scheme( aFDSchemeType, tFDScheme );
             uint tNumPoints = tFDScheme( 0 ).size();
 
+            // reset the evaluation flags if the field interpolators changed since the last
+            // reset, such that the unperturbed quantities are taken from the cache if valid
+            this->update_eval_flags();
+
             // get the test dof index
             uint tTestDofIndex = mDofTypeMap( static_cast< uint >( aTestDofTypes( 0 ) ) );
 
@@ -1716,6 +1765,9 @@ namespace moris
             // reset the coefficients values
             tFIDerivative->set_coeff( tCoeff );
 
+            // evaluate on the unperturbed coefficients from here on
+            this->reset_eval_flags();
+
             // set value for storage
             mdTestTractiondDof( tTestDofIndex )( tDofIndex ) = adtesttractiondu_FD;
         }
@@ -1734,6 +1786,10 @@ namespace moris
             fd_scheme( aFDSchemeType, tFDScheme );
             uint tNumPoints = tFDScheme( 0 ).size();
 
+            // reset the evaluation flags if the field interpolators changed since the last
+            // reset, such that the unperturbed quantities are taken from the cache if valid
+            this->update_eval_flags();
+
             // get the derivative dof type index
             uint tDofIndex = mGlobalDofTypeMap( static_cast< uint >( aDofTypes( 0 ) ) );
 
@@ -1817,6 +1873,9 @@ namespace moris
             // reset the coefficients values
             tFIDerivative->set_coeff( tCoeff );
 
+            // evaluate on the unperturbed coefficients from here on
+            this->reset_eval_flags();
+
             // set value for storage
             mddivfluxdu( tDofIndex ) = addivfluxdu_FD;
         }
@@ -1835,6 +1894,10 @@ namespace moris
             fd_scheme( aFDSchemeType, tFDScheme );
             uint tNumPoints = tFDScheme( 0 ).size();
 
+            // reset the evaluation flags if the field interpolators changed since the last
+            // reset, such that the unperturbed quantities are taken from the cache if valid
+            this->update_eval_flags();
+
             // get the derivative dof type index
             uint tDofIndex = mGlobalDofTypeMap( static_cast< uint >( aDofTypes( 0 ) ) );
 
@@ -1917,6 +1980,9 @@ namespace moris
             // reset the coefficients values
             tFIDerivative->set_coeff( tCoeff );
 
+            // evaluate on the unperturbed coefficients from here on
+            this->reset_eval_flags();
+
             // set value for storage
             mddivstraindu( tDofIndex ) = addivstraindu_FD;
         }
@@ -1935,6 +2001,10 @@ namespace moris
             fd_scheme( aFDSchemeType, tFDScheme );
             uint tNumPoints = tFDScheme( 0 ).size();
 
+            // reset the evaluation flags if the field interpolators changed since the last
+            // reset, such that the unperturbed quantities are taken from the cache if valid
+            this->update_eval_flags();
+
             // get the derivative dof type index
             uint tDofIndex = mGlobalDofTypeMap( static_cast< uint >( aDofTypes( 0 ) ) );
 
@@ -2016,6 +2086,9 @@ namespace moris
             // reset the coefficients values
             tFI->set_coeff( tCoeff );
 
+            // evaluate on the unperturbed coefficients from here on
+            this->reset_eval_flags();
+
             // set value to storage
             mEnergyDof( tDofIndex ) = adEnergydDOF_FD;
         }
@@ -2034,6 +2107,10 @@ namespace moris
             fd_scheme( aFDSchemeType, tFDScheme );
             uint tNumPoints = tFDScheme( 0 ).size();
 
+            // reset the evaluation flags if the field interpolators changed since the last
+            // reset, such that the unperturbed quantities are taken from the cache if valid
+            this->update_eval_flags();
+
             // get the derivative dof type index
             uint tDofIndex = mGlobalDofTypeMap( static_cast< uint >( aDofTypes( 0 ) ) );
 
@@ -2115,6 +2192,9 @@ namespace moris
             // reset the coefficients values
             tFI->set_coeff( tCoeff );
 
+            // evaluate on the unperturbed coefficients from here on
+            this->reset_eval_flags();
+
             // set value to storage
             mEnergyDotDof( tDofIndex ) = adEnergyDotdDOF_FD;
         }
@@ -2133,6 +2213,10 @@ namespace moris
             fd_scheme( aFDSchemeType, tFDScheme );
             uint tNumPoints = tFDScheme( 0 ).size();
 
+            // reset the evaluation flags if the field interpolators changed since the last
+            // reset, such that the unperturbed quantities are taken from the cache if valid
+            this->update_eval_flags();
+
             // get the derivative dof type index
             uint tDofIndex = mGlobalDofTypeMap( static_cast< uint >( aDofTypes( 0 ) ) );
 
@@ -2214,6 +2298,9 @@ namespace moris
             // reset the coefficients values
             tFI->set_coeff( tCoeff );
 
+            // evaluate on the unperturbed coefficients from here on
+            this->reset_eval_flags();
+
             // set value to storage
             mGradEnergyDof( tDofIndex ) = adGradEnergydDOF_FD;
         }
@@ -2232,6 +2319,10 @@ namespace moris
             fd_scheme( aFDSchemeType, tFDScheme );
             uint tNumPoints = tFDScheme( 0 ).size();
 
+            // reset the evaluation flags if the field interpolators changed since the last
+            // reset, such that the unperturbed quantities are taken from the cache if valid
+            this->update_eval_flags();
+
             // get the derivative dof type index
             uint tDofIndex = mGlobalDofTypeMap( static_cast< uint >( aDofTypes( 0 ) ) );
 
@@ -2314,6 +2405,9 @@ namespace moris
             // reset the coefficients values
             tFI->set_coeff( tCoeff );
 
+            // evaluate on the unperturbed coefficients from here on
+            this->reset_eval_flags();
+
             // set value to storage
             mGradEnergyDotDof( tDofIndex ) = adGradEnergyDotdDOF_FD;
         }
@@ -2332,6 +2426,10 @@ namespace moris
             fd_scheme( aFDSchemeType, tFDScheme );
             uint tNumPoints = tFDScheme( 0 ).size();
 
+            // reset the evaluation flags if the field interpolators changed since the last
+            // reset, such that the unperturbed quantities are taken from the cache if valid
+            this->update_eval_flags();
+
             // get the derivative dof type index
             uint tDofIndex = mGlobalDofTypeMap( static_cast< uint >( aDofTypes( 0 ) ) );
 
@@ -2414,6 +2512,9 @@ namespace moris
             // reset the coefficients values
             tFI->set_coeff( tCoeff );
 
+            // evaluate on the unperturbed coefficients from here on
+            this->reset_eval_flags();
+
             // set value to storage
             mGradDivFluxDof( tDofIndex ) = adGradDivFluxdDOF_FD;
         }
@@ -2432,6 +2533,10 @@ namespace moris
             fd_scheme( aFDSchemeType, tFDScheme );
             uint tNumPoints = tFDScheme( 0 ).size();
 
+            // reset the evaluation flags if the field interpolators changed since the last
+            // reset, such that the unperturbed quantities are taken from the cache if valid
+            this->update_eval_flags();
+
             // get the derivative dof type index
             uint tDofIndex = mGlobalDofTypeMap( static_cast< uint >( aDofTypes( 0 ) ) );
 
@@ -2514,6 +2619,9 @@ namespace moris
             // reset the coefficients values
             tFI->set_coeff( tCoeff );
 
+            // evaluate on the unperturbed coefficients from here on
+            this->reset_eval_flags();
+
             // set value to storage
             mdStraindDof( tDofIndex ) = adStraindDOF_FD;
         }
@@ -2531,6 +2639,10 @@ namespace moris
             moris::Cell< moris::Cell< real > > tFDScheme;
             fd_scheme( aFDSchemeType, tFDScheme );
 
+            // reset the evaluation flags if the field interpolators changed since the last
+            // reset, such that the unperturbed quantities are taken from the cache if valid
+            this->update_eval_flags();
+
             // get the field interpolator for type
             Field_Interpolator* tFI = mFIManager->get_field_interpolators_for_type( aDvTypes( 0 ) );
 
@@ -2591,6 +2703,9 @@ namespace moris
             }
             // reset the coefficients values
             tFI->set_coeff( tCoeff );
+
+            // evaluate on the unperturbed coefficients from here on
+            this->reset_eval_flags();
         }
 
         //------------------------------------------------------------------------------
@@ -2606,6 +2721,10 @@ namespace moris
             moris::Cell< moris::Cell< real > > tFDScheme;
             fd_scheme( aFDSchemeType, tFDScheme );
 
+            // reset the evaluation flags if the field interpolators changed since the last
+            // reset, such that the unperturbed quantities are taken from the cache if valid
+            this->update_eval_flags();
+
             // get the field interpolator for type
             Field_Interpolator* tFI = mFIManager->get_field_interpolators_for_type( aDvTypes( 0 ) );
 
@@ -2666,6 +2785,9 @@ namespace moris
             }
             // reset the coefficients values
             tFI->set_coeff( tCoeff );
+
+            // evaluate on the unperturbed coefficients from here on
+            this->reset_eval_flags();
         }
 
         //------------------------------------------------------------------------------
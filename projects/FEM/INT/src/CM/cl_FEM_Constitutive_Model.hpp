@@ -177,6 +177,9 @@ namespace moris
             std::string mName = "Undefined";
 
           private:
+            // field interpolator evaluation state at the last reset of the evaluation flags
+            luint mEvaluationState = MORIS_LUINT_MAX;
+
             // bool for global dof type list and map build
             bool mGlobalDofBuild      = true;
             bool mGlobalDvBuild       = true;
@@ -415,6 +418,26 @@ namespace moris
              */
             virtual void reset_eval_flags();
 
+            //------------------------------------------------------------------------------
+            /**
+             * reset evaluation flags only if any field interpolator of the field interpolator
+             * manager changed its coefficients
+             * or evaluation point since the last reset. This lets IWGs, IQIs and SPs sharing
+             * this constitutive model reuse its evaluations at an integration point.
+             */
+            void update_eval_flags();
+
+            //------------------------------------------------------------------------------
+            /**
+             * invalidate the cached evaluations, such that the next call to
+             * update_eval_flags() resets the evaluation flags
+             */
+            void
+            invalidate_eval_cache()
+            {
+                mEvaluationState = MORIS_LUINT_MAX;
+            }
+
             //------------------------------------------------------------------------------
             /**
              * reset evaluation flags specific to certain constitutive models
@@ -699,6 +699,18 @@ namespace moris
         {
             Tracer tTracer( "FEM", "Model", "Load and Initialize Parameters" );
 
+            // keep the library to create replicas of the IWGs and IQIs
+            mLibrary = aLibrary;
+
+            // create the physics from the parameter lists
+            this->create_physics();
+        }
+
+        //------------------------------------------------------------------------------
+
+        void
+        FEM_Model::create_physics()
+        {
             // get msi string to dof type map
             moris::map< std::string, MSI::Dof_Type > tMSIDofTypeMap =
                     moris::MSI::get_msi_dof_type_map();
@@ -718,11 +730,21 @@ namespace moris
                 {
                     // create properties
                     std::map< std::string, uint > tPropertyMap;
-                    this->create_properties( tPropertyMap, tMSIDofTypeMap, tMSIDvTypeMap, tFieldTypeMap, aLibrary );
+                    this->create_properties( tPropertyMap, tMSIDofTypeMap, tMSIDvTypeMap, tFieldTypeMap, mLibrary );
 
-                    // create fields
+                    // create fields, replicas share the fields of the model
                     std::map< std::string, uint > tFieldMap;
-                    this->create_fields( tFieldMap );
+                    if ( !mIsCreatingReplicas )
+                    {
+                        this->create_fields( tFieldMap );
+                    }
+                    else
+                    {
+                        for ( uint iField = 0; iField < mFields.size(); iField++ )
+                        {
+                            tFieldMap[ mFields( iField )->get_label() ] = iField;
+                        }
+                    }
 
                     // create material models
                     std::map< std::string, uint > tMMMap;
@@ -758,11 +780,21 @@ namespace moris
 
                     // create properties
                     std::map< std::string, uint > tPropertyMap;
-                    this->create_properties( tPropertyMap, tMSIDofTypeMap, tMSIDvTypeMap, tFieldTypeMap, aLibrary );
+                    this->create_properties( tPropertyMap, tMSIDofTypeMap, tMSIDvTypeMap, tFieldTypeMap, mLibrary );
 
-                    // create fields
+                    // create fields, replicas share the fields of the model
                     std::map< std::string, uint > tFieldMap;
-                    this->create_fields( tFieldMap );
+                    if ( !mIsCreatingReplicas )
+                    {
+                        this->create_fields( tFieldMap );
+                    }
+                    else
+                    {
+                        for ( uint iField = 0; iField < mFields.size(); iField++ )
+                        {
+                            tFieldMap[ mFields( iField )->get_label() ] = iField;
+                        }
+                    }
 
                     // create material models
                     this->create_material_models( tPropertyMap, tMSIDofTypeMap, tMSIDvTypeMap );
@@ -791,7 +823,7 @@ namespace moris
                             tComputationParameterList.get< bool >( "print_physics_model" );
 
                     // if print FEM model
-                    if ( tPrintPhysics )
+                    if ( tPrintPhysics && !mIsCreatingReplicas )
                     {
                         // phase info
                         std::cout << "Phase info " << std::endl;
@@ -821,8 +853,78 @@ namespace moris
                 }
 
                 default:
-                    MORIS_ERROR( false, "FEM_Model::initialize - wrong size for parameter list" );
+                    MORIS_ERROR( false, "FEM_Model::create_physics - wrong size for parameter list" );
+            }
+        }
+
+        //------------------------------------------------------------------------------
+
+        bool
+        FEM_Model::create_IWG_and_IQI_replicas(
+                const fem::Set*                        aSet,
+                moris::Cell< std::shared_ptr< IWG > >& aIWGs,
+                moris::Cell< std::shared_ptr< IQI > >& aIQIs )
+        {
+            // replicas can only be built from parameter lists
+            if ( !this->can_create_IWG_and_IQI_replicas() )
+            {
+                return false;
             }
+
+            // get the index of the set
+            uint tSetIndex = 0;
+            while ( tSetIndex < mFemSets.size() && mFemSets( tSetIndex ) != aSet )
+            {
+                tSetIndex++;
+            }
+
+            MORIS_ERROR( tSetIndex < mFemSets.size(),
+                    "FEM_Model::create_IWG_and_IQI_replicas - set is not part of this model." );
+
+            // stash the physics of the model
+            moris::Cell< std::shared_ptr< fem::Property > >                tProperties = mProperties;
+            moris::Cell< std::shared_ptr< fem::Material_Model > >          tMMs        = mMMs;
+            moris::Cell< std::shared_ptr< fem::Constitutive_Model > >      tCMs        = mCMs;
+            moris::Cell< std::shared_ptr< fem::Stabilization_Parameter > > tSPs        = mSPs;
+            moris::Cell< std::shared_ptr< fem::IWG > >                     tIWGs       = mIWGs;
+            moris::Cell< std::shared_ptr< fem::IQI > >                     tIQIs       = mIQIs;
+            moris::Cell< fem::Set_User_Info >                              tSetInfo    = mSetInfo;
+            moris::Cell< fem::Phase_User_Info >                            tPhaseInfo  = mPhaseInfo;
+            std::map< std::string, uint >                                  tPhaseMap   = mPhaseMap;
+
+            mProperties.clear();
+            mMMs.clear();
+            mCMs.clear();
+            mSPs.clear();
+            mIWGs.clear();
+            mIQIs.clear();
+            mSetInfo.clear();
+            mPhaseInfo.clear();
+            mPhaseMap.clear();
+
+            // create a new set of physics objects, sets are created in the same order from the same input
+            mIsCreatingReplicas = true;
+            this->create_physics();
+            mIsCreatingReplicas = false;
+
+            MORIS_ERROR( mSetInfo.size() == tSetInfo.size(),
+                    "FEM_Model::create_IWG_and_IQI_replicas - number of replicated sets does not match." );
+
+            aIWGs = mSetInfo( tSetIndex ).get_IWGs();
+            aIQIs = mSetInfo( tSetIndex ).get_IQIs();
+
+            // restore the physics of the model
+            mProperties = tProperties;
+            mMMs        = tMMs;
+            mCMs        = tCMs;
+            mSPs        = tSPs;
+            mIWGs       = tIWGs;
+            mIQIs       = tIQIs;
+            mSetInfo    = tSetInfo;
+            mPhaseInfo  = tPhaseInfo;
+            mPhaseMap   = tPhaseMap;
+
+            return true;
         }
 
         //------------------------------------------------------------------------------
@@ -3541,7 +3643,7 @@ namespace moris
             }
 
             // debug print
-            if ( tPrintPhysics )
+            if ( tPrintPhysics && !mIsCreatingReplicas )
             {
                 for ( uint iSet = 0; iSet < mSetInfo.size(); iSet++ )
                 {
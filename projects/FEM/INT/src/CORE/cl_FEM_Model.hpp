@@ -140,6 +140,12 @@ namespace moris
             // flag to skip GEN procedures
             bool mFEMOnly = false;
 
+            // library for property functions, kept to create replicas of the IWGs and IQIs
+            std::shared_ptr< Library_IO > mLibrary;
+
+            // flag set while replicas of the IWGs and IQIs are created
+            bool mIsCreatingReplicas = false;
+
             //------------------------------------------------------------------------------
 
           public:
@@ -235,6 +241,33 @@ namespace moris
              */
             void initialize( std::shared_ptr< Library_IO > aLibrary );
 
+            //------------------------------------------------------------------------------
+            /**
+             * returns if replicas of the IWGs and IQIs of the fem sets can be created,
+             * i.e. if the model was initialized from parameter lists
+             */
+            bool
+            can_create_IWG_and_IQI_replicas() const
+            {
+                return mParameterList.size() > 0;
+            }
+
+            //------------------------------------------------------------------------------
+            /**
+             * create replicas of the IWGs and IQIs of a fem set, with their own properties,
+             * material and constitutive models and stabilization parameters, such that the
+             * set can be evaluated by multiple threads. Fields are shared with the originals.
+             * Only possible if the model was initialized from parameter lists.
+             * @param[ in ]  aSet  fem set to replicate the IWGs and IQIs of
+             * @param[ out ] aIWGs replicas of the IWGs of the set, in the order of the set
+             * @param[ out ] aIQIs replicas of the IQIs of the set, in the order of the set
+             * @param[ out ] bool  true if the replicas were created
+             */
+            bool create_IWG_and_IQI_replicas(
+                    const fem::Set*                        aSet,
+                    moris::Cell< std::shared_ptr< IWG > >& aIWGs,
+                    moris::Cell< std::shared_ptr< IQI > >& aIQIs );
+
             //------------------------------------------------------------------------------
 
             /**
@@ -575,6 +608,13 @@ namespace moris
              */
             void create_phases();
 
+            //------------------------------------------------------------------------------
+            /**
+             * create properties, material and constitutive models, stabilization parameters,
+             * IWGs, IQIs and fem set info from the parameter lists
+             */
+            void create_physics();
+
             //------------------------------------------------------------------------------
             /**
              * scale the IQIs according to user input.
@@ -34,6 +34,39 @@ namespace moris
 
         //------------------------------------------------------------------------------
 
+        void
+        Property::set_parameters(
+                const moris::Cell< moris::Matrix< DDRMat > >& aParameters )
+        {
+            mParameters = aParameters;
+
+            // invalidate evaluations cached on the previous parameters
+            if ( mFIManager != nullptr )
+            {
+                mFIManager->advance_evaluation_state();
+            }
+        }
+
+        //------------------------------------------------------------------------------
+
+        void
+        Property::set_val_function( PropertyFunc aValFunction )
+        {
+            // set the value function
+            mValFunction = aValFunction;
+
+            // set setting flag
+            mSetValFunction = true;
+
+            // invalidate evaluations cached on the previous value function
+            if ( mFIManager != nullptr )
+            {
+                mFIManager->advance_evaluation_state();
+            }
+        }
+
+        //------------------------------------------------------------------------------
+
         void
         Property::set_space_der_functions(
                 const moris::Cell< PropertyFunc >& aSpaceDerFunctions )
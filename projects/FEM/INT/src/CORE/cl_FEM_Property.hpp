@@ -174,12 +174,8 @@ namespace moris
              * set parameters
              * @param[ in ] aParameters list of parameters for property evaluation
              */
-            void
-            set_parameters(
-                    const moris::Cell< moris::Matrix< DDRMat > >& aParameters )
-            {
-                mParameters = aParameters;
-            }
+            void set_parameters(
+                    const moris::Cell< moris::Matrix< DDRMat > >& aParameters );
 
             //------------------------------------------------------------------------------
             /**
@@ -197,15 +193,7 @@ namespace moris
              * set val function
              * @param[ in ] aValFunction function for property evaluation
              */
-            void
-            set_val_function( PropertyFunc aValFunction )
-            {
-                // set the value function
-                mValFunction = aValFunction;
-
-                // set setting flag
-                mSetValFunction = true;
-            }
+            void set_val_function( PropertyFunc aValFunction );
 
             //------------------------------------------------------------------------------
             /**
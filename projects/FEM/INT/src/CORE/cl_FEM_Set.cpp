@@ -36,8 +36,6 @@ namespace moris
                 const moris::Cell< Node_Base* >& aIPNodes )
                 : mFemModel( aFemModel )
                 , mMeshSet( aMeshSet )
-                , mIWGs( aSetInfo.get_IWGs() )
-                , mIQIs( aSetInfo.get_IQIs() )
                 , mTimeContinuity( aSetInfo.get_time_continuity() )
                 , mIsAnalyticalFA( aSetInfo.get_is_analytical_forward_analysis() )
                 , mFDSchemeForFA( aSetInfo.get_finite_difference_scheme_for_forward_analysis() )
@@ -47,6 +45,10 @@ namespace moris
                 , mFDPerturbation( aSetInfo.get_finite_difference_perturbation_size() )
                 , mPerturbationStrategy( aSetInfo.get_perturbation_strategy() )
         {
+            // get the IWGs and IQIs of the set
+            mIWGs = aSetInfo.get_IWGs();
+            mIQIs = aSetInfo.get_IQIs();
+
             // get the set type (BULK, SIDESET, DOUBLE_SIDESET, TIME_SIDESET)
             this->determine_set_type();
 
@@ -192,17 +194,21 @@ namespace moris
 
                 mIsStaggered = aIsStaggered;
 
-                this->create_residual_dof_assembly_map();
+                // rebuild assembly maps and requested IWG/IQI lists only if the solver request changed
+                if ( !this->check_and_update_initialization_cache( aIsStaggered, aTimeContinuityOnlyFlag ) )
+                {
+                    this->create_residual_dof_assembly_map();
 
-                this->create_dof_assembly_map( aIsStaggered );
+                    this->create_dof_assembly_map( aIsStaggered );
 
-                this->create_mat_pdv_assembly_map();
+                    this->create_mat_pdv_assembly_map();
 
-                this->create_requested_IWG_list( aTimeContinuityOnlyFlag );
+                    this->create_requested_IWG_list( aTimeContinuityOnlyFlag );
 
-                this->create_requested_IQI_list();
+                    this->create_requested_IQI_list();
 
-                this->create_requested_IQI_type_map();
+                    this->create_requested_IQI_type_map();
+                }
 
                 this->build_requested_IWG_dof_type_list( aIsStaggered );
 
@@ -219,7 +225,64 @@ namespace moris
                 {
                     tIQI->set_set_pointer( this );
                 }
+
+                // update the requested IWGs and IQIs of the further threads
+                for ( Set_Workspace* tWorkspace : mFemWorkspaces )
+                {
+                    this->update_requested_lists( *tWorkspace );
+                }
+            }
+        }
+
+        //------------------------------------------------------------------------------
+
+        bool
+        Set::check_and_update_initialization_cache(
+                const bool                 aIsStaggered,
+                const Time_Continuity_Flag aTimeContinuityOnlyFlag )
+        {
+            // get the current solver request
+            const moris::Cell< enum MSI::Dof_Type >& tRequestedDofTypes = this->get_requested_dof_types();
+            const moris::Cell< std::string >&        tRequestedIQINames = mEquationModel->get_requested_IQI_names();
+
+            const bool tIsForwardAnalysis        = mEquationModel->get_is_forward_analysis();
+            const bool tIsAdjointOffDiagonalTime = mEquationModel->get_is_adjoint_off_diagonal_time_contribution();
+
+            // check if the maps were built for the same request
+            bool tIsCached = mIsInitializationCached
+                          && mCachedIsStaggered == aIsStaggered
+                          && mCachedTimeContinuityFlag == aTimeContinuityOnlyFlag
+                          && mCachedIsForwardAnalysis == tIsForwardAnalysis
+                          && mCachedIsAdjointOffDiagonalTime == tIsAdjointOffDiagonalTime
+                          && mCachedRequestedDofTypes.data() == tRequestedDofTypes.data()
+                          && mCachedRequestedIQINames.data() == tRequestedIQINames.data();
+
+            // secondary dof types are only used for the staggered jacobian
+            if ( tIsCached && aIsStaggered )
+            {
+                tIsCached = mCachedSecondaryDofTypes.data() == this->get_secondary_dof_types().data();
+            }
+
+            if ( tIsCached )
+            {
+                return true;
+            }
+
+            // store the request the maps are built for
+            mIsInitializationCached         = true;
+            mCachedIsStaggered              = aIsStaggered;
+            mCachedTimeContinuityFlag       = aTimeContinuityOnlyFlag;
+            mCachedIsForwardAnalysis        = tIsForwardAnalysis;
+            mCachedIsAdjointOffDiagonalTime = tIsAdjointOffDiagonalTime;
+            mCachedRequestedDofTypes        = tRequestedDofTypes;
+            mCachedRequestedIQINames        = tRequestedIQINames;
+
+            if ( aIsStaggered )
+            {
+                mCachedSecondaryDofTypes = this->get_secondary_dof_types();
             }
+
+            return false;
         }
 
         //------------------------------------------------------------------------------
@@ -229,6 +292,9 @@ namespace moris
         {
             if ( !mIsEmptySet )    // FIXME this flag is a hack. find better solution
             {
+                // field interpolators are rebuilt, assembly maps need to be recomputed
+                mIsInitializationCached = false;
+
                 // delete the field interpolator pointers
                 this->delete_pointers();
 
@@ -255,6 +321,14 @@ namespace moris
             {
                 tIWG->free_memory();
             }
+
+            for ( Set_Workspace* tWorkspace : mFemWorkspaces )
+            {
+                for ( const std::shared_ptr< IWG >& tIWG : tWorkspace->mIWGs )
+                {
+                    tIWG->free_memory();
+                }
+            }
         }
 
         //------------------------------------------------------------------------------
@@ -269,25 +343,161 @@ namespace moris
         void
         Set::delete_pointers()
         {
-            if ( mLeaderFIManager != nullptr )
+            // delete the field interpolator managers of the first thread
+            this->delete_field_interpolator_managers( *this );
+
+            // delete the workspaces of the further threads, they are rebuilt on demand
+            this->delete_workspaces();
+        }
+
+        //------------------------------------------------------------------------------
+
+        void
+        Set::delete_field_interpolator_managers( Set_Workspace& aWorkspace )
+        {
+            if ( aWorkspace.mLeaderFIManager != nullptr )
+            {
+                delete aWorkspace.mLeaderFIManager;
+                aWorkspace.mLeaderFIManager = nullptr;
+            }
+            if ( aWorkspace.mFollowerFIManager != nullptr )
             {
-                delete mLeaderFIManager;
-                mLeaderFIManager = nullptr;
+                delete aWorkspace.mFollowerFIManager;
+                aWorkspace.mFollowerFIManager = nullptr;
             }
-            if ( mFollowerFIManager != nullptr )
+            if ( aWorkspace.mLeaderPreviousFIManager != nullptr )
+            {
+                delete aWorkspace.mLeaderPreviousFIManager;
+                aWorkspace.mLeaderPreviousFIManager = nullptr;
+            }
+            if ( aWorkspace.mLeaderEigenFIManager != nullptr )
+            {
+                delete aWorkspace.mLeaderEigenFIManager;
+                aWorkspace.mLeaderEigenFIManager = nullptr;
+            }
+        }
+
+        //------------------------------------------------------------------------------
+
+        void
+        Set::delete_workspaces()
+        {
+            for ( Set_Workspace* tWorkspace : mFemWorkspaces )
             {
-                delete mFollowerFIManager;
-                mFollowerFIManager = nullptr;
+                this->delete_field_interpolator_managers( *tWorkspace );
+
+                delete tWorkspace;
             }
-            if ( mLeaderPreviousFIManager != nullptr )
+            mFemWorkspaces.clear();
+        }
+
+        //------------------------------------------------------------------------------
+
+        void
+        Set::create_workspaces( const uint aNumWorkspaces )
+        {
+            // create the pdof value and element matrix workspaces
+            MSI::Equation_Set::create_workspaces( aNumWorkspaces );
+
+            // the first thread works on the set itself
+            if ( mIsEmptySet || mFemWorkspaces.size() + 1 >= aNumWorkspaces )
             {
-                delete mLeaderPreviousFIManager;
-                mLeaderPreviousFIManager = nullptr;
+                return;
             }
-            if ( mLeaderEigenFIManager != nullptr )
+
+            for ( uint iWorkspace = mFemWorkspaces.size() + 1; iWorkspace < aNumWorkspaces; iWorkspace++ )
             {
-                delete mLeaderEigenFIManager;
-                mLeaderEigenFIManager = nullptr;
+                Set_Workspace* tWorkspace = new Set_Workspace();
+
+                // get replicas of the IWGs and IQIs of this set
+                bool tIsReplicated = mFemModel->create_IWG_and_IQI_replicas(
+                        this,
+                        tWorkspace->mIWGs,
+                        tWorkspace->mIQIs );
+
+                MORIS_ERROR( tIsReplicated,
+                        "fem::Set::create_workspaces - FEM model cannot replicate IWGs and IQIs of set %s.",
+                        this->get_set_name().c_str() );
+
+                MORIS_ERROR( tWorkspace->mIWGs.size() == mIWGs.size() && tWorkspace->mIQIs.size() == mIQIs.size(),
+                        "fem::Set::create_workspaces - replicated IWGs and IQIs do not match the ones of set %s.",
+                        this->get_set_name().c_str() );
+
+                // set the fem set pointer to the replicas
+                for ( const std::shared_ptr< IWG >& tIWG : tWorkspace->mIWGs )
+                {
+                    tIWG->set_set_pointer( this );
+                }
+
+                for ( const std::shared_ptr< IQI >& tIQI : tWorkspace->mIQIs )
+                {
+                    tIQI->set_set_pointer( this );
+                }
+
+                // create the field interpolators of the workspace and set them to the replicas
+                this->create_field_interpolator_managers( mModelSolverInterface, *tWorkspace );
+                this->set_IWG_field_interpolator_managers( *tWorkspace );
+                this->set_IQI_field_interpolator_managers( *tWorkspace );
+
+                // select the replicas of the requested IWGs and IQIs
+                this->update_requested_lists( *tWorkspace );
+
+                mFemWorkspaces.push_back( tWorkspace );
+            }
+        }
+
+        //------------------------------------------------------------------------------
+
+        bool
+        Set::supports_concurrent_evaluation()
+        {
+            // further threads need replicas of the IWGs and IQIs
+            if ( mFemModel == nullptr || !mFemModel->can_create_IWG_and_IQI_replicas() )
+            {
+                return false;
+            }
+
+            // fields are shared between threads and update their nodal values lazily
+            return mLeaderFieldTypes.size() == 0 && mFollowerFieldTypes.size() == 0;
+        }
+        //------------------------------------------------------------------------------
+
+        void
+        Set::update_requested_lists( Set_Workspace& aWorkspace )
+        {
+            // select the replicas of the requested IWGs, IWGs are replicated in the same order
+            aWorkspace.mRequestedIWGs.resize( mRequestedIWGs.size() );
+
+            for ( uint iRequested = 0; iRequested < mRequestedIWGs.size(); iRequested++ )
+            {
+                uint iIWG = 0;
+                while ( mIWGs( iIWG ) != mRequestedIWGs( iRequested ) )
+                {
+                    iIWG++;
+                }
+
+                aWorkspace.mRequestedIWGs( iRequested ) = aWorkspace.mIWGs( iIWG );
+
+                aWorkspace.mRequestedIWGs( iRequested )->build_requested_dof_type_list( mIsStaggered );
+            }
+
+            // select the replicas of the requested IQIs
+            aWorkspace.mRequestedIQIs.resize( mRequestedIQIs.size() );
+
+            for ( uint iRequested = 0; iRequested < mRequestedIQIs.size(); iRequested++ )
+            {
+                moris_index tIQIIndex = mIQINameToIndexMap.find( mRequestedIQIs( iRequested )->get_name() );
+
+                aWorkspace.mRequestedIQIs( iRequested ) = aWorkspace.mIQIs( tIQIIndex );
+
+                aWorkspace.mRequestedIQIs( iRequested )->build_requested_dof_type_list();
+
+                // normalization of the IQI is set on the original only
+                if ( mRequestedIQIs( iRequested )->is_normalized() )
+                {
+                    aWorkspace.mRequestedIQIs( iRequested )->set_reference_value(
+                            mRequestedIQIs( iRequested )->get_reference_value() );
+                }
             }
         }
 
@@ -355,6 +565,96 @@ namespace moris
 
             // get integration weights
             tIntegrator.get_weights( mIntegWeights );
+
+            // shape function tables are only valid for the current integration points
+            mSpaceShapeFunctionTables.clear();
+            mTimeShapeFunctionTables.clear();
+        }
+
+        //------------------------------------------------------------------------------
+
+        std::shared_ptr< const Shape_Function_Table >
+        Set::get_space_shape_function_table(
+                const mtk::Interpolation_Rule& aInterpolationRule )
+        {
+            // check that the integration points can be tabulated
+            if ( !this->has_tabulated_integration_points() )
+            {
+                return nullptr;
+            }
+
+            // the integration rule is fixed for the set, so the interpolation rule is the key
+            Shape_Function_Table_Key tKey(
+                    aInterpolationRule.get_geometry_type(),
+                    aInterpolationRule.get_space_interpolation_type(),
+                    aInterpolationRule.get_space_interpolation_order() );
+
+            // return the table if it was created before
+            auto tIter = mSpaceShapeFunctionTables.find( tKey );
+
+            if ( tIter != mSpaceShapeFunctionTables.end() )
+            {
+                return tIter->second;
+            }
+
+            // get the space coordinates of the integration points
+            uint             tNumSpaceDim      = mIntegPoints.n_rows() - 1;
+            Matrix< DDRMat > tSpaceIntegPoints = mIntegPoints( { 0, tNumSpaceDim - 1 }, { 0, mIntegPoints.n_cols() - 1 } );
+
+            // tabulate the space interpolation function at the integration points
+            mtk::Interpolation_Function_Base* tSpaceInterpolation = aInterpolationRule.create_space_interpolation_function();
+
+            std::shared_ptr< const Shape_Function_Table > tTable =
+                    std::make_shared< const Shape_Function_Table >( tSpaceInterpolation, tSpaceIntegPoints );
+
+            delete tSpaceInterpolation;
+
+            mSpaceShapeFunctionTables[ tKey ] = tTable;
+
+            return tTable;
+        }
+
+        //------------------------------------------------------------------------------
+
+        std::shared_ptr< const Shape_Function_Table >
+        Set::get_time_shape_function_table(
+                const mtk::Interpolation_Rule& aInterpolationRule )
+        {
+            // check that the integration points can be tabulated
+            if ( !this->has_tabulated_integration_points() )
+            {
+                return nullptr;
+            }
+
+            // the integration rule is fixed for the set, so the interpolation rule is the key
+            Shape_Function_Table_Key tKey(
+                    aInterpolationRule.get_time_geometry_type(),
+                    aInterpolationRule.get_time_interpolation_type(),
+                    aInterpolationRule.get_time_interpolation_order() );
+
+            // return the table if it was created before
+            auto tIter = mTimeShapeFunctionTables.find( tKey );
+
+            if ( tIter != mTimeShapeFunctionTables.end() )
+            {
+                return tIter->second;
+            }
+
+            // get the time coordinates of the integration points
+            uint             tTimeRow         = mIntegPoints.n_rows() - 1;
+            Matrix< DDRMat > tTimeIntegPoints = mIntegPoints( { tTimeRow, tTimeRow }, { 0, mIntegPoints.n_cols() - 1 } );
+
+            // tabulate the time interpolation function at the integration points
+            mtk::Interpolation_Function_Base* tTimeInterpolation = aInterpolationRule.create_time_interpolation_function();
+
+            std::shared_ptr< const Shape_Function_Table > tTable =
+                    std::make_shared< const Shape_Function_Table >( tTimeInterpolation, tTimeIntegPoints );
+
+            delete tTimeInterpolation;
+
+            mTimeShapeFunctionTables[ tKey ] = tTable;
+
+            return tTable;
         }
 
         //------------------------------------------------------------------------------
@@ -1115,26 +1415,37 @@ namespace moris
         void
         Set::create_field_interpolator_managers(
                 MSI::Model_Solver_Interface* aModelSolverInterface )
+        {
+            // create the field interpolator managers of the first thread
+            this->create_field_interpolator_managers( aModelSolverInterface, *this );
+        }
+
+        //------------------------------------------------------------------------------
+
+        void
+        Set::create_field_interpolator_managers(
+                MSI::Model_Solver_Interface* aModelSolverInterface,
+                Set_Workspace&               aWorkspace )
         {
             // create the leader field interpolator manager
-            mLeaderFIManager = new Field_Interpolator_Manager(
+            aWorkspace.mLeaderFIManager = new Field_Interpolator_Manager(
                     mLeaderDofTypes,
                     mLeaderDvTypes,
                     mLeaderFieldTypes,
                     this );
 
             // assign cell shape to the field interpolator manager
-            mLeaderFIManager->set_IG_cell_shape( mMeshSet->get_IG_cell_shape() );
-            mLeaderFIManager->set_IP_cell_shape( mMeshSet->get_IP_cell_shape() );
+            aWorkspace.mLeaderFIManager->set_IG_cell_shape( mMeshSet->get_IG_cell_shape() );
+            aWorkspace.mLeaderFIManager->set_IP_cell_shape( mMeshSet->get_IP_cell_shape() );
 
             // create the geometry interpolators on the leader FI manager
-            mLeaderFIManager->create_geometry_interpolators();
+            aWorkspace.mLeaderFIManager->create_geometry_interpolators();
 
             // create the field interpolators on the leader FI manager
-            mLeaderFIManager->create_field_interpolators( aModelSolverInterface );
+            aWorkspace.mLeaderFIManager->create_field_interpolators( aModelSolverInterface );
 
             // create the follower field interpolator manager
-            mFollowerFIManager = new Field_Interpolator_Manager(
+            aWorkspace.mFollowerFIManager = new Field_Interpolator_Manager(
                     mFollowerDofTypes,
                     mFollowerDvTypes,
                     mFollowerFieldTypes,
@@ -1142,34 +1453,34 @@ namespace moris
                     mtk::Leader_Follower::FOLLOWER );
 
             // assign cell shape to the field interpolator manager
-            mFollowerFIManager->set_IG_cell_shape( mMeshSet->get_IG_cell_shape() );
-            mFollowerFIManager->set_IP_cell_shape( mMeshSet->get_IP_cell_shape() );
+            aWorkspace.mFollowerFIManager->set_IG_cell_shape( mMeshSet->get_IG_cell_shape() );
+            aWorkspace.mFollowerFIManager->set_IP_cell_shape( mMeshSet->get_IP_cell_shape() );
 
             // create the geometry interpolators on the follower FI manager
-            mFollowerFIManager->create_geometry_interpolators();
+            aWorkspace.mFollowerFIManager->create_geometry_interpolators();
 
             // create the field interpolators on the follower FI manager
-            mFollowerFIManager->create_field_interpolators( aModelSolverInterface );
+            aWorkspace.mFollowerFIManager->create_field_interpolators( aModelSolverInterface );
 
             // if time sideset
             if ( mElementType == fem::Element_Type::TIME_SIDESET )
             {
                 // create the leader field interpolator manager
-                mLeaderPreviousFIManager = new Field_Interpolator_Manager(
+                aWorkspace.mLeaderPreviousFIManager = new Field_Interpolator_Manager(
                         mLeaderDofTypes,
                         mLeaderDvTypes,
                         mLeaderFieldTypes,
                         this );
 
                 // assign cell shape to the field interpolator manager
-                mLeaderPreviousFIManager->set_IG_cell_shape( mMeshSet->get_IG_cell_shape() );
-                mLeaderPreviousFIManager->set_IP_cell_shape( mMeshSet->get_IP_cell_shape() );
+                aWorkspace.mLeaderPreviousFIManager->set_IG_cell_shape( mMeshSet->get_IG_cell_shape() );
+                aWorkspace.mLeaderPreviousFIManager->set_IP_cell_shape( mMeshSet->get_IP_cell_shape() );
 
                 // create the geometry interpolators on the leader FI manager
-                mLeaderPreviousFIManager->create_geometry_interpolators();
+                aWorkspace.mLeaderPreviousFIManager->create_geometry_interpolators();
 
                 // create the field interpolators on the leader FI manager
-                mLeaderPreviousFIManager->create_field_interpolators( aModelSolverInterface );
+                aWorkspace.mLeaderPreviousFIManager->create_field_interpolators( aModelSolverInterface );
             }
 
             // if eigen vectors
@@ -1178,21 +1489,21 @@ namespace moris
             if ( mNumEigenVectors > 0 )
             {
                 // create the leader field interpolator manager
-                mLeaderEigenFIManager = new Field_Interpolator_Manager(
+                aWorkspace.mLeaderEigenFIManager = new Field_Interpolator_Manager(
                         mLeaderDofTypes,
                         mLeaderDvTypes,
                         mLeaderFieldTypes,
                         this );
 
                 // assign cell shape to the field interpolator manager
-                mLeaderEigenFIManager->set_IG_cell_shape( mMeshSet->get_IG_cell_shape() );
-                mLeaderEigenFIManager->set_IP_cell_shape( mMeshSet->get_IP_cell_shape() );
+                aWorkspace.mLeaderEigenFIManager->set_IG_cell_shape( mMeshSet->get_IG_cell_shape() );
+                aWorkspace.mLeaderEigenFIManager->set_IP_cell_shape( mMeshSet->get_IP_cell_shape() );
 
                 // create the geometry interpolators on the leader FI manager
-                mLeaderEigenFIManager->create_geometry_interpolators();
+                aWorkspace.mLeaderEigenFIManager->create_geometry_interpolators();
 
                 // create the field interpolators on the leader FI manager
-                mLeaderEigenFIManager->create_field_interpolators( aModelSolverInterface, mNumEigenVectors );
+                aWorkspace.mLeaderEigenFIManager->create_field_interpolators( aModelSolverInterface, mNumEigenVectors );
             }
         }
 
@@ -1202,17 +1513,20 @@ namespace moris
         Set::get_field_interpolator_manager(
                 mtk::Leader_Follower aIsLeader )
         {
+            // get the workspace of the calling thread
+            Set_Workspace& tWorkspace = this->get_fem_workspace();
+
             switch ( aIsLeader )
             {
                 case mtk::Leader_Follower::LEADER:
-                    return mLeaderFIManager;
+                    return tWorkspace.mLeaderFIManager;
 
                 case mtk::Leader_Follower::FOLLOWER:
-                    return mFollowerFIManager;
+                    return tWorkspace.mFollowerFIManager;
 
                 default:
                     MORIS_ERROR( false, "Set::get_field_interpolator_manager - can only be leader or follower." );
-                    return mLeaderFIManager;
+                    return tWorkspace.mLeaderFIManager;
             }
         }
 
@@ -1222,14 +1536,17 @@ namespace moris
         Set::get_field_interpolator_manager_previous_time(
                 mtk::Leader_Follower aIsLeader )
         {
+            // get the workspace of the calling thread
+            Set_Workspace& tWorkspace = this->get_fem_workspace();
+
             switch ( aIsLeader )
             {
                 case mtk::Leader_Follower::LEADER:
-                    return mLeaderPreviousFIManager;
+                    return tWorkspace.mLeaderPreviousFIManager;
 
                 default:
                     MORIS_ERROR( false, "Set::get_field_interpolator_manager - can only be leader." );
-                    return mLeaderPreviousFIManager;
+                    return tWorkspace.mLeaderPreviousFIManager;
             }
         }
 
@@ -1239,14 +1556,17 @@ namespace moris
         Set::get_field_interpolator_manager_eigen_vectors(
                 mtk::Leader_Follower aIsLeader )
         {
+            // get the workspace of the calling thread
+            Set_Workspace& tWorkspace = this->get_fem_workspace();
+
             switch ( aIsLeader )
             {
                 case mtk::Leader_Follower::LEADER:
-                    return mLeaderEigenFIManager;
+                    return tWorkspace.mLeaderEigenFIManager;
 
                 default:
                     MORIS_ERROR( false, "Set::get_field_interpolator_manager - can only be leader." );
-                    return mLeaderPreviousFIManager;
+                    return tWorkspace.mLeaderPreviousFIManager;
             }
         }
 
@@ -1254,19 +1574,28 @@ namespace moris
 
         void
         Set::set_IWG_field_interpolator_managers()
+        {
+            // set the field interpolator managers of the calling thread
+            this->set_IWG_field_interpolator_managers( this->get_fem_workspace() );
+        }
+
+        //------------------------------------------------------------------------------
+
+        void
+        Set::set_IWG_field_interpolator_managers( Set_Workspace& aWorkspace )
         {
             // loop over the IWGs
-            for ( const std::shared_ptr< IWG >& tIWG : mIWGs )
+            for ( const std::shared_ptr< IWG >& tIWG : aWorkspace.mIWGs )
             {
                 // set the leader FI manager
-                tIWG->set_field_interpolator_manager( mLeaderFIManager );
+                tIWG->set_field_interpolator_manager( aWorkspace.mLeaderFIManager );
 
                 // if double sideset, set follower
                 if ( mElementType == fem::Element_Type::DOUBLE_SIDESET )
                 {
                     // set IWG follower field interpolator manager
                     tIWG->set_field_interpolator_manager(
-                            mFollowerFIManager,
+                            aWorkspace.mFollowerFIManager,
                             mtk::Leader_Follower::FOLLOWER );
                 }
 
@@ -1275,7 +1604,7 @@ namespace moris
                 {
                     // set IWG leader field interpolator manager for previous time step
                     tIWG->set_field_interpolator_manager_previous_time(
-                            mLeaderPreviousFIManager,
+                            aWorkspace.mLeaderPreviousFIManager,
                             mtk::Leader_Follower::LEADER );
                 }
             }
@@ -1286,8 +1615,11 @@ namespace moris
         void
         Set::set_IWG_cluster_for_stabilization_parameters( fem::Cluster* aCluster )
         {
+            // get the workspace of the calling thread
+            Set_Workspace& tWorkspace = this->get_fem_workspace();
+
             // loop over the IWGs
-            for ( auto tIWG : mIWGs )
+            for ( auto tIWG : tWorkspace.mIWGs )
             {
                 // set the fem cluster to IWG
                 tIWG->set_cluster_pointer( aCluster );
@@ -1314,8 +1646,11 @@ namespace moris
         void
         Set::set_IQI_cluster_for_stabilization_parameters( fem::Cluster* aCluster )
         {
+            // get the workspace of the calling thread
+            Set_Workspace& tWorkspace = this->get_fem_workspace();
+
             // loop over the IQIs
-            for ( auto tIQI : mIQIs )
+            for ( auto tIQI : tWorkspace.mIQIs )
             {
                 // set the fem cluster to IQI
                 tIQI->set_cluster_pointer( aCluster );
@@ -1533,26 +1868,35 @@ namespace moris
 
         void
         Set::set_IQI_field_interpolator_managers()
+        {
+            // set the field interpolator managers of the calling thread
+            this->set_IQI_field_interpolator_managers( this->get_fem_workspace() );
+        }
+
+        //------------------------------------------------------------------------------
+
+        void
+        Set::set_IQI_field_interpolator_managers( Set_Workspace& aWorkspace )
         {
             // loop over the IQIs
-            for ( const std::shared_ptr< IQI >& tIQI : mIQIs )
+            for ( const std::shared_ptr< IQI >& tIQI : aWorkspace.mIQIs )
             {
                 // set IQI leader FI manager
-                tIQI->set_field_interpolator_manager( mLeaderFIManager );
+                tIQI->set_field_interpolator_manager( aWorkspace.mLeaderFIManager );
 
                 // if double sideset, set follower
                 if ( mElementType == fem::Element_Type::DOUBLE_SIDESET )
                 {
                     // set IQI follower FI manager
                     tIQI->set_field_interpolator_manager(
-                            mFollowerFIManager,
+                            aWorkspace.mFollowerFIManager,
                             mtk::Leader_Follower::FOLLOWER );
                 }
 
                 // set IQI leader FI manager for eigen vectors
-                if ( mLeaderEigenFIManager )
+                if ( aWorkspace.mLeaderEigenFIManager )
                 {
-                    tIQI->set_field_interpolator_manager_eigen_vector( mLeaderEigenFIManager );
+                    tIQI->set_field_interpolator_manager_eigen_vector( aWorkspace.mLeaderEigenFIManager );
                 }
             }
         }
@@ -2409,8 +2753,11 @@ namespace moris
         void
         Set::initialize_mJacobian()
         {
+            // get the workspace of the calling thread
+            MSI::Equation_Set_Workspace& tWorkspace = this->get_workspace();
+
             // if residual not initialized before
-            if ( !mJacobianExist )
+            if ( !tWorkspace.mJacobianExist )
             {
                 // get the dof types requested by the solver
                 const moris::Cell< enum MSI::Dof_Type >& tRequestedDofTypes =
@@ -2451,7 +2798,7 @@ namespace moris
                 if ( !mIsStaggered )
                 {
                     // set size for the jacobian matrix
-                    mJacobian.set_size( tNumCols, tNumCols, 0.0 );
+                    tWorkspace.mJacobian.set_size( tNumCols, tNumCols, 0.0 );
                 }
                 // if for Jacobian evaluation
                 else
@@ -2492,15 +2839,15 @@ namespace moris
                     }
 
                     // set size for the jacobian matrix
-                    mJacobian.set_size( tNumCols, tNumRows, 0.0 );
+                    tWorkspace.mJacobian.set_size( tNumCols, tNumRows, 0.0 );
                 }
                 // set the jacobian initialization flag to true
-                mJacobianExist = true;
+                tWorkspace.mJacobianExist = true;
             }
             else
             {
                 // fill the jacobian matrix with zeros
-                mJacobian.fill( 0.0 );
+                tWorkspace.mJacobian.fill( 0.0 );
             }
         }
 
@@ -2509,8 +2856,11 @@ namespace moris
         void
         Set::initialize_mResidual()
         {
+            // get the workspace of the calling thread
+            MSI::Equation_Set_Workspace& tWorkspace = this->get_workspace();
+
             // if residual not initialized before
-            if ( !mResidualExist )
+            if ( !tWorkspace.mResidualExist )
             {
                 moris::Cell< enum MSI::Dof_Type > tRequestedDofTypes;
 
@@ -2560,10 +2910,10 @@ namespace moris
                     uint tNumRHS = mEquationModel->get_num_rhs();
 
                     // set size for the list of dQIdu vectors
-                    mResidual.resize( tNumRHS );
+                    tWorkspace.mResidual.resize( tNumRHS );
 
                     // loop over the dQIdu vectors
-                    for ( auto& tRes : mResidual )
+                    for ( auto& tRes : tWorkspace.mResidual )
                     {
                         // set size for the dQIdu vector
                         tRes.set_size( tNumCoeff, 1, 0.0 );
@@ -2571,13 +2921,13 @@ namespace moris
                 }
 
                 // set the residual initialization flag to true
-                mResidualExist = true;
+                tWorkspace.mResidualExist = true;
             }
             // if residual initialized before
             else
             {
                 // loop over the residual vectors
-                for ( auto& tRes : mResidual )
+                for ( auto& tRes : tWorkspace.mResidual )
                 {
                     // fill the residual vector with zeros
                     tRes.fill( 0.0 );
@@ -2590,19 +2940,22 @@ namespace moris
         void
         Set::initialize_mQI()
         {
+            // get the workspace of the calling thread
+            MSI::Equation_Set_Workspace& tWorkspace = this->get_workspace();
+
             // if list of QI values not initialized before
-            if ( !mQIExist )
+            if ( !tWorkspace.mQIExist )
             {
                 uint tNumQI = mEquationModel->get_requested_IQI_names().size();
 
                 // set size for the list of QI values
-                mQI.resize( tNumQI );
+                tWorkspace.mQI.resize( tNumQI );
 
                 // counter to iterate through the IQIs
                 uint iIQICounter = 0;
 
                 // loop over mQIs to set the size
-                for ( auto& tQI : mQI )
+                for ( auto& tQI : tWorkspace.mQI )
                 {
                     // get number of rows and columns for the IQI from the equation model
                     uint tRowNum = mEquationModel->get_IQI_values()( iIQICounter ).n_rows();
@@ -2616,13 +2969,13 @@ namespace moris
                 }
 
                 // set the QI initialization flag to true
-                mQIExist = true;
+                tWorkspace.mQIExist = true;
             }
             // if list of QI values initialized before
             else
             {
                 // loop over the QI values
-                for ( auto& tQI : mQI )
+                for ( auto& tQI : tWorkspace.mQI )
                 {
                     // fill the QI value vector with zero
                     tQI.fill( 0.0 );
@@ -2635,17 +2988,20 @@ namespace moris
         void
         Set::initialize_mdQIdpMat()
         {
+            // get the workspace of the calling thread
+            MSI::Equation_Set_Workspace& tWorkspace = this->get_workspace();
+
             // if dRdpMap not initialized before
-            if ( !mdQIdpMatExist )
+            if ( !tWorkspace.mdQIdpMatExist )
             {
                 // set size for dQIdp
-                mdQIdp.resize( 2 );
+                tWorkspace.mdQIdp.resize( 2 );
 
                 // get the number of requested IQIs on the model
                 uint tNumRequestedIQIs = this->get_equation_model()->get_requested_IQI_names().size();
 
                 // set size for dQIdp
-                mdQIdp( 0 ).resize( tNumRequestedIQIs );
+                tWorkspace.mdQIdp( 0 ).resize( tNumRequestedIQIs );
 
                 // get the requested pdv types
                 moris::Cell< moris::Cell< enum PDV_Type > > tRequestedDvTypes;
@@ -2688,19 +3044,19 @@ namespace moris
                     }
                 }
                 // loop over requested IQIs
-                for ( auto& tdQIdp : mdQIdp( 0 ) )
+                for ( auto& tdQIdp : tWorkspace.mdQIdp( 0 ) )
                 {
                     // set size
                     tdQIdp.set_size( 1, tNumPdvCoefficients, 0.0 );
                 }
 
                 // set exist flag to true
-                mdQIdpMatExist = true;
+                tWorkspace.mdQIdpMatExist = true;
             }
             else
             {
                 // loop over requested IQIs
-                for ( auto& tdQIdp : mdQIdp( 0 ) )
+                for ( auto& tdQIdp : tWorkspace.mdQIdp( 0 ) )
                 {
                     // fill the dQIdp vector with zero
                     tdQIdp.fill( 0.0 );
@@ -2713,14 +3069,17 @@ namespace moris
         void
         Set::initialize_mdQIdpGeo( std::shared_ptr< fem::Cluster > aFemCluster )
         {
+            // get the workspace of the calling thread
+            MSI::Equation_Set_Workspace& tWorkspace = this->get_workspace();
+
             // get the number of requested IQIs
             uint tNumRequestedIQIs = this->get_equation_model()->get_requested_IQI_names().size();
 
             // set size for dQIdp
-            mdQIdp( 1 ).resize( tNumRequestedIQIs );
+            tWorkspace.mdQIdp( 1 ).resize( tNumRequestedIQIs );
 
             // loop over requested IQIs
-            for ( auto& tdQIdp : mdQIdp( 1 ) )
+            for ( auto& tdQIdp : tWorkspace.mdQIdp( 1 ) )
             {
                 // fill the dQIdp vector with zero
                 tdQIdp.set_size( 1, mPdvGeoAssemblyVector.numel(), 0.0 );
@@ -2732,11 +3091,14 @@ namespace moris
         void
         Set::initialize_mdRdpMat()
         {
+            // get the workspace of the calling thread
+            MSI::Equation_Set_Workspace& tWorkspace = this->get_workspace();
+
             // if dRdpMap not initialized before
-            if ( !mdRdpMatExist )
+            if ( !tWorkspace.mdRdpMatExist )
             {
                 // set size for dRdp
-                mdRdp.resize( 2 );
+                tWorkspace.mdRdp.resize( 2 );
 
                 // get the dof types requested by the solver
                 const moris::Cell< enum MSI::Dof_Type >& tRequestedDofTypes =
@@ -2815,15 +3177,15 @@ namespace moris
                     }
                 }
 
-                mdRdp( 0 ).set_size( tNumRows, tNumCols, 0.0 );
+                tWorkspace.mdRdp( 0 ).set_size( tNumRows, tNumCols, 0.0 );
 
                 // set the dRdpMat initialization flag to true
-                mdRdpMatExist = true;
+                tWorkspace.mdRdpMatExist = true;
             }
             // if dRdpMat initialized before
             else
             {
-                mdRdp( 0 ).fill( 0.0 );
+                tWorkspace.mdRdp( 0 ).fill( 0.0 );
             }
         }
 
@@ -2832,6 +3194,9 @@ namespace moris
         void
         Set::initialize_mdRdpGeo( std::shared_ptr< fem::Cluster > aFemCluster )
         {
+            // get the workspace of the calling thread
+            MSI::Equation_Set_Workspace& tWorkspace = this->get_workspace();
+
             // get the dof types requested by the solver
             const moris::Cell< enum MSI::Dof_Type >& tRequestedDofTypes =
                     this->get_requested_dof_types();
@@ -2868,7 +3233,7 @@ namespace moris
             }
 
             // set size for dRdpgeo
-            mdRdp( 1 ).set_size( tNumRows, mPdvGeoAssemblyVector.numel(), 0.0 );
+            tWorkspace.mdRdp( 1 ).set_size( tNumRows, mPdvGeoAssemblyVector.numel(), 0.0 );
         }
 
         //------------------------------------------------------------------------------
@@ -11,6 +11,9 @@
 #ifndef SRC_FEM_CL_FEM_SET_HPP_
 #define SRC_FEM_CL_FEM_SET_HPP_
 
+#include <map>
+#include <tuple>
+
 #include "assert.h"
 #include "cl_Communication_Tools.hpp"
 
@@ -26,7 +29,9 @@
 #include "cl_FEM_Constitutive_Model.hpp"
 #include "cl_FEM_Stabilization_Parameter.hpp"
 #include "cl_FEM_Set_User_Info.hpp"
+#include "cl_FEM_Set_Workspace.hpp"
 #include "cl_FEM_IQI.hpp"
+#include "cl_FEM_Shape_Function_Table.hpp"
 // FEM/MSI/src
 #include "cl_MSI_Equation_Set.hpp"
 #include "cl_MSI_Design_Variable_Interface.hpp"
@@ -57,8 +62,12 @@ namespace moris
         //------------------------------------------------------------------------------
         /**
          * FEM set
+         *
+         * The set is the evaluation workspace of the first thread, see Set_Workspace.
+         * Workspaces for further threads are created by create_workspaces().
          */
         class Set : public MSI::Equation_Set
+                , protected Set_Workspace
         {
           private:
             // FEM model
@@ -85,23 +94,12 @@ namespace moris
             // space interpolation order for IG cells
             mtk::Interpolation_Order mIGTimeInterpolationOrder = mtk::Interpolation_Order::UNDEFINED;
 
-            // field interpolator manager pointers
-            Field_Interpolator_Manager* mLeaderFIManager         = nullptr;
-            Field_Interpolator_Manager* mFollowerFIManager       = nullptr;
-            Field_Interpolator_Manager* mLeaderPreviousFIManager = nullptr;
-            Field_Interpolator_Manager* mLeaderEigenFIManager    = nullptr;
+            // evaluation workspaces of the worker threads other than the first one
+            moris::Cell< Set_Workspace* > mFemWorkspaces;
 
             // number of eigen vectors
             uint mNumEigenVectors = 0;
 
-            // cell of pointers to IWG objects
-            moris::Cell< std::shared_ptr< IWG > > mIWGs;
-            moris::Cell< std::shared_ptr< IWG > > mRequestedIWGs;
-
-            // cell of pointer to IQI objects
-            moris::Cell< std::shared_ptr< IQI > > mIQIs;
-            moris::Cell< std::shared_ptr< IQI > > mRequestedIQIs;
-
             moris::map< std::string, moris_index > mIQINameToIndexMap;
 
             // cell of pointer to IQI objects for vis
@@ -123,6 +121,11 @@ namespace moris
             // integration weights
             Matrix< DDRMat > mIntegWeights;
 
+            // space and time shape function tables at the integration points, keyed by interpolation rule
+            typedef std::tuple< mtk::Geometry_Type, mtk::Interpolation_Type, mtk::Interpolation_Order > Shape_Function_Table_Key;
+            std::map< Shape_Function_Table_Key, std::shared_ptr< const Shape_Function_Table > > mSpaceShapeFunctionTables;
+            std::map< Shape_Function_Table_Key, std::shared_ptr< const Shape_Function_Table > > mTimeShapeFunctionTables;
+
             // map for the dof type
             Matrix< DDSMat > mUniqueDofTypeMap;
             Matrix< DDSMat > mUniqueDvTypeMap;
@@ -179,6 +182,17 @@ namespace moris
             // enum for perturbation strategy used for FD (FA and SA)
             fem::Perturbation_Type mPerturbationStrategy = fem::Perturbation_Type::RELATIVE;
 
+            // solver request the assembly maps and requested IWG/IQI lists were built for,
+            // used to skip their re-computation if the request did not change
+            bool                              mIsInitializationCached         = false;
+            bool                              mCachedIsStaggered              = false;
+            Time_Continuity_Flag              mCachedTimeContinuityFlag       = Time_Continuity_Flag::DEFAULT;
+            bool                              mCachedIsForwardAnalysis        = true;
+            bool                              mCachedIsAdjointOffDiagonalTime = false;
+            moris::Cell< enum MSI::Dof_Type > mCachedRequestedDofTypes;
+            moris::Cell< enum MSI::Dof_Type > mCachedSecondaryDofTypes;
+            moris::Cell< std::string >        mCachedRequestedIQINames;
+
             friend class MSI::Equation_Object;
             friend class Cluster;
             friend class Element_Bulk;
@@ -191,12 +205,94 @@ namespace moris
             friend class Field_Interpolator_Manager;
             friend class Interpolation_Element;
 
+            //------------------------------------------------------------------------------
+            /**
+             * checks if the assembly maps and requested IWG/IQI lists were built for the
+             * current solver request and stores the request otherwise
+             * @param[ in ] aIsStaggered            bool true if computation of a residual
+             * @param[ in ] aTimeContinuityOnlyFlag bool true if only time continuity IWGs should be considered
+             * @param[ out ] bool true if the cached maps and lists can be reused
+             */
+            bool check_and_update_initialization_cache(
+                    const bool                 aIsStaggered,
+                    const Time_Continuity_Flag aTimeContinuityOnlyFlag );
+
+            //------------------------------------------------------------------------------
+
             void gather_requested_IQIs(
                     moris::Cell< std::string > const &     aNames,
                     moris::Cell< std::shared_ptr< IQI > >& aListOfRequestedIQIs,
                     moris::Cell< moris_index >&            aListOfIQIGlobalIndices );
 
             //------------------------------------------------------------------------------
+            /**
+             * get the FEM workspace of the calling thread
+             * @param[ out ] aWorkspace FEM workspace used by the calling thread
+             */
+            Set_Workspace&
+            get_fem_workspace()
+            {
+                uint tWorkspaceIndex = MSI::get_workspace_index();
+
+                // the first thread works on the set itself
+                if ( tWorkspaceIndex == 0 )
+                {
+                    return *this;
+                }
+
+                MORIS_ERROR( tWorkspaceIndex <= mFemWorkspaces.size(),
+                        "fem::Set::get_fem_workspace - no workspace created for thread %i.",
+                        tWorkspaceIndex );
+
+                return *mFemWorkspaces( tWorkspaceIndex - 1 );
+            }
+
+            //------------------------------------------------------------------------------
+            /**
+             * create the field interpolator managers of a workspace
+             * @param[ in ] aModelSolverInterface model solver interface
+             * @param[ in ] aWorkspace            workspace to create the managers for
+             */
+            void create_field_interpolator_managers(
+                    MSI::Model_Solver_Interface* aModelSolverInterface,
+                    Set_Workspace&               aWorkspace );
+
+            //------------------------------------------------------------------------------
+            /**
+             * delete the field interpolator managers of a workspace
+             * @param[ in ] aWorkspace workspace to delete the managers of
+             */
+            void delete_field_interpolator_managers( Set_Workspace& aWorkspace );
+
+            //------------------------------------------------------------------------------
+            /**
+             * set the field interpolator managers of a workspace to its IWGs
+             * @param[ in ] aWorkspace workspace to set the managers for
+             */
+            void set_IWG_field_interpolator_managers( Set_Workspace& aWorkspace );
+
+            //------------------------------------------------------------------------------
+            /**
+             * set the field interpolator managers of a workspace to its IQIs
+             * @param[ in ] aWorkspace workspace to set the managers for
+             */
+            void set_IQI_field_interpolator_managers( Set_Workspace& aWorkspace );
+
+            //------------------------------------------------------------------------------
+            /**
+             * fill the requested IWG and IQI lists of a further thread's workspace
+             * with the replicas of the IWGs and IQIs requested on the set
+             * @param[ in ] aWorkspace workspace of a further thread
+             */
+            void update_requested_lists( Set_Workspace& aWorkspace );
+
+            //------------------------------------------------------------------------------
+            /**
+             * delete the workspaces of the further threads
+             */
+            void delete_workspaces();
+
+            //------------------------------------------------------------------------------
 
           public:
             //------------------------------------------------------------------------------
@@ -397,6 +493,18 @@ namespace moris
                 return mIsAnalyticalSA;
             }
 
+            //------------------------------------------------------------------------------
+            /**
+             * get the arena for temporaries of the element evaluation
+             * memory obtained from it is released when the next equation object is evaluated
+             * @param[ out ] mArena arena allocator
+             */
+            Arena_Allocator&
+            get_arena()
+            {
+                return this->get_fem_workspace().mArena;
+            }
+
             //------------------------------------------------------------------------------
             /**
              * set FD scheme enum for sensitivity analysis on the set
@@ -520,6 +628,24 @@ namespace moris
              */
             void create_field_interpolator_managers( MSI::Model_Solver_Interface* aModelSolverInterface );
 
+            //------------------------------------------------------------------------------
+            /**
+             * create one FEM workspace per worker thread in addition to the workspaces of
+             * the equation set. The IWGs and IQIs of further threads are replicas created
+             * by the FEM model.
+             * @param[ in ] aNumWorkspaces number of workspaces, including the one of the first thread
+             */
+            void create_workspaces( const uint aNumWorkspaces ) override;
+
+            //------------------------------------------------------------------------------
+            /**
+             * returns if equation objects of this set can be evaluated concurrently.
+             * Requires the FEM model to replicate the IWGs and IQIs of the set. Sets
+             * using fields are evaluated serially, since fields compute their nodal
+             * values on first access.
+             */
+            bool supports_concurrent_evaluation() override;
+
             //------------------------------------------------------------------------------
             /**
              * get IWGs
@@ -528,7 +654,7 @@ namespace moris
             moris::Cell< std::shared_ptr< IWG > >&
             get_IWGs()
             {
-                return mIWGs;
+                return this->get_fem_workspace().mIWGs;
             }
 
             //------------------------------------------------------------------------------
@@ -538,7 +664,7 @@ namespace moris
             uint
             get_number_of_IWGs()
             {
-                return mIWGs.size();
+                return this->get_fem_workspace().mIWGs.size();
             }
 
             //------------------------------------------------------------------------------
@@ -549,7 +675,7 @@ namespace moris
             const moris::Cell< std::shared_ptr< IWG > >&
             get_requested_IWGs()
             {
-                return mRequestedIWGs;
+                return this->get_fem_workspace().mRequestedIWGs;
             }
 
             //------------------------------------------------------------------------------
@@ -559,7 +685,7 @@ namespace moris
             uint
             get_number_of_requested_IWGs()
             {
-                return mRequestedIWGs.size();
+                return this->get_fem_workspace().mRequestedIWGs.size();
             }
 
             //------------------------------------------------------------------------------
@@ -588,7 +714,7 @@ namespace moris
             const moris::Cell< std::shared_ptr< IQI > >&
             get_requested_IQIs()
             {
-                return mRequestedIQIs;
+                return this->get_fem_workspace().mRequestedIQIs;
             }
 
             //------------------------------------------------------------------------------
@@ -599,7 +725,7 @@ namespace moris
             uint
             get_number_of_requested_IQIs()
             {
-                return mRequestedIQIs.size();
+                return this->get_fem_workspace().mRequestedIQIs.size();
             }
 
             //------------------------------------------------------------------------------
@@ -784,6 +910,40 @@ namespace moris
                 return mIntegWeights;
             }
 
+            //------------------------------------------------------------------------------
+            /**
+             * get the space shape functions of an interpolation rule tabulated at the
+             * integration points, shared by all field interpolators of the set
+             * @param[ in ]  aInterpolationRule field interpolation rule
+             * @param[ out ] table, nullptr if the integration points are not tabulated
+             */
+            std::shared_ptr< const Shape_Function_Table > get_space_shape_function_table(
+                    const mtk::Interpolation_Rule& aInterpolationRule );
+
+            //------------------------------------------------------------------------------
+            /**
+             * get the time shape functions of an interpolation rule tabulated at the
+             * integration points, shared by all field interpolators of the set
+             * @param[ in ]  aInterpolationRule field interpolation rule
+             * @param[ out ] table, nullptr if the integration points are not tabulated
+             */
+            std::shared_ptr< const Shape_Function_Table > get_time_shape_function_table(
+                    const mtk::Interpolation_Rule& aInterpolationRule );
+
+            //------------------------------------------------------------------------------
+            /**
+             * check if the integration points are also the evaluation points in the IP
+             * element for elements which coincide with their IP element, i.e. for bulk sets
+             * where the IG and IP elements have the same geometry type
+             */
+            bool
+            has_tabulated_integration_points()
+            {
+                return mElementType == fem::Element_Type::BULK
+                    && mIGGeometryType == mIPGeometryType
+                    && mIntegPoints.numel() > 0;
+            }
+
             //------------------------------------------------------------------------------
             /**
              * get the field interpolator manager
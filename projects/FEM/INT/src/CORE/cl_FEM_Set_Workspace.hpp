@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_FEM_Set_Workspace.hpp
+ *
+ */
+
+#ifndef SRC_FEM_CL_FEM_SET_WORKSPACE_HPP_
+#define SRC_FEM_CL_FEM_SET_WORKSPACE_HPP_
+
+#include <memory>
+
+#include "cl_Cell.hpp"
+#include "cl_Arena_Allocator.hpp"
+
+namespace moris
+{
+    namespace fem
+    {
+        class IWG;
+        class IQI;
+        class Field_Interpolator_Manager;
+
+        //------------------------------------------------------------------------------
+        /**
+         * \brief Per-thread evaluation state of a FEM set
+         *
+         * Holds the field interpolator managers and the IWGs and IQIs, with their
+         * properties, constitutive models and stabilization parameters, that are modified
+         * while evaluating one equation object. The FEM set itself is the workspace of the
+         * first thread. Further threads use replicas of the IWGs and IQIs created by the
+         * FEM model, their own field interpolator managers and their own arena.
+         */
+        struct Set_Workspace
+        {
+            // field interpolator manager pointers
+            Field_Interpolator_Manager* mLeaderFIManager         = nullptr;
+            Field_Interpolator_Manager* mFollowerFIManager       = nullptr;
+            Field_Interpolator_Manager* mLeaderPreviousFIManager = nullptr;
+            Field_Interpolator_Manager* mLeaderEigenFIManager    = nullptr;
+
+            // cell of pointers to IWG objects
+            moris::Cell< std::shared_ptr< IWG > > mIWGs;
+            moris::Cell< std::shared_ptr< IWG > > mRequestedIWGs;
+
+            // cell of pointer to IQI objects
+            moris::Cell< std::shared_ptr< IQI > > mIQIs;
+            moris::Cell< std::shared_ptr< IQI > > mRequestedIQIs;
+
+            // arena for temporaries of the element evaluation, reset for each equation object
+            Arena_Allocator mArena;
+        };
+
+        //------------------------------------------------------------------------------
+    }    // namespace fem
+} /* namespace moris */
+
+#endif /* SRC_FEM_CL_FEM_SET_WORKSPACE_HPP_ */
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * fn_FEM_Fixed_Size_Kernels.hpp
+ *
+ */
+
+#ifndef SRC_FEM_FN_FEM_FIXED_SIZE_KERNELS_HPP_
+#define SRC_FEM_FN_FEM_FIXED_SIZE_KERNELS_HPP_
+
+#include <array>
+
+#include "typedefs.hpp"
+#include "assert.hpp"
+#include "cl_Matrix.hpp"
+#include "linalg_typedefs.hpp"
+// MTK/src
+#include "fn_MTK_Fixed_Size_Kernels.hpp"
+
+namespace moris
+{
+    namespace fem
+    {
+        //------------------------------------------------------------------------------
+        /*
+         * Element-level kernels for the strain-displacement matrix, the diffusive flux and
+         * the accumulation of element matrices. The space Jacobian, its inverse and the
+         * shape function derivatives wrt x are evaluated by the kernels of the MTK space
+         * interpolator, which are made available here as well.
+         * The kernels are specialized at compile time on the number of space dimensions D
+         * and the number of bases N of the element and work on stack allocated arrays,
+         * i.e. they do not perform any heap allocation.
+         *
+         * Matrix layouts follow the ones of the Geometry_Interpolator and Field_Interpolator:
+         * dNdXi and dNdx are ( D x N ), xHat and uHat are ( N x <number of fields> ).
+         */
+        //------------------------------------------------------------------------------
+
+        // geometric kernels shared with the space interpolator
+        using mtk::Fixed_Matrix;
+        using mtk::copy_to_fixed;
+        using mtk::copy_from_fixed;
+        using mtk::eval_space_jacobian;
+        using mtk::eval_inverse_space_jacobian;
+        using mtk::eval_dNdx;
+
+        // element types with their space dimension and number of bases
+        template< uint D, uint N >
+        struct Fixed_Element_Size
+        {
+                static const uint sSpaceDim = D;
+                static const uint sNumBases = N;
+        };
+
+        using Fixed_Quad4 = Fixed_Element_Size< 2, 4 >;
+        using Fixed_Quad9 = Fixed_Element_Size< 2, 9 >;
+        using Fixed_Tri3  = Fixed_Element_Size< 2, 3 >;
+        using Fixed_Tri6  = Fixed_Element_Size< 2, 6 >;
+        using Fixed_Hex8  = Fixed_Element_Size< 3, 8 >;
+        using Fixed_Hex27 = Fixed_Element_Size< 3, 27 >;
+        using Fixed_Tet4  = Fixed_Element_Size< 3, 4 >;
+        using Fixed_Tet10 = Fixed_Element_Size< 3, 10 >;
+
+        //------------------------------------------------------------------------------
+        /**
+         * evaluate the strain-displacement matrix in Voigt notation
+         * 2D: ( eps_xx, eps_yy, gamma_xy ), 3D: ( eps_xx, eps_yy, eps_zz, gamma_yz, gamma_xz, gamma_xy )
+         * with the displacement coefficients ordered field by field ( u_x bases, u_y bases, ... )
+         * as in the Field_Interpolator
+         * @param[ in ]  adNdx shape function derivatives wrt x ( D x N )
+         * @param[ out ] aB    strain-displacement matrix ( D*(D+1)/2 x D*N )
+         */
+        template< uint D, uint N >
+        inline void
+        eval_B_matrix(
+                const Fixed_Matrix< D, N >&                adNdx,
+                Fixed_Matrix< D * ( D + 1 ) / 2, D * N >& aB )
+        {
+            static_assert( D == 2 || D == 3, "eval_B_matrix - only implemented for 2D and 3D." );
+
+            // reset the strain-displacement matrix
+            for ( auto& tRow : aB )
+            {
+                tRow.fill( 0.0 );
+            }
+
+            for ( uint iBase = 0; iBase < N; iBase++ )
+            {
+                // normal strains
+                for ( uint iDim = 0; iDim < D; iDim++ )
+                {
+                    aB[ iDim ][ iDim * N + iBase ] = adNdx[ iDim ][ iBase ];
+                }
+
+                // shear strains
+                if ( D == 2 )
+                {
+                    aB[ 2 ][ iBase ]     = adNdx[ 1 ][ iBase ];
+                    aB[ 2 ][ N + iBase ] = adNdx[ 0 ][ iBase ];
+                }
+                else
+                {
+                    aB[ 3 ][ N + iBase ]     = adNdx[ 2 ][ iBase ];
+                    aB[ 3 ][ 2 * N + iBase ] = adNdx[ 1 ][ iBase ];
+                    aB[ 4 ][ iBase ]         = adNdx[ 2 ][ iBase ];
+                    aB[ 4 ][ 2 * N + iBase ] = adNdx[ 0 ][ iBase ];
+                    aB[ 5 ][ iBase ]         = adNdx[ 1 ][ iBase ];
+                    aB[ 5 ][ N + iBase ]     = adNdx[ 0 ][ iBase ];
+                }
+            }
+        }
+
+        //------------------------------------------------------------------------------
+        /**
+         * evaluate the diffusive flux q = k * dNdx * uHat for a scalar field
+         * @param[ in ]  aConductivity isotropic conductivity
+         * @param[ in ]  adNdx         shape function derivatives wrt x ( D x N )
+         * @param[ in ]  aUHat         field coefficients ( N x 1 )
+         * @param[ out ] aFlux         flux ( D x 1 )
+         */
+        template< uint D, uint N >
+        inline void
+        eval_diffusive_flux(
+                const real                  aConductivity,
+                const Fixed_Matrix< D, N >& adNdx,
+                const std::array< real, N >& aUHat,
+                std::array< real, D >&       aFlux )
+        {
+            for ( uint iDim = 0; iDim < D; iDim++ )
+            {
+                real tSum = 0.0;
+                for ( uint iBase = 0; iBase < N; iBase++ )
+                {
+                    tSum += adNdx[ iDim ][ iBase ] * aUHat[ iBase ];
+                }
+                aFlux[ iDim ] = aConductivity * tSum;
+            }
+        }
+
+        //------------------------------------------------------------------------------
+        /**
+         * add a weighted product trans( A ) * B to a block of a dynamic matrix,
+         * e.g. trans( testStrain ) * dFluxdDOF to the element Jacobian
+         * @param[ in ]    aWeight    weight of the product
+         * @param[ in ]    aA         left matrix ( D x N )
+         * @param[ in ]    aB         right matrix ( D x N )
+         * @param[ inout ] aMatrix    matrix the product is added to
+         * @param[ in ]    aRowOffset first row of the block in aMatrix
+         * @param[ in ]    aColOffset first column of the block in aMatrix
+         */
+        template< uint D, uint N >
+        inline void
+        add_weighted_trans_product(
+                const real              aWeight,
+                const Matrix< DDRMat >& aA,
+                const Matrix< DDRMat >& aB,
+                Matrix< DDRMat >&       aMatrix,
+                const uint              aRowOffset,
+                const uint              aColOffset )
+        {
+            MORIS_ASSERT( aRowOffset + N <= aMatrix.n_rows() && aColOffset + N <= aMatrix.n_cols(),
+                    "add_weighted_trans_product - block exceeds the matrix." );
+
+            // copy the factors into contiguous fixed size storage
+            Fixed_Matrix< D, N > tA;
+            Fixed_Matrix< D, N > tB;
+            copy_to_fixed( aA, tA );
+            copy_to_fixed( aB, tB );
+
+            for ( uint iCol = 0; iCol < N; iCol++ )
+            {
+                for ( uint iRow = 0; iRow < N; iRow++ )
+                {
+                    real tSum = 0.0;
+                    for ( uint iDim = 0; iDim < D; iDim++ )
+                    {
+                        tSum += tA[ iDim ][ iRow ] * tB[ iDim ][ iCol ];
+                    }
+                    aMatrix( aRowOffset + iRow, aColOffset + iCol ) += aWeight * tSum;
+                }
+            }
+        }
+
+        //------------------------------------------------------------------------------
+    } /* namespace fem */
+} /* namespace moris */
+
+#endif /* SRC_FEM_FN_FEM_FIXED_SIZE_KERNELS_HPP_ */
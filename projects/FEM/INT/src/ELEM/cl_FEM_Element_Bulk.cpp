@@ -132,6 +132,20 @@ namespace moris
 
         //------------------------------------------------------------------------------
 
+        sint
+        Element_Bulk::get_table_point_index( const uint aIntegPointIndex )
+        {
+            // the integration points map onto themselves only for trivial clusters
+            if ( mCluster->get_mesh_cluster()->is_trivial( mtk::Leader_Follower::LEADER ) )
+            {
+                return aIntegPointIndex;
+            }
+
+            return -1;
+        }
+
+        //------------------------------------------------------------------------------
+
         void
         Element_Bulk::compute_residual()
         {
@@ -157,7 +171,9 @@ namespace moris
                         mSet->get_integration_points().get_column( iGP );
 
                 // set evaluation point for interpolators (FIs and GIs)
-                mSet->get_field_interpolator_manager()->set_space_time_from_local_IG_point( tLocalIntegPoint );
+                mSet->get_field_interpolator_manager()->set_space_time_from_local_IG_point(
+                        tLocalIntegPoint,
+                        this->get_table_point_index( iGP ) );
 
                 // compute detJ of integration domain
                 real tDetJ = mSet->get_field_interpolator_manager()->get_IG_geometry_interpolator()->det_J();
@@ -220,7 +236,9 @@ namespace moris
                         mSet->get_integration_points().get_column( iGP );
 
                 // set evaluation point for interpolators (FIs and GIs)
-                mSet->get_field_interpolator_manager()->set_space_time_from_local_IG_point( tLocalIntegPoint );
+                mSet->get_field_interpolator_manager()->set_space_time_from_local_IG_point(
+                        tLocalIntegPoint,
+                        this->get_table_point_index( iGP ) );
 
                 // compute detJ of integration domain
                 real tDetJ = mSet->get_field_interpolator_manager()->get_IG_geometry_interpolator()->det_J();
@@ -284,7 +302,9 @@ namespace moris
                         mSet->get_integration_points().get_column( iGP );
 
                 // set evaluation point for interpolators (FIs and GIs)
-                mSet->get_field_interpolator_manager()->set_space_time_from_local_IG_point( tLocalIntegPoint );
+                mSet->get_field_interpolator_manager()->set_space_time_from_local_IG_point(
+                        tLocalIntegPoint,
+                        this->get_table_point_index( iGP ) );
 
                 // compute detJ of integration domain
                 real tDetJ = mSet->get_field_interpolator_manager()->get_IG_geometry_interpolator()->det_J();
@@ -339,6 +359,9 @@ namespace moris
                     }
                 }
 
+#ifdef MORIS_USE_OPENMP
+#pragma omp atomic
+#endif
                 mSet->mFemModel->mBulkGaussPoints++;
             }
         }
@@ -371,7 +394,9 @@ namespace moris
                         mSet->get_integration_points().get_column( iGP );
 
                 // set evaluation point for interpolators (FIs and GIs)
-                mSet->get_field_interpolator_manager()->set_space_time_from_local_IG_point( tLocalIntegPoint );
+                mSet->get_field_interpolator_manager()->set_space_time_from_local_IG_point(
+                        tLocalIntegPoint,
+                        this->get_table_point_index( iGP ) );
 
                 // compute detJ of integration domain
                 real tDetJ = mSet->get_field_interpolator_manager()->get_IG_geometry_interpolator()->det_J();
@@ -433,13 +458,17 @@ namespace moris
                         mSet->get_integration_points().get_column( iGP );
 
                 // set evaluation point for interpolators (FIs and GIs)
-                mSet->get_field_interpolator_manager()->set_space_time_from_local_IG_point( tLocalIntegPoint );
+                mSet->get_field_interpolator_manager()->set_space_time_from_local_IG_point(
+                        tLocalIntegPoint,
+                        this->get_table_point_index( iGP ) );
 
                 // if eigen vectors
                 if ( mSet->mNumEigenVectors > 0 )
                 {
                     // set evaluation point for interpolators (FIs and GIs)
-                    mSet->get_field_interpolator_manager_eigen_vectors()->set_space_time_from_local_IG_point( tLocalIntegPoint );
+                    mSet->get_field_interpolator_manager_eigen_vectors()->set_space_time_from_local_IG_point(
+                            tLocalIntegPoint,
+                            this->get_table_point_index( iGP ) );
                 }
 
                 // compute detJ of integration domain
@@ -498,7 +527,9 @@ namespace moris
                         mSet->get_integration_points().get_column( iGP );
 
                 // set evaluation point for interpolators (FIs and GIs)
-                mSet->get_field_interpolator_manager()->set_space_time_from_local_IG_point( tLocalIntegPoint );
+                mSet->get_field_interpolator_manager()->set_space_time_from_local_IG_point(
+                        tLocalIntegPoint,
+                        this->get_table_point_index( iGP ) );
 
                 // compute detJ of integration domain
                 real tDetJ = mSet->get_field_interpolator_manager()->get_IG_geometry_interpolator()->det_J();
@@ -563,8 +594,9 @@ namespace moris
                         mSet->get_integration_points().get_column( iGP );
 
                 // set evaluation point for interpolators (FIs and GIs)
-                mSet->get_field_interpolator_manager()->    //
-                        set_space_time_from_local_IG_point( tLocalIntegPoint );
+                mSet->get_field_interpolator_manager()->set_space_time_from_local_IG_point(
+                        tLocalIntegPoint,
+                        this->get_table_point_index( iGP ) );
 
                 // compute detJ of integration domain
                 real tDetJ = mSet->get_field_interpolator_manager()->get_IG_geometry_interpolator()->det_J();
@@ -641,7 +673,9 @@ namespace moris
                         mSet->get_integration_points().get_column( iGP );
 
                 // set evaluation point for interpolators (FIs and GIs)
-                mSet->get_field_interpolator_manager()->set_space_time_from_local_IG_point( tLocalIntegPoint );
+                mSet->get_field_interpolator_manager()->set_space_time_from_local_IG_point(
+                        tLocalIntegPoint,
+                        this->get_table_point_index( iGP ) );
 
                 // compute detJ of integration domain
                 real tDetJ = mSet->get_field_interpolator_manager()->get_IG_geometry_interpolator()->det_J();
@@ -698,7 +732,9 @@ namespace moris
                         mSet->get_integration_points().get_column( iGP );
 
                 // set evaluation point for interpolators (FIs and GIs)
-                mSet->get_field_interpolator_manager()->set_space_time_from_local_IG_point( tLocalIntegPoint );
+                mSet->get_field_interpolator_manager()->set_space_time_from_local_IG_point(
+                        tLocalIntegPoint,
+                        this->get_table_point_index( iGP ) );
 
                 // compute detJ of integration domain
                 real tDetJ = mSet->get_field_interpolator_manager()->get_IG_geometry_interpolator()->det_J();
@@ -792,7 +828,9 @@ namespace moris
                         mSet->get_integration_points().get_column( iGP );
 
                 // set evaluation point for interpolators (FIs and GIs)
-                mSet->get_field_interpolator_manager()->set_space_time_from_local_IG_point( tLocalIntegPoint );
+                mSet->get_field_interpolator_manager()->set_space_time_from_local_IG_point(
+                        tLocalIntegPoint,
+                        this->get_table_point_index( iGP ) );
 
                 // compute detJ of integration domain
                 real tDetJ = mSet->get_field_interpolator_manager()->get_IG_geometry_interpolator()->det_J();
@@ -872,7 +910,9 @@ namespace moris
                         mSet->get_integration_points().get_column( iGP );
 
                 // set evaluation point for interpolators (FIs and GIs)
-                mSet->get_field_interpolator_manager()->set_space_time_from_local_IG_point( tLocalIntegPoint );
+                mSet->get_field_interpolator_manager()->set_space_time_from_local_IG_point(
+                        tLocalIntegPoint,
+                        this->get_table_point_index( iGP ) );
 
                 // compute detJ of integration domain
                 real tDetJ = mSet->get_field_interpolator_manager()->get_IG_geometry_interpolator()->det_J();
@@ -154,6 +154,16 @@ namespace moris
              * using the mesh only
              */
             void init_ig_geometry_interpolator();
+
+            //------------------------------------------------------------------------------
+            /**
+             * get the index of an integration point in the shape function tables of the set.
+             * Only elements which coincide with their IP element, i.e. of trivial clusters,
+             * evaluate the field interpolators at the tabulated integration points.
+             * @param[ in ] aIntegPointIndex integration point index
+             * @param[ out ] table point index, -1 if the point is not tabulated
+             */
+            sint get_table_point_index( const uint aIntegPointIndex );
         };
 
         //------------------------------------------------------------------------------
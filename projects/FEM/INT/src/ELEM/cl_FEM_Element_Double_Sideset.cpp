@@ -459,6 +459,9 @@ namespace moris
                     ( this->*m_compute_jacobian )( tReqIWG, tWStar );
                 }
 
+#ifdef MORIS_USE_OPENMP
+#pragma omp atomic
+#endif
                 mSet->mFemModel->mDoubleSidedSideSetsGaussPoints++;
             }
         }
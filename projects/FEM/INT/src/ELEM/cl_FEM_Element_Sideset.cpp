@@ -351,6 +351,9 @@ namespace moris
                     }
                 }
 
+#ifdef MORIS_USE_OPENMP
+#pragma omp atomic
+#endif
                 mSet->mFemModel->mSideSetsGaussPoints++;
             }
         }
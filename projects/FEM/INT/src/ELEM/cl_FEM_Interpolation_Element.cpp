@@ -124,6 +124,9 @@ namespace moris
         void
         Interpolation_Element::set_field_interpolators_coefficients()
         {
+            // release the temporaries of the previously evaluated equation object
+            mSet->get_arena().reset();
+
             // dof field interpolators------------------------------------------
 
             // get leader dof type list from set
@@ -141,7 +144,7 @@ namespace moris
 
                 // get the pdof values for the ith dof type group
                 Cell< Cell< Matrix< DDRMat > > > tCoeff_Original;
-                this->get_my_pdof_values( mSet->mPdofValues, tDofTypeGroup, tCoeff_Original );
+                this->get_my_pdof_values( mSet->get_workspace().mPdofValues, tDofTypeGroup, tCoeff_Original );
 
                 // reshape tCoeffs into the order the cluster expects them
                 Matrix< DDRMat > tCoeff;
@@ -155,7 +158,7 @@ namespace moris
                 {
                     // get the pdof values for the ith dof type group
                     Cell< Cell< Matrix< DDRMat > > > tCoeff_Original;
-                    this->get_my_pdof_values( mSet->mPreviousPdofValues, tDofTypeGroup, tCoeff_Original );
+                    this->get_my_pdof_values( mSet->get_workspace().mPreviousPdofValues, tDofTypeGroup, tCoeff_Original );
 
                     // reshape tCoeffs into the order the cluster expects them
                     Matrix< DDRMat > tCoeff;
@@ -166,11 +169,11 @@ namespace moris
                 }
 
                 // if eigen vectors
-                if ( mSet->mEigenVectorPdofValues.size() > 0 )
+                if ( mSet->get_workspace().mEigenVectorPdofValues.size() > 0 )
                 {
                     // get the pdof values for the ith dof type group
                     Cell< Cell< Matrix< DDRMat > > > tCoeff_Original;
-                    this->get_my_pdof_values( mSet->mEigenVectorPdofValues, tDofTypeGroup, tCoeff_Original );
+                    this->get_my_pdof_values( mSet->get_workspace().mEigenVectorPdofValues, tDofTypeGroup, tCoeff_Original );
 
                     // check for consistency of number of eigen vectors
                     MORIS_ASSERT( tCoeff_Original.size() == mSet->mNumEigenVectors,
@@ -204,7 +207,7 @@ namespace moris
 
                 // get the pdof values for the ith dof type group
                 Cell< Cell< Matrix< DDRMat > > > tCoeff_Original;
-                this->get_my_pdof_values( mSet->mPdofValues, tDofTypeGroup, tCoeff_Original, mtk::Leader_Follower::FOLLOWER );
+                this->get_my_pdof_values( mSet->get_workspace().mPdofValues, tDofTypeGroup, tCoeff_Original, mtk::Leader_Follower::FOLLOWER );
 
                 // reshape tCoeffs into the order the cluster expects them
                 Matrix< DDRMat > tCoeff;
@@ -346,7 +349,7 @@ namespace moris
             }
 
             // if eigen vectors
-            if ( mSet->mEigenVectorPdofValues.size() > 0 )
+            if ( mSet->get_workspace().mEigenVectorPdofValues.size() > 0 )
             {
                 // set the IP geometry interpolator physical space and time coefficients for eigen vectors
                 mSet->get_field_interpolator_manager_eigen_vectors( mtk::Leader_Follower::LEADER )->get_IP_geometry_interpolator()->set_space_coeff( mLeaderInterpolationCell->get_vertex_coords() );
@@ -677,13 +680,13 @@ namespace moris
             if ( tLocalToGlobalIdsIPPdv.numel() != 0 )
             {
                 // loop over the IP pdv
-                uint tNumIQIs = mSet->mdQIdp( 0 ).size();
+                uint tNumIQIs = mSet->get_dqidp()( 0 ).size();
                 for ( uint Ik = 0; Ik < tNumIQIs; Ik++ )
                 {
                     // assemble explicit dQIdpMat into multivector
                     mEquationSet->get_equation_model()->get_explicit_dQidp()->sum_into_global_values(
                             tLocalToGlobalIdsIPPdv,
-                            mSet->mdQIdp( 0 )( Ik ),
+                            mSet->get_dqidp()( 0 )( Ik ),
                             Ik );
                 }
             }
@@ -694,13 +697,13 @@ namespace moris
             if ( tLocalToGlobalIdsIGPdv.numel() != 0 )
             {
                 // loop over the IG pdv
-                uint tNumIQIs = mSet->mdQIdp( 1 ).size();
+                uint tNumIQIs = mSet->get_dqidp()( 1 ).size();
                 for ( uint Ik = 0; Ik < tNumIQIs; Ik++ )
                 {
                     // assemble explicit dQIdpGeo into multivector
                     mEquationSet->get_equation_model()->get_explicit_dQidp()->sum_into_global_values(
                             tLocalToGlobalIdsIGPdv,
-                            mSet->mdQIdp( 1 )( Ik ),
+                            mSet->get_dqidp()( 1 )( Ik ),
                             Ik );
                 }
             }
@@ -785,7 +788,7 @@ namespace moris
             this->compute_my_adjoint_values();
 
             // get number of RHS
-            uint tNumRHS = mSet->mAdjointPdofValues.size();
+            uint tNumRHS = mSet->get_workspace().mAdjointPdofValues.size();
 
             // get number of pdof values
             uint tNumPdofValues = tdRdp( 0 ).n_rows();
@@ -819,7 +822,7 @@ namespace moris
                     // get the adjoint values for the ith dof type group
                     Cell< Cell< Matrix< DDRMat > > > tLeaderAdjointOriginal;
                     this->get_my_pdof_values(
-                            mSet->mAdjointPdofValues,
+                            mSet->get_workspace().mAdjointPdofValues,
                             tLeaderDofTypeGroup( Ia ),
                             tLeaderAdjointOriginal,
                             mtk::Leader_Follower::LEADER );
@@ -844,7 +847,7 @@ namespace moris
                     // get the adjoint values for the ith dof type group
                     Cell< Cell< Matrix< DDRMat > > > tFollowerAdjointOriginal;
                     this->get_my_pdof_values(
-                            mSet->mAdjointPdofValues,
+                            mSet->get_workspace().mAdjointPdofValues,
                             tFollowerDofTypeGroup( Ia ),
                             tFollowerAdjointOriginal,
                             mtk::Leader_Follower::FOLLOWER );
@@ -871,7 +874,7 @@ namespace moris
                     // assemble explicit dQIdpMat into multivector
                     mEquationSet->get_equation_model()->get_explicit_dQidp()->sum_into_global_values(
                             tLocalToGlobalIdsIPPdv,
-                            mSet->mdQIdp( 0 )( Ik ),
+                            mSet->get_dqidp()( 0 )( Ik ),
                             Ik );
 
                     // post multiplication of adjoint values time dRdp
@@ -893,7 +896,7 @@ namespace moris
                     // assemble explicit dQIdpGeo into multivector
                     mEquationSet->get_equation_model()->get_explicit_dQidp()->sum_into_global_values(
                             tLocalToGlobalIdsIGPdv,
-                            mSet->mdQIdp( 1 )( Ik ),
+                            mSet->get_dqidp()( 1 )( Ik ),
                             Ik );
 
                     // post multiplication of adjoint values time dRdp
@@ -973,7 +976,7 @@ namespace moris
             this->compute_my_adjoint_values();
 
             // get number of  RHS
-            uint tNumRHS = mSet->mAdjointPdofValues.size();
+            uint tNumRHS = mSet->get_workspace().mAdjointPdofValues.size();
 
             // get number of pdof values
             uint tNumPdofValues = tdRdp( 0 ).n_rows();
@@ -1007,7 +1010,7 @@ namespace moris
                     // get the adjoint values for the ith dof type group
                     Cell< Cell< Matrix< DDRMat > > > tLeaderAdjointOriginal;
                     this->get_my_pdof_values(
-                            mSet->mAdjointPdofValues,
+                            mSet->get_workspace().mAdjointPdofValues,
                             tLeaderDofTypeGroup( Ia ),
                             tLeaderAdjointOriginal,
                             mtk::Leader_Follower::LEADER );
@@ -1032,7 +1035,7 @@ namespace moris
                     // get the adjoint values for the ith dof type group
                     Cell< Cell< Matrix< DDRMat > > > tFollowerAdjointOriginal;
                     this->get_my_pdof_values(
-                            mSet->mAdjointPdofValues,
+                            mSet->get_workspace().mAdjointPdofValues,
                             tFollowerDofTypeGroup( Ia ),
                             tFollowerAdjointOriginal,
                             mtk::Leader_Follower::FOLLOWER );
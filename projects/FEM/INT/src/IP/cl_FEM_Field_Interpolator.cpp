@@ -24,6 +24,7 @@
 #include "op_greater_equal.hpp"
 
 #include "cl_FEM_Field_Interpolator.hpp"    //FEM/INT/src
+#include "fn_FEM_Fixed_Size_Kernels.hpp"    //FEM/INT/src
 #include "cl_MTK_Enums.hpp"                 //MTK/src
 
 #include <iostream>
@@ -183,6 +184,9 @@ namespace moris
         void
         Field_Interpolator::reset_eval_flags()
         {
+            // invalidate evaluations cached on the previous state
+            mEvaluationState++;
+
             // reset bool for evaluation
             mNEval           = true;
             mNTransEval      = true;
@@ -214,6 +218,9 @@ namespace moris
         void
         Field_Interpolator::reset_eval_flags_coefficients()
         {
+            // invalidate evaluations cached on the previous state
+            mEvaluationState++;
+
             // reset bool for evaluation
             mValEval      = true;
             mValTransEval = true;
@@ -240,7 +247,23 @@ namespace moris
         //------------------------------------------------------------------------------
 
         void
-        Field_Interpolator::set_space_time( const Matrix< DDRMat >& aParamPoint )
+        Field_Interpolator::set_shape_function_tables(
+                const std::shared_ptr< const Shape_Function_Table >& aSpaceTable,
+                const std::shared_ptr< const Shape_Function_Table >& aTimeTable )
+        {
+            mSpaceTable = aSpaceTable;
+            mTimeTable  = aTimeTable;
+
+            // the current point may not be tabulated in the new tables
+            mTablePointIndex = -1;
+        }
+
+        //------------------------------------------------------------------------------
+
+        void
+        Field_Interpolator::set_space_time(
+                const Matrix< DDRMat >& aParamPoint,
+                const sint              aTablePointIndex )
         {
             // check input size aParamPoint
             MORIS_ASSERT( ( ( aParamPoint.n_cols() == 1 ) && ( aParamPoint.n_rows() == mNSpaceParamDim + mNTimeDim ) ),
@@ -282,6 +305,15 @@ namespace moris
             mXi  = aParamPoint( { 0, mNSpaceParamDim - 1 }, { 0, 0 } );
             mTau = aParamPoint( mNSpaceParamDim );
 
+            // use the tabulated shape functions only if both tables are available
+            mTablePointIndex = ( mSpaceTable != nullptr && mTimeTable != nullptr ) ? aTablePointIndex : -1;
+
+            // check that the evaluation point is the tabulated integration point
+            MORIS_ASSERT( mTablePointIndex < 0 ||
+                                  ( norm( mSpaceTable->get_point( mTablePointIndex ) - mXi ) < mEpsilon &&
+                                          norm( mTimeTable->get_point( mTablePointIndex ) - mTau ) < mEpsilon ),
+                    "Field_Interpolator::set_space_time - evaluation point is not the tabulated integration point." );
+
             // reset bool for evaluation
             this->reset_eval_flags();
             this->reset_eval_flags_coefficients();
@@ -334,15 +366,26 @@ namespace moris
             MORIS_ASSERT( mTau.numel() > 0,
                     "Field_Interpolator::eval_NBuild - mTau is not set." );
 
-            // evaluate space and time SF at Xi, Tau
-            Matrix< DDRMat > tNSpace;
-            Matrix< DDRMat > tNTime;
+            // get space and time SF at Xi, Tau
+            Matrix< DDRMat >        tNSpaceEval;
+            Matrix< DDRMat >        tNTimeEval;
+            const Matrix< DDRMat >& tNSpace = this->get_space_N( tNSpaceEval );
+            const Matrix< DDRMat >& tNTime  = this->get_time_N( tNTimeEval );
 
-            mSpaceInterpolation->eval_N( mXi, tNSpace );
-            mTimeInterpolation->eval_N( mTau, tNTime );
+            // set size of the space time SF row vector if needed
+            if ( mNBuild.n_rows() != 1 || mNBuild.n_cols() != mNFieldBases )
+            {
+                mNBuild.set_size( 1, mNFieldBases );
+            }
 
-            // evaluate space time SF by multiplying space and time SF and create row vector
-            mNBuild = trans( vectorize( trans( tNSpace ) * tNTime ) );
+            // evaluate space time SF by multiplying space and time SF, space bases first
+            for ( uint Ik = 0; Ik < mNTimeBases; Ik++ )
+            {
+                for ( uint Ii = 0; Ii < mNSpaceBases; Ii++ )
+                {
+                    mNBuild( Ik * mNSpaceBases + Ii ) = tNSpace( Ii ) * tNTime( Ik );
+                }
+            }
         }
 
         //------------------------------------------------------------------------------
@@ -468,20 +511,48 @@ namespace moris
             MORIS_ASSERT( mTau.numel() > 0,
                     "Field_Interpolator::eval_d1Ndx1 - mTau is not set." );
 
-            // evaluate dNSpacedXi for the space interpolation
-            Matrix< DDRMat > tdNSpacedXi;
-            mSpaceInterpolation->eval_dNdXi( mXi, tdNSpacedXi );
+            // get dNSpacedXi for the space interpolation
+            Matrix< DDRMat >        tdNSpacedXiEval;
+            const Matrix< DDRMat >& tdNSpacedXi = this->get_space_dNdXi( tdNSpacedXiEval );
 
             // evaluate the space Jacobian from the geometry interpolator
             const Matrix< DDRMat >& tInvJGeot = mGeometryInterpolator->inverse_space_jacobian();
 
+            // get NTime for the time interpolation
+            Matrix< DDRMat >        tNTimeEval;
+            const Matrix< DDRMat >& tNTime = this->get_time_N( tNTimeEval );
+
+            // use fixed size storage for linear and quadratic quad and hex space interpolation
+            bool tIsSquare = tInvJGeot.n_rows() == mNSpaceDim && tInvJGeot.n_cols() == mNSpaceDim
+                          && tdNSpacedXi.n_rows() == mNSpaceDim;
+
+            if ( tIsSquare && mNSpaceDim == 3 && mNSpaceBases == 8 )
+            {
+                this->eval_d1Ndx1_fixed< 3, 8 >( tdNSpacedXi, tInvJGeot, tNTime );
+                return;
+            }
+
+            if ( tIsSquare && mNSpaceDim == 3 && mNSpaceBases == 27 )
+            {
+                this->eval_d1Ndx1_fixed< 3, 27 >( tdNSpacedXi, tInvJGeot, tNTime );
+                return;
+            }
+
+            if ( tIsSquare && mNSpaceDim == 2 && mNSpaceBases == 4 )
+            {
+                this->eval_d1Ndx1_fixed< 2, 4 >( tdNSpacedXi, tInvJGeot, tNTime );
+                return;
+            }
+
+            if ( tIsSquare && mNSpaceDim == 2 && mNSpaceBases == 9 )
+            {
+                this->eval_d1Ndx1_fixed< 2, 9 >( tdNSpacedXi, tInvJGeot, tNTime );
+                return;
+            }
+
             // compute first derivative of the space shape function wrt x
             auto tdNSpacedX = tInvJGeot * tdNSpacedXi;
 
-            // evaluate NTime for the time interpolation
-            Matrix< DDRMat > tNTime;
-            mTimeInterpolation->eval_N( mTau, tNTime );
-
             // build the space time dNFielddXi row by row
             for ( moris::uint Ik = 0; Ik < mNTimeBases; Ik++ )
             {
@@ -494,6 +565,38 @@ namespace moris
 
         //------------------------------------------------------------------------------
 
+        template< uint D, uint N >
+        void
+        Field_Interpolator::eval_d1Ndx1_fixed(
+                const Matrix< DDRMat >& adNSpacedXi,
+                const Matrix< DDRMat >& aInvJGeot,
+                const Matrix< DDRMat >& aNTime )
+        {
+            // copy inverse Jacobian and dNSpacedXi into fixed size storage
+            Fixed_Matrix< D, D > tInvJ;
+            Fixed_Matrix< D, N > tdNSpacedXi;
+            copy_to_fixed( aInvJGeot, tInvJ );
+            copy_to_fixed( adNSpacedXi, tdNSpacedXi );
+
+            // compute first derivative of the space shape function wrt x
+            Fixed_Matrix< D, N > tdNSpacedX;
+            eval_dNdx( tInvJ, tdNSpacedXi, tdNSpacedX );
+
+            // build the space time dNFielddXi block by block
+            for ( uint Ik = 0; Ik < mNTimeBases; Ik++ )
+            {
+                for ( uint iDim = 0; iDim < D; iDim++ )
+                {
+                    for ( uint Ii = 0; Ii < N; Ii++ )
+                    {
+                        mdNdx( iDim, Ik * N + Ii ) = tdNSpacedX[ iDim ][ Ii ] * aNTime( Ik );
+                    }
+                }
+            }
+        }
+
+        //------------------------------------------------------------------------------
+
         void
         Field_Interpolator::eval_d2Ndx2()
         {
@@ -519,9 +622,9 @@ namespace moris
             Matrix< DDRMat > td2NSpacedxi2;
             mSpaceInterpolation->eval_d2NdXi2( mXi, td2NSpacedxi2 );
 
-            // evaluate NTime for the time interpolation
-            Matrix< DDRMat > tNTime;
-            mTimeInterpolation->eval_N( mTau, tNTime );
+            // get NTime for the time interpolation
+            Matrix< DDRMat >        tNTimeEval;
+            const Matrix< DDRMat >& tNTime = this->get_time_N( tNTimeEval );
 
             // set size d2NFielddxi2 for the field
             uint             tNumRows = td2NSpacedxi2.n_rows();
@@ -568,9 +671,9 @@ namespace moris
             const Matrix< DDRMat >& tdNFielddx   = this->dnNdxn( 1 );
             const Matrix< DDRMat >& td2NFielddx2 = this->dnNdxn( 2 );
 
-            // evaluate N for the field time interpolation
-            Matrix< DDRMat > tNTime;
-            mTimeInterpolation->eval_N( mTau, tNTime );
+            // get N for the field time interpolation
+            Matrix< DDRMat >        tNTimeEval;
+            const Matrix< DDRMat >& tNTime = this->get_time_N( tNTimeEval );
 
             // evaluate derivatives of the field space interpolation
             Matrix< DDRMat > td3NSpacedxi3;
@@ -649,9 +752,9 @@ namespace moris
             MORIS_ASSERT( mTau.numel() > 0,
                     "Field_Interpolator::eval_d1Ndt1 - mTau is not set." );
 
-            // evaluate dNTimedtau for the time interpolation
-            Matrix< DDRMat > tdNTimedtau;
-            mTimeInterpolation->eval_dNdXi( mTau, tdNTimedtau );
+            // get dNTimedtau for the time interpolation
+            Matrix< DDRMat >        tdNTimedtauEval;
+            const Matrix< DDRMat >& tdNTimedtau = this->get_time_dNdTau( tdNTimedtauEval );
 
             // evaluate the Jacobian from the time geometry interpolator
             const Matrix< DDRMat >& tInvJGeot = mGeometryInterpolator->inverse_time_jacobian();
@@ -659,9 +762,9 @@ namespace moris
             // evaluate dNTimedt
             const Matrix< DDRMat > tdNTimedt = tInvJGeot * tdNTimedtau;
 
-            // evaluate N for the field space interpolation
-            Matrix< DDRMat > tNSpace;
-            mSpaceInterpolation->eval_N( mXi, tNSpace );
+            // get N for the field space interpolation
+            Matrix< DDRMat >        tNSpaceEval;
+            const Matrix< DDRMat >& tNSpace = this->get_space_N( tNSpaceEval );
 
             // build the space time dNdTau row by row
             for ( moris::uint Ik = 0; Ik < mNTimeBases; Ik++ )
@@ -697,8 +800,8 @@ namespace moris
             Matrix< DDRMat > tdNFielddt = this->dnNdtn( 1 );
 
             // get space SF from the space interpolation
-            Matrix< DDRMat > tNSpace;
-            mSpaceInterpolation->eval_N( mXi, tNSpace );
+            Matrix< DDRMat >        tNSpaceEval;
+            const Matrix< DDRMat >& tNSpace = this->get_space_N( tNSpaceEval );
 
             // get d2Ndtau2 for the time interpolation
             Matrix< DDRMat > td2NTimedtau2;
@@ -751,9 +854,9 @@ namespace moris
             MORIS_ASSERT( mTau.numel() > 0,
                     "Field_Interpolator::eval_d2Ndxt - mTau is not set." );
 
-            // evaluate dNdTau for the field time interpolation
-            Matrix< DDRMat > tdNTimedTau;
-            mTimeInterpolation->eval_dNdXi( mTau, tdNTimedTau );
+            // get dNdTau for the field time interpolation
+            Matrix< DDRMat >        tdNTimedTauEval;
+            const Matrix< DDRMat >& tdNTimedTau = this->get_time_dNdTau( tdNTimedTauEval );
 
             // evaluate the time Jacobian from the geometry interpolator
             const Matrix< DDRMat >& tJGeoTimet = mGeometryInterpolator->time_jacobian();
@@ -761,9 +864,9 @@ namespace moris
             // compute first derivative of the space shape function wrt x
             Matrix< DDRMat > tdNTimedT = tdNTimedTau / tJGeoTimet( 0 );
 
-            // evaluate dNSpacedXi for the field space interpolation
-            Matrix< DDRMat > tdNSpacedXi;
-            mSpaceInterpolation->eval_dNdXi( mXi, tdNSpacedXi );
+            // get dNSpacedXi for the field space interpolation
+            Matrix< DDRMat >        tdNSpacedXiEval;
+            const Matrix< DDRMat >& tdNSpacedXi = this->get_space_dNdXi( tdNSpacedXiEval );
 
             // evaluate the space Jacobian from the geometry interpolator
             const Matrix< DDRMat >& tInvJGeoSpacet = mGeometryInterpolator->inverse_space_jacobian();
@@ -1066,6 +1169,74 @@ namespace moris
 
         //------------------------------------------------------------------------------
 
+        const Matrix< DDRMat >&
+        Field_Interpolator::get_space_N( Matrix< DDRMat >& aNSpace ) const
+        {
+            // read the shape functions from the table if the point is tabulated
+            if ( mTablePointIndex >= 0 )
+            {
+                return mSpaceTable->N( mTablePointIndex );
+            }
+
+            // otherwise evaluate them at Xi
+            mSpaceInterpolation->eval_N( mXi, aNSpace );
+
+            return aNSpace;
+        }
+
+        //------------------------------------------------------------------------------
+
+        const Matrix< DDRMat >&
+        Field_Interpolator::get_space_dNdXi( Matrix< DDRMat >& adNSpacedXi ) const
+        {
+            // read the derivatives from the table if the point is tabulated
+            if ( mTablePointIndex >= 0 )
+            {
+                return mSpaceTable->dNdXi( mTablePointIndex );
+            }
+
+            // otherwise evaluate them at Xi
+            mSpaceInterpolation->eval_dNdXi( mXi, adNSpacedXi );
+
+            return adNSpacedXi;
+        }
+
+        //------------------------------------------------------------------------------
+
+        const Matrix< DDRMat >&
+        Field_Interpolator::get_time_N( Matrix< DDRMat >& aNTime ) const
+        {
+            // read the shape functions from the table if the point is tabulated
+            if ( mTablePointIndex >= 0 )
+            {
+                return mTimeTable->N( mTablePointIndex );
+            }
+
+            // otherwise evaluate them at Tau
+            mTimeInterpolation->eval_N( mTau, aNTime );
+
+            return aNTime;
+        }
+
+        //------------------------------------------------------------------------------
+
+        const Matrix< DDRMat >&
+        Field_Interpolator::get_time_dNdTau( Matrix< DDRMat >& adNTimedTau ) const
+        {
+            // read the derivatives from the table if the point is tabulated
+            if ( mTablePointIndex >= 0 )
+            {
+                return mTimeTable->dNdXi( mTablePointIndex );
+            }
+
+            // otherwise evaluate them at Tau
+            mTimeInterpolation->eval_dNdXi( mTau, adNTimedTau );
+
+            return adNTimedTau;
+        }
+
+        //------------------------------------------------------------------------------
+
     } /* namespace fem */
 } /* namespace moris */
 
@@ -11,6 +11,8 @@
 #ifndef SRC_FEM_CL_FEM_FIELD_INTERPOLATOR_HPP_
 #define SRC_FEM_CL_FEM_FIELD_INTERPOLATOR_HPP_
 
+#include <memory>
+
 // MRS/COR/src
 #include "typedefs.hpp"
 #include "cl_Matrix.hpp"
@@ -20,6 +22,7 @@
 // FEM/INT/src
 #include "cl_MTK_Interpolation_Rule.hpp"
 #include "cl_FEM_Geometry_Interpolator.hpp"
+#include "cl_FEM_Shape_Function_Table.hpp"
 // FEM/MSI/src
 #include "cl_MSI_Dof_Type_Enums.hpp"
 // GEN/src
@@ -37,6 +40,10 @@ namespace moris
             // tolerance for check
             real mEpsilon = 1e-12;
 
+            // evaluation state, advanced whenever the coefficients or the evaluation point
+            // of this field interpolator change; used to validate cached evaluations
+            luint mEvaluationState = 0;
+
             // discretization (B-spline) mesh index the field interpolator operates on
             moris_index mDiscretizationMeshIndex = -1;
 
@@ -47,6 +54,13 @@ namespace moris
             mtk::Interpolation_Function_Base* mSpaceInterpolation = nullptr;
             mtk::Interpolation_Function_Base* mTimeInterpolation  = nullptr;
 
+            // space and time shape functions tabulated at the integration points, shared within the set
+            std::shared_ptr< const Shape_Function_Table > mSpaceTable = nullptr;
+            std::shared_ptr< const Shape_Function_Table > mTimeTable  = nullptr;
+
+            // integration point index of the evaluation point in the tables, -1 if not tabulated
+            sint mTablePointIndex = -1;
+
             // space and time geometry interpolator
             Geometry_Interpolator* mGeometryInterpolator = nullptr;
 
@@ -204,6 +218,18 @@ namespace moris
              */
             ~Field_Interpolator();
 
+            //------------------------------------------------------------------------------
+            /**
+             * get the evaluation state. Quantities evaluated from this field interpolator
+             * are still valid as long as this value has not changed.
+             * @param[ out ] mEvaluationState evaluation state
+             */
+            luint
+            get_evaluation_state() const
+            {
+                return mEvaluationState;
+            }
+
             //------------------------------------------------------------------------------
             /**
              * reset evaluation flags
@@ -323,12 +349,26 @@ namespace moris
 
             void set_discretization_mesh_index( const moris_index aDiscretizationMeshIndex );
 
+            //------------------------------------------------------------------------------
+            /**
+             * set the space and time shape function tables at the integration points
+             * @param[ in ] aSpaceTable space shape function table
+             * @param[ in ] aTimeTable  time shape function table
+             */
+            void set_shape_function_tables(
+                    const std::shared_ptr< const Shape_Function_Table >& aSpaceTable,
+                    const std::shared_ptr< const Shape_Function_Table >& aTimeTable );
+
             //------------------------------------------------------------------------------
             /**
              * set the parametric point where field is interpolated
-             * @param[ in ] aParamPoint evaluation point in space and time
+             * @param[ in ] aParamPoint      evaluation point in space and time
+             * @param[ in ] aTablePointIndex integration point index of aParamPoint in the
+             *                               shape function tables, -1 if not tabulated
              */
-            void set_space_time( const Matrix< DDRMat >& aParamPoint );
+            void set_space_time(
+                    const Matrix< DDRMat >& aParamPoint,
+                    const sint              aTablePointIndex = -1 );
 
             //------------------------------------------------------------------------------
             /**
@@ -550,6 +590,54 @@ namespace moris
             void eval_gradxt();
 
             //------------------------------------------------------------------------------
+
+          private:
+            //------------------------------------------------------------------------------
+            /**
+             * get the space shape functions at the evaluation point, read from the table
+             * if the point is tabulated, otherwise evaluated into the given matrix
+             * @param[ in ] aNSpace storage for the directly evaluated shape functions
+             */
+            const Matrix< DDRMat >& get_space_N( Matrix< DDRMat >& aNSpace ) const;
+
+            //------------------------------------------------------------------------------
+            /**
+             * get the first parametric derivatives of the space shape functions at the
+             * evaluation point, see get_space_N()
+             * @param[ in ] adNSpacedXi storage for the directly evaluated derivatives
+             */
+            const Matrix< DDRMat >& get_space_dNdXi( Matrix< DDRMat >& adNSpacedXi ) const;
+
+            //------------------------------------------------------------------------------
+            /**
+             * get the time shape functions at the evaluation point, see get_space_N()
+             * @param[ in ] aNTime storage for the directly evaluated shape functions
+             */
+            const Matrix< DDRMat >& get_time_N( Matrix< DDRMat >& aNTime ) const;
+
+            //------------------------------------------------------------------------------
+            /**
+             * get the first parametric derivatives of the time shape functions at the
+             * evaluation point, see get_space_N()
+             * @param[ in ] adNTimedTau storage for the directly evaluated derivatives
+             */
+            const Matrix< DDRMat >& get_time_dNdTau( Matrix< DDRMat >& adNTimedTau ) const;
+
+            //------------------------------------------------------------------------------
+            /**
+             * evaluates the first derivatives of the space time shape functions wrt x
+             * with fixed-size storage for D space dimensions and N space bases
+             * @param[ in ] adNSpacedXi space shape function derivatives wrt xi ( D x N )
+             * @param[ in ] aInvJGeot   inverse space Jacobian ( D x D )
+             * @param[ in ] aNTime      time shape functions
+             */
+            template< uint D, uint N >
+            void eval_d1Ndx1_fixed(
+                    const Matrix< DDRMat >& adNSpacedXi,
+                    const Matrix< DDRMat >& aInvJGeot,
+                    const Matrix< DDRMat >& aNTime );
+
+            //------------------------------------------------------------------------------
         };
 
         //------------------------------------------------------------------------------
@@ -168,6 +168,12 @@ namespace moris
                 // get the discretization mesh index for the DoF type
                 moris_index tMeshIndexForDof = aModelSolverInterface->get_adof_index_for_type( mDofTypes( iDof )( 0 ) );
 
+                // get the shape function tables of the set for the field interpolation rule
+                std::shared_ptr< const Shape_Function_Table > tSpaceTable =
+                        reinterpret_cast< Set* >( mEquationSet )->get_space_shape_function_table( tFieldInterpolationRule );
+                std::shared_ptr< const Shape_Function_Table > tTimeTable =
+                        reinterpret_cast< Set* >( mEquationSet )->get_time_shape_function_table( tFieldInterpolationRule );
+
                 // loop over all solution sets
                 for ( uint is = 0; is < mNumSolutionSets; ++is )
                 {
@@ -187,6 +193,9 @@ namespace moris
 
                     // discretization mesh index it in the field interpolator
                     mFI( tFiIndex )->set_discretization_mesh_index( tMeshIndexForDof );
+
+                    // share the shape function tables with the field interpolator
+                    mFI( tFiIndex )->set_shape_function_tables( tSpaceTable, tTimeTable );
                 }
             }
 
@@ -224,6 +233,11 @@ namespace moris
                         tFieldInterpolationRule,
                         mIPGeometryInterpolator,
                         mDvTypes( iDv ) );
+
+                // share the shape function tables of the set with the field interpolator
+                mDvFI( tDvIndex )->set_shape_function_tables(
+                        reinterpret_cast< Set* >( mEquationSet )->get_space_shape_function_table( tFieldInterpolationRule ),
+                        reinterpret_cast< Set* >( mEquationSet )->get_time_shape_function_table( tFieldInterpolationRule ) );
             }
 
             // field field interpolators------------------------------------------
@@ -260,6 +274,11 @@ namespace moris
                         tFieldInterpolationRule,
                         mIPGeometryInterpolator,
                         mFieldTypes( iFi ) );
+
+                // share the shape function tables of the set with the field interpolator
+                mFieldFI( tFieldIndex )->set_shape_function_tables(
+                        reinterpret_cast< Set* >( mEquationSet )->get_space_shape_function_table( tFieldInterpolationRule ),
+                        reinterpret_cast< Set* >( mEquationSet )->get_time_shape_function_table( tFieldInterpolationRule ) );
             }
         }
 
@@ -420,9 +439,49 @@ namespace moris
 
         //------------------------------------------------------------------------------
 
+        luint
+        Field_Interpolator_Manager::get_evaluation_state() const
+        {
+            // the evaluation states of the manager and its field interpolators only
+            // increase, so their sum changes whenever any of them changes
+            luint tEvaluationState = mEvaluationState;
+
+            // loop over the dof field interpolators
+            for ( const Field_Interpolator* tFI : mFI )
+            {
+                if ( tFI != nullptr )
+                {
+                    tEvaluationState += tFI->get_evaluation_state();
+                }
+            }
+
+            // loop over the dv field interpolators
+            for ( const Field_Interpolator* tFI : mDvFI )
+            {
+                if ( tFI != nullptr )
+                {
+                    tEvaluationState += tFI->get_evaluation_state();
+                }
+            }
+
+            // loop over the field field interpolators
+            for ( const Field_Interpolator* tFI : mFieldFI )
+            {
+                if ( tFI != nullptr )
+                {
+                    tEvaluationState += tFI->get_evaluation_state();
+                }
+            }
+
+            return tEvaluationState;
+        }
+
+        //------------------------------------------------------------------------------
+
         void
         Field_Interpolator_Manager::set_space_time(
-                const Matrix< DDRMat >& aParamPoint )
+                const Matrix< DDRMat >& aParamPoint,
+                const sint              aTablePointIndex )
         {
             // loop over the dof field interpolators
             for ( uint iDofFI = 0; iDofFI < mDofTypes.size(); iDofFI++ )
@@ -441,7 +500,7 @@ namespace moris
                             "Field_Interpolator_Manager::get_field_interpolators_for_type - field interpolator does not exist" );
 
                     // set the evaluation point
-                    mFI( tFiIndex )->set_space_time( aParamPoint );
+                    mFI( tFiIndex )->set_space_time( aParamPoint, aTablePointIndex );
                 }
             }
 
@@ -452,7 +511,7 @@ namespace moris
                 sint tDvIndex = mDvTypeMap( static_cast< uint >( mDvTypes( iDvFI )( 0 ) ) );
 
                 // set the evaluation point
-                mDvFI( tDvIndex )->set_space_time( aParamPoint );
+                mDvFI( tDvIndex )->set_space_time( aParamPoint, aTablePointIndex );
             }
 
             // loop over the field field interpolators
@@ -462,7 +521,7 @@ namespace moris
                 sint tFieldIndex = mFieldTypeMap( static_cast< uint >( mFieldTypes( iFieldFI )( 0 ) ) );
 
                 // set the evaluation point
-                mFieldFI( tFieldIndex )->set_space_time( aParamPoint );
+                mFieldFI( tFieldIndex )->set_space_time( aParamPoint, aTablePointIndex );
             }
 
             // IP geometry interpolator
@@ -473,7 +532,8 @@ namespace moris
 
         void
         Field_Interpolator_Manager::set_space_time_from_local_IG_point(
-                const Matrix< DDRMat >& aLocalParamPoint )
+                const Matrix< DDRMat >& aLocalParamPoint,
+                const sint              aTablePointIndex )
         {
             // set evaluation point in the IG param space for IG geometry interpolator
             mIGGeometryInterpolator->set_space_time( aLocalParamPoint );
@@ -483,7 +543,7 @@ namespace moris
                     mIGGeometryInterpolator->map_integration_point();
 
             // set evaluation point for interpolators (FIs and IP GI)
-            this->set_space_time( tGlobalParamPoint );
+            this->set_space_time( tGlobalParamPoint, aTablePointIndex );
         }
 
         //------------------------------------------------------------------------------
@@ -90,6 +90,9 @@ namespace moris
             // maximum number of mtk::field field interpolators
             moris::uint mMaxNumFieldFI;
 
+            // evaluation state not tracked by the field interpolators
+            luint mEvaluationState = 0;
+
             // pointer to geometry interpolator for IP element
             Geometry_Interpolator* mIPGeometryInterpolator = nullptr;
 
@@ -272,19 +275,47 @@ namespace moris
              */
             Field_Interpolator* get_field_interpolators_for_type( enum mtk::Field_Type aFieldType );
 
+            //------------------------------------------------------------------------------
+            /**
+             * get the evaluation state of the field interpolators on the manager.
+             * Quantities evaluated from these field interpolators are still valid
+             * as long as this value has not changed.
+             * @param[ out ] tEvaluationState evaluation state
+             */
+            luint get_evaluation_state() const;
+
+            //------------------------------------------------------------------------------
+            /**
+             * advance the evaluation state, invalidating quantities evaluated from the
+             * field interpolators on the manager, e.g. after a property changed
+             */
+            void
+            advance_evaluation_state()
+            {
+                mEvaluationState++;
+            }
+
             //------------------------------------------------------------------------------
             /**
              * set an evaluation point in space and time
-             * @param[ in ] aParamPoint coordinates of an evaluation point
+             * @param[ in ] aParamPoint      coordinates of an evaluation point
+             * @param[ in ] aTablePointIndex integration point index of aParamPoint in the
+             *                               shape function tables, -1 if not tabulated
              */
-            void set_space_time( const Matrix< DDRMat >& aParamPoint );
+            void set_space_time(
+                    const Matrix< DDRMat >& aParamPoint,
+                    const sint              aTablePointIndex = -1 );
 
             //------------------------------------------------------------------------------
             /**
              * set an evaluation point in space and time
-             * @param[ in ] aParamPoint coordinates of an evaluation point
+             * @param[ in ] aParamPoint      coordinates of an evaluation point
+             * @param[ in ] aTablePointIndex integration point index of the mapped point in
+             *                               the shape function tables, -1 if not tabulated
              */
-            void set_space_time_from_local_IG_point( const Matrix< DDRMat >& aLocalParamPoint );
+            void set_space_time_from_local_IG_point(
+                    const Matrix< DDRMat >& aLocalParamPoint,
+                    const sint              aTablePointIndex = -1 );
 
             //------------------------------------------------------------------------------
             /**
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_FEM_Shape_Function_Table.hpp
+ *
+ */
+
+#ifndef SRC_FEM_CL_FEM_SHAPE_FUNCTION_TABLE_HPP_
+#define SRC_FEM_CL_FEM_SHAPE_FUNCTION_TABLE_HPP_
+
+// MRS/COR/src
+#include "typedefs.hpp"
+#include "fn_assert.hpp"
+#include "cl_Matrix.hpp"
+#include "cl_Cell.hpp"
+// LNA/src
+#include "linalg_typedefs.hpp"
+// MTK/src
+#include "cl_MTK_Interpolation_Function_Base.hpp"
+
+namespace moris
+{
+    namespace fem
+    {
+        //------------------------------------------------------------------------------
+        /**
+         * Shape functions and their first parametric derivatives of one interpolation
+         * function, tabulated at the points of one integration rule. A table is filled
+         * on construction and only read afterwards, so it is shared by all field
+         * interpolators of a set with the same interpolation rule. Entries are looked
+         * up by integration point index.
+         */
+        class Shape_Function_Table
+        {
+            // tabulated points, one per column
+            Matrix< DDRMat > mPoints;
+
+            // shape functions and first derivatives, one entry per point
+            moris::Cell< Matrix< DDRMat > > mN;
+            moris::Cell< Matrix< DDRMat > > mdNdXi;
+
+            //------------------------------------------------------------------------------
+
+          public:
+            //------------------------------------------------------------------------------
+            /**
+             * constructor, evaluates the shape functions at all points
+             * @param[ in ] aFunction interpolation function to tabulate
+             * @param[ in ] aPoints   points ( <number of dimensions> x <number of points> )
+             */
+            Shape_Function_Table(
+                    const mtk::Interpolation_Function_Base* aFunction,
+                    const Matrix< DDRMat >&                 aPoints )
+                    : mPoints( aPoints )
+            {
+                MORIS_ASSERT( aFunction != nullptr,
+                        "Shape_Function_Table::Shape_Function_Table - interpolation function not set." );
+
+                // get number of points
+                uint tNumPoints = mPoints.n_cols();
+
+                mN.resize( tNumPoints );
+                mdNdXi.resize( tNumPoints );
+
+                // evaluate shape functions and first derivatives at each point
+                for ( uint iPoint = 0; iPoint < tNumPoints; iPoint++ )
+                {
+                    const Matrix< DDRMat > tPoint = mPoints.get_column( iPoint );
+
+                    aFunction->eval_N( tPoint, mN( iPoint ) );
+                    aFunction->eval_dNdXi( tPoint, mdNdXi( iPoint ) );
+                }
+            }
+
+            //------------------------------------------------------------------------------
+            /**
+             * trivial destructor
+             */
+            ~Shape_Function_Table(){};
+
+            //------------------------------------------------------------------------------
+            /**
+             * get the number of tabulated points
+             */
+            uint
+            get_number_of_points() const
+            {
+                return mPoints.n_cols();
+            }
+
+            //------------------------------------------------------------------------------
+            /**
+             * get a tabulated point
+             * @param[ in ] aPointIndex integration point index
+             */
+            Matrix< DDRMat >
+            get_point( uint aPointIndex ) const
+            {
+                return mPoints.get_column( aPointIndex );
+            }
+
+            //------------------------------------------------------------------------------
+            /**
+             * get the shape functions at a tabulated point
+             * @param[ in ]  aPointIndex integration point index
+             * @param[ out ] N ( 1 x <number of bases> )
+             */
+            const Matrix< DDRMat >&
+            N( uint aPointIndex ) const
+            {
+                MORIS_ASSERT( aPointIndex < mN.size(),
+                        "Shape_Function_Table::N - point index out of bounds." );
+
+                return mN( aPointIndex );
+            }
+
+            //------------------------------------------------------------------------------
+            /**
+             * get the first parametric derivatives of the shape functions at a tabulated point
+             * @param[ in ]  aPointIndex integration point index
+             * @param[ out ] dNdXi ( <number of dimensions> x <number of bases> )
+             */
+            const Matrix< DDRMat >&
+            dNdXi( uint aPointIndex ) const
+            {
+                MORIS_ASSERT( aPointIndex < mdNdXi.size(),
+                        "Shape_Function_Table::dNdXi - point index out of bounds." );
+
+                return mdNdXi( aPointIndex );
+            }
+
+            //------------------------------------------------------------------------------
+        };
+
+        //------------------------------------------------------------------------------
+    } /* namespace fem */
+} /* namespace moris */
+
+#endif /* SRC_FEM_CL_FEM_SHAPE_FUNCTION_TABLE_HPP_ */
@@ -153,12 +153,12 @@ namespace moris
                 }
             }
 
-            // reset constitutive models
+            // reset constitutive models if their field interpolators changed
             for ( const std::shared_ptr< Constitutive_Model >& tCM : mLeaderCM )
             {
                 if ( tCM != nullptr )
                 {
-                    tCM->reset_eval_flags();
+                    tCM->update_eval_flags();
                 }
             }
 
@@ -166,7 +166,7 @@ namespace moris
             {
                 if ( tCM != nullptr )
                 {
-                    tCM->reset_eval_flags();
+                    tCM->update_eval_flags();
                 }
             }
 
@@ -357,6 +357,28 @@ namespace moris
              */
             void set_reference_value( real aReferenceValue );
 
+            //------------------------------------------------------------------------------
+            /**
+             * get the reference value for this IQI
+             * @param[ out ] mReferenceValue reference value for scaling the IQI
+             */
+            real
+            get_reference_value() const
+            {
+                return mReferenceValue;
+            }
+
+            //------------------------------------------------------------------------------
+            /**
+             * check if a reference value was set for this IQI
+             * @param[ out ] mNormalized bool true if the IQI is normalized
+             */
+            bool
+            is_normalized() const
+            {
+                return mNormalized;
+            }
+
             //------------------------------------------------------------------------------
             /*
              * set fem set pointer
@@ -409,6 +431,22 @@ namespace moris
             set_normal( const Matrix< DDRMat >& aNormal )
             {
                 mNormal = aNormal;
+
+                // constitutive model tractions depend on the normal
+                for ( const std::shared_ptr< Constitutive_Model >& tCM : mLeaderCM )
+                {
+                    if ( tCM != nullptr )
+                    {
+                        tCM->invalidate_eval_cache();
+                    }
+                }
+                for ( const std::shared_ptr< Constitutive_Model >& tCM : mFollowerCM )
+                {
+                    if ( tCM != nullptr )
+                    {
+                        tCM->invalidate_eval_cache();
+                    }
+                }
             }
 
             //------------------------------------------------------------------------------
@@ -112,19 +112,19 @@ namespace moris
                 }
             }
 
-            // reset constitutive models
+            // reset constitutive models if their field interpolators changed
             for ( const std::shared_ptr< Constitutive_Model >& tCM : mLeaderCM )
             {
                 if ( tCM != nullptr )
                 {
-                    tCM->reset_eval_flags();
+                    tCM->update_eval_flags();
                 }
             }
             for ( const std::shared_ptr< Constitutive_Model >& tCM : mFollowerCM )
             {
                 if ( tCM != nullptr )
                 {
-                    tCM->reset_eval_flags();
+                    tCM->update_eval_flags();
                 }
             }
 
@@ -378,6 +378,22 @@ namespace moris
         {
             mNormal = aNormal;
 
+            // constitutive model tractions depend on the normal
+            for ( const std::shared_ptr< Constitutive_Model >& tCM : mLeaderCM )
+            {
+                if ( tCM != nullptr )
+                {
+                    tCM->invalidate_eval_cache();
+                }
+            }
+            for ( const std::shared_ptr< Constitutive_Model >& tCM : mFollowerCM )
+            {
+                if ( tCM != nullptr )
+                {
+                    tCM->invalidate_eval_cache();
+                }
+            }
+
             // set normal for SP
             for ( const std::shared_ptr< Stabilization_Parameter >& tSP : mStabilizationParam )
             {
@@ -2004,8 +2020,17 @@ namespace moris
                 fem::FDScheme_Type aFDSchemeType,
                 bool               aUseAbsolutePerturbations )
         {
-            // storage residual value
-            Matrix< DDRMat > tResidualStore = mSet->get_residual()( 0 );
+            // storage residual value, kept in the set arena to avoid a heap allocation per call
+            const Matrix< DDRMat >& tResidual0 = mSet->get_residual()( 0 );
+            Arena_Allocator&        tArena     = mSet->get_arena();
+
+            Matrix< DDRMat > tResidualStore(
+                    tArena.allocate< real >( tResidual0.numel() ),
+                    tResidual0.n_rows(),
+                    tResidual0.n_cols(),
+                    false,
+                    true );
+            tResidualStore = tResidual0;
 
             // get the FD scheme info
             moris::Cell< moris::Cell< real > > tFDScheme;
@@ -2050,7 +2075,23 @@ namespace moris
                 uint tDerNumFields = tFI->get_number_of_fields();
 
                 // coefficients for dof type wrt which derivative is computed
-                Matrix< DDRMat > tCoeff = tFI->get_coeff();
+                const Matrix< DDRMat >& tFICoeff = tFI->get_coeff();
+
+                Matrix< DDRMat > tCoeff(
+                        tArena.allocate< real >( tFICoeff.numel() ),
+                        tFICoeff.n_rows(),
+                        tFICoeff.n_cols(),
+                        false,
+                        true );
+                tCoeff = tFICoeff;
+
+                // perturbed coefficients, kept in the set arena and reset for each FD point
+                Matrix< DDRMat > tCoeffPert(
+                        tArena.allocate< real >( tFICoeff.numel() ),
+                        tFICoeff.n_rows(),
+                        tFICoeff.n_cols(),
+                        false,
+                        true );
 
                 // loop over the coefficient column
                 for ( uint iCoeffCol = 0; iCoeffCol < tDerNumFields; iCoeffCol++ )
@@ -2092,7 +2133,7 @@ namespace moris
                         for ( uint iPoint = tStartPoint; iPoint < tNumFDPoints; iPoint++ )
                         {
                             // reset the perturbed coefficients
-                            Matrix< DDRMat > tCoeffPert = tCoeff;
+                            tCoeffPert = tCoeff;
 
                             // perturb the coefficient
                             tCoeffPert( iCoeffRow, iCoeffCol ) += tFDScheme( 0 )( iPoint ) * tDeltaH;
@@ -11,6 +11,7 @@
 #include "cl_FEM_IWG_Diffusion_Bulk.hpp"
 #include "cl_FEM_Set.hpp"
 #include "cl_FEM_Field_Interpolator_Manager.hpp"
+#include "fn_FEM_Fixed_Size_Kernels.hpp"
 // LINALG/src
 #include "fn_trans.hpp"
 
@@ -180,10 +181,42 @@ namespace moris
                 // if constitutive model has dependency on the dof type
                 if ( tCMDiffusion->check_dof_dependency( tDofType ) )
                 {
+                    // get the test strain and the flux derivative
+                    const Matrix< DDRMat >& tTestStrain = tCMDiffusion->testStrain();
+                    const Matrix< DDRMat >& tdFluxdDOF  = tCMDiffusion->dFluxdDOF( tDofType );
+
+                    // use fixed size storage for linear hex elements, static or with linear time
+                    bool tIsHex8 = tTestStrain.n_rows() == 3 && tdFluxdDOF.n_rows() == 3
+                                && tTestStrain.n_cols() == tdFluxdDOF.n_cols()
+                                && ( tTestStrain.n_cols() == 8 || tTestStrain.n_cols() == 16 );
+
+                    if ( tIsHex8 && tTestStrain.n_cols() == 8 )
+                    {
+                        add_weighted_trans_product< 3, 8 >(
+                                aWStar,
+                                tTestStrain,
+                                tdFluxdDOF,
+                                mSet->get_jacobian(),
+                                tLeaderResStartIndex,
+                                tLeaderDepStartIndex );
+                    }
+                    else if ( tIsHex8 )
+                    {
+                        add_weighted_trans_product< 3, 16 >(
+                                aWStar,
+                                tTestStrain,
+                                tdFluxdDOF,
+                                mSet->get_jacobian(),
+                                tLeaderResStartIndex,
+                                tLeaderDepStartIndex );
+                    }
+                    else
+                    {
+                        tJac += aWStar * ( tCMDiffusion->testStrain_trans() * tdFluxdDOF );
+                    }
+
                     // compute the Jacobian
-                    tJac += aWStar * (                                                                          //
-                                    tCMDiffusion->testStrain_trans() * tCMDiffusion->dFluxdDOF( tDofType ) +    //
-                                    tFITemp->N_trans() * tCMDiffusion->dEnergyDotdDOF( tDofType ) );
+                    tJac += aWStar * ( tFITemp->N_trans() * tCMDiffusion->dEnergyDotdDOF( tDofType ) );
                     // FIXME add derivative of the test strain
                 }
 
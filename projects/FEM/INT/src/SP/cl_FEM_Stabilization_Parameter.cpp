@@ -98,21 +98,21 @@ namespace moris
             // reset the follower dv derivative flags
             mdPPdFollowerDvEval.fill( true );
 
-            // reset underlying leader constitutive models
+            // reset underlying leader constitutive models if their field interpolators changed
             for ( const std::shared_ptr< Constitutive_Model >& tCM : mLeaderCM )
             {
                 if ( tCM != nullptr )
                 {
-                    tCM->reset_eval_flags();
+                    tCM->update_eval_flags();
                 }
             }
 
-            // reset underlying follower constitutive models
+            // reset underlying follower constitutive models if their field interpolators changed
             for ( const std::shared_ptr< Constitutive_Model >& tCM : mFollowerCM )
             {
                 if ( tCM != nullptr )
                 {
-                    tCM->reset_eval_flags();
+                    tCM->update_eval_flags();
                 }
             }
 
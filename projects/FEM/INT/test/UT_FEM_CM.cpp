@@ -39,6 +39,18 @@ void tDerFunctionCM
     aPropMatrix = aParameters( 1 ) * aFIManager->get_field_interpolators_for_type( moris::MSI::Dof_Type::TEMP )->N();
 }
 
+// number of evaluations of tCountingValFunctionCM
+moris::uint gNumCountingValFunctionCMCalls = 0;
+
+void tCountingValFunctionCM
+( moris::Matrix< moris::DDRMat >                 & aPropMatrix,
+  moris::Cell< moris::Matrix< moris::DDRMat > >  & aParameters,
+  moris::fem::Field_Interpolator_Manager         * aFIManager )
+{
+    gNumCountingValFunctionCMCalls++;
+    aPropMatrix = aParameters( 0 );
+}
+
 namespace moris
 {
     namespace fem
@@ -151,6 +163,68 @@ namespace moris
 
         }/* TEST_CASE */
 
+        TEST_CASE( "Constitutive_Model_Evaluation_Cache", "[moris],[fem],[CM],[CM_Evaluation_Cache]" )
+        {
+            // reset the property evaluation counter
+            gNumCountingValFunctionCMCalls = 0;
+
+            // create a constant property counting its evaluations
+            std::shared_ptr< fem::Property > tProp = std::make_shared< fem::Property > ();
+            tProp->set_parameters( { {{ 2.0 }} } );
+            tProp->set_val_function( tCountingValFunctionCM );
+
+            // create a constitutive model
+            CM_Factory tCMFactory;
+            std::shared_ptr< fem::Constitutive_Model > tCM = tCMFactory.create_CM( fem::Constitutive_Type::DIFF_LIN_ISO );
+            tCM->set_space_dim( 2 );
+            tCM->set_dof_type_list( {{ MSI::Dof_Type::TEMP }} );
+            tCM->set_property( tProp, "Conductivity" );
+
+            // create a dof field interpolator
+            Cell< Field_Interpolator* > tDofFIs( 1, nullptr );
+            tDofFIs( 0 ) = new Field_Interpolator ( 1, { MSI::Dof_Type::TEMP } );
+
+            // create a dummy set and populate the set leader dof type map
+            fem::Set tSet;
+            tSet.mLeaderDofTypeMap.set_size( static_cast< int >( MSI::Dof_Type::END_ENUM ) + 1, 1, -1 );
+            tSet.mLeaderDofTypeMap( static_cast< int >( MSI::Dof_Type::TEMP ) ) = 0;
+
+            // create and populate a field interpolator manager
+            Field_Interpolator_Manager tFIManager( moris::Cell< moris::Cell< enum MSI::Dof_Type > >( 0 ), &tSet );
+            tFIManager.mFI = tDofFIs;
+
+            // set CM field interpolator manager
+            tCM->set_field_interpolator_manager( &tFIManager );
+
+            // first user of the CM evaluates it
+            tCM->update_eval_flags();
+            CHECK( equal_to( tCM->constitutive()( 0, 0 ), 2.0 ) );
+            CHECK( gNumCountingValFunctionCMCalls == 1 );
+
+            // second user of the CM in the same evaluation state reuses the evaluation
+            tCM->update_eval_flags();
+            CHECK( equal_to( tCM->constitutive()( 0, 0 ), 2.0 ) );
+            CHECK( gNumCountingValFunctionCMCalls == 1 );
+
+            // a reset of the field interpolator changes the evaluation state
+            tDofFIs( 0 )->reset_eval_flags();
+            tCM->update_eval_flags();
+            CHECK( equal_to( tCM->constitutive()( 0, 0 ), 2.0 ) );
+            CHECK( gNumCountingValFunctionCMCalls == 2 );
+
+            // an explicit reset of the CM always re-evaluates
+            tCM->reset_eval_flags();
+            CHECK( equal_to( tCM->constitutive()( 0, 0 ), 2.0 ) );
+            CHECK( gNumCountingValFunctionCMCalls == 3 );
+
+            // changing the property parameters changes the evaluation state
+            tProp->set_parameters( { {{ 3.0 }} } );
+            tCM->update_eval_flags();
+            CHECK( equal_to( tCM->constitutive()( 0, 0 ), 3.0 ) );
+            CHECK( gNumCountingValFunctionCMCalls == 4 );
+
+        }/* TEST_CASE */
+
     }/* namespace fem */
 }/* namespace moris */
 
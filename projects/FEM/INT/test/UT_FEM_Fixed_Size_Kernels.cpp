@@ -0,0 +1,486 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * UT_FEM_Fixed_Size_Kernels.cpp
+ *
+ */
+
+#include <cmath>
+#include <chrono>
+
+#include "catch.hpp"
+
+#include "cl_Matrix.hpp"
+#include "linalg_typedefs.hpp"
+#include "fn_inv.hpp"
+#include "fn_det.hpp"
+#include "fn_trans.hpp"
+#include "fn_norm.hpp"
+#include "op_times.hpp"
+#include "op_plus.hpp"
+#include "op_minus.hpp"
+
+#include "cl_MTK_Interpolation_Rule.hpp"
+#include "cl_MTK_Interpolation_Function_Base.hpp"
+#include "cl_FEM_Geometry_Interpolator.hpp"
+#include "cl_FEM_Field_Interpolator.hpp"
+#include "fn_FEM_Fixed_Size_Kernels.hpp"
+
+#include "cl_Logger.hpp"
+
+namespace moris
+{
+    namespace fem
+    {
+        //------------------------------------------------------------------------------
+
+        // space coefficients of a distorted hex8
+        inline Matrix< DDRMat >
+        distorted_hex8_coefficients( const real aShift )
+        {
+            return {
+                { 0.0 + aShift, 0.0, 0.0 },
+                { 1.1, 0.1, 0.0 },
+                { 1.0, 1.2, 0.1 },
+                { 0.1, 0.9, 0.0 },
+                { 0.0, 0.1, 1.0 + aShift },
+                { 1.2, 0.0, 0.9 },
+                { 1.0, 1.0, 1.1 },
+                { 0.0, 1.1, 1.0 }
+            };
+        }
+
+        //------------------------------------------------------------------------------
+
+        /*
+         * times the diffusion element matrix of a hex element with N bases at 2x2x2 Gauss points,
+         * once with Matrix< DDRMat > temporaries and once with the fixed size kernels
+         * @param[ in ]  aOrder        interpolation order of the hex element
+         * @param[ in ]  aNumElements  number of element evaluations
+         * @param[ out ] aTimeDynamic  per element cost with dynamic matrices in microseconds
+         * @param[ out ] aTimeFixed    per element cost with fixed size kernels in microseconds
+         * @return relative difference of the element matrices of both paths
+         */
+        template< uint N >
+        real
+        benchmark_hex_diffusion_element(
+                const mtk::Interpolation_Order aOrder,
+                const uint                     aNumElements,
+                real&                          aTimeDynamic,
+                real&                          aTimeFixed )
+        {
+            // create the hex space interpolation function and the trilinear map of the element
+            mtk::Interpolation_Rule tRule(
+                    mtk::Geometry_Type::HEX,
+                    mtk::Interpolation_Type::LAGRANGE,
+                    aOrder,
+                    mtk::Interpolation_Type::LAGRANGE,
+                    mtk::Interpolation_Order::LINEAR );
+
+            mtk::Interpolation_Rule tLinearRule(
+                    mtk::Geometry_Type::HEX,
+                    mtk::Interpolation_Type::LAGRANGE,
+                    mtk::Interpolation_Order::LINEAR,
+                    mtk::Interpolation_Type::LAGRANGE,
+                    mtk::Interpolation_Order::LINEAR );
+
+            mtk::Interpolation_Function_Base* tSpaceInterpolation  = tRule.create_space_interpolation_function();
+            mtk::Interpolation_Function_Base* tLinearInterpolation = tLinearRule.create_space_interpolation_function();
+
+            // 2x2x2 Gauss points with unit weights
+            real                                  tGaussCoord = 1.0 / std::sqrt( 3.0 );
+            moris::Cell< Matrix< DDRMat > >       tdNdXi( 8 );
+            std::array< Fixed_Matrix< 3, N >, 8 > tdNdXiFixed;
+            for ( uint iPoint = 0; iPoint < 8; iPoint++ )
+            {
+                Matrix< DDRMat > tXi = {
+                    { ( iPoint & 1 ) ? tGaussCoord : -tGaussCoord },
+                    { ( iPoint & 2 ) ? tGaussCoord : -tGaussCoord },
+                    { ( iPoint & 4 ) ? tGaussCoord : -tGaussCoord }
+                };
+                tSpaceInterpolation->eval_dNdXi( tXi, tdNdXi( iPoint ) );
+                copy_to_fixed( tdNdXi( iPoint ), tdNdXiFixed[ iPoint ] );
+            }
+
+            // element coefficients, nodes of the element placed on a distorted hex8
+            Matrix< DDRMat > tXiHat;
+            tSpaceInterpolation->get_param_coords( tXiHat );
+
+            moris::Cell< Matrix< DDRMat > > tXHats( aNumElements );
+            for ( uint iElement = 0; iElement < aNumElements; iElement++ )
+            {
+                Matrix< DDRMat > tXHat8 = distorted_hex8_coefficients( 0.1 * iElement / aNumElements );
+
+                tXHats( iElement ).set_size( N, 3 );
+                for ( uint iBase = 0; iBase < N; iBase++ )
+                {
+                    Matrix< DDRMat > tN8;
+                    tLinearInterpolation->eval_N( tXiHat.get_column( iBase ), tN8 );
+                    tXHats( iElement ).set_row( iBase, tN8 * tXHat8 );
+                }
+            }
+
+            // element diffusion matrix with dynamic matrices
+            Matrix< DDRMat > tKeDynamic;
+            auto             tStartDynamic = std::chrono::steady_clock::now();
+            for ( uint iElement = 0; iElement < aNumElements; iElement++ )
+            {
+                Matrix< DDRMat > tKe( N, N, 0.0 );
+                for ( uint iPoint = 0; iPoint < 8; iPoint++ )
+                {
+                    Matrix< DDRMat > tJ    = tdNdXi( iPoint ) * tXHats( iElement );
+                    Matrix< DDRMat > tInvJ = inv( tJ );
+                    Matrix< DDRMat > tdNdx = tInvJ * tdNdXi( iPoint );
+                    tKe += det( tJ ) * trans( tdNdx ) * tdNdx;
+                }
+                tKeDynamic = tKe;
+            }
+            auto tEndDynamic = std::chrono::steady_clock::now();
+
+            // element diffusion matrix with fixed size kernels
+            Fixed_Matrix< N, N > tKeFixed;
+            auto                 tStartFixed = std::chrono::steady_clock::now();
+            for ( uint iElement = 0; iElement < aNumElements; iElement++ )
+            {
+                Fixed_Matrix< N, 3 > tXHat;
+                copy_to_fixed( tXHats( iElement ), tXHat );
+
+                Fixed_Matrix< N, N > tKe = {};
+                for ( uint iPoint = 0; iPoint < 8; iPoint++ )
+                {
+                    Fixed_Matrix< 3, 3 > tJ;
+                    Fixed_Matrix< 3, 3 > tInvJ;
+                    Fixed_Matrix< 3, N > tdNdx;
+                    eval_space_jacobian( tdNdXiFixed[ iPoint ], tXHat, tJ );
+                    real tDetJ = eval_inverse_space_jacobian< 3 >( tJ, tInvJ );
+                    eval_dNdx( tInvJ, tdNdXiFixed[ iPoint ], tdNdx );
+
+                    for ( uint iRow = 0; iRow < N; iRow++ )
+                    {
+                        for ( uint iCol = 0; iCol < N; iCol++ )
+                        {
+                            tKe[ iRow ][ iCol ] += tDetJ * ( tdNdx[ 0 ][ iRow ] * tdNdx[ 0 ][ iCol ] + tdNdx[ 1 ][ iRow ] * tdNdx[ 1 ][ iCol ] + tdNdx[ 2 ][ iRow ] * tdNdx[ 2 ][ iCol ] );
+                        }
+                    }
+                }
+                tKeFixed = tKe;
+            }
+            auto tEndFixed = std::chrono::steady_clock::now();
+
+            // per element cost
+            aTimeDynamic = std::chrono::duration< real, std::micro >( tEndDynamic - tStartDynamic ).count() / aNumElements;
+            aTimeFixed   = std::chrono::duration< real, std::micro >( tEndFixed - tStartFixed ).count() / aNumElements;
+
+            // difference of the element matrices of the last element
+            Matrix< DDRMat > tKeFixedCopy;
+            copy_from_fixed( tKeFixed, tKeFixedCopy );
+
+            // clean up
+            delete tSpaceInterpolation;
+            delete tLinearInterpolation;
+
+            return norm( tKeDynamic - tKeFixedCopy ) / norm( tKeDynamic );
+        }
+
+        //------------------------------------------------------------------------------
+
+        TEST_CASE( "Fixed_Size_Kernels", "[moris],[fem],[Fixed_Size_Kernels]" )
+        {
+            // define an epsilon environment
+            real tEpsilon = 1.0e-12;
+
+            // create a space and time geometry interpolation rule
+            mtk::Interpolation_Rule tGIRule(
+                    mtk::Geometry_Type::HEX,
+                    mtk::Interpolation_Type::LAGRANGE,
+                    mtk::Interpolation_Order::LINEAR,
+                    mtk::Interpolation_Type::LAGRANGE,
+                    mtk::Interpolation_Order::LINEAR );
+
+            // create a space time geometry interpolator
+            Geometry_Interpolator tGI( tGIRule );
+
+            // set the coefficients xHat, tHat
+            Matrix< DDRMat > tXHat = distorted_hex8_coefficients( 0.1 );
+            Matrix< DDRMat > tTHat = { { 0.0 }, { 1.0 } };
+            tGI.set_coeff( tXHat, tTHat );
+
+            // set the evaluation point
+            Matrix< DDRMat > tParamPoint = { { 0.3 }, { -0.2 }, { 0.6 }, { 0.0 } };
+            tGI.set_space_time( tParamPoint );
+
+            // copy inputs into fixed size matrices
+            Fixed_Matrix< 3, 8 > tdNdXi;
+            Fixed_Matrix< 8, 3 > tXHatFixed;
+            copy_to_fixed( tGI.dNdXi(), tdNdXi );
+            copy_to_fixed( tXHat, tXHatFixed );
+
+            // evaluate fixed size kernels
+            Fixed_Matrix< 3, 3 > tJ;
+            Fixed_Matrix< 3, 3 > tInvJ;
+            Fixed_Matrix< 3, 8 > tdNdx;
+            eval_space_jacobian( tdNdXi, tXHatFixed, tJ );
+            real tDetJ = eval_inverse_space_jacobian< 3 >( tJ, tInvJ );
+            eval_dNdx( tInvJ, tdNdXi, tdNdx );
+
+            // compare against the geometry interpolator
+            const Matrix< DDRMat >& tJRef    = tGI.space_jacobian();
+            const Matrix< DDRMat >& tInvJRef = tGI.inverse_space_jacobian();
+            Matrix< DDRMat >        tdNdxRef = tInvJRef * tGI.dNdXi();
+
+            CHECK( std::abs( tDetJ - tGI.space_det_J() ) < tEpsilon );
+
+            bool tCheckJ = true;
+            for ( uint iRow = 0; iRow < 3; iRow++ )
+            {
+                for ( uint iCol = 0; iCol < 3; iCol++ )
+                {
+                    tCheckJ = tCheckJ && ( std::abs( tJ[ iRow ][ iCol ] - tJRef( iRow, iCol ) ) < tEpsilon );
+                    tCheckJ = tCheckJ && ( std::abs( tInvJ[ iRow ][ iCol ] - tInvJRef( iRow, iCol ) ) < tEpsilon );
+                }
+            }
+            CHECK( tCheckJ );
+
+            bool tCheckdNdx = true;
+            for ( uint iRow = 0; iRow < 3; iRow++ )
+            {
+                for ( uint iBase = 0; iBase < 8; iBase++ )
+                {
+                    tCheckdNdx = tCheckdNdx && ( std::abs( tdNdx[ iRow ][ iBase ] - tdNdxRef( iRow, iBase ) ) < tEpsilon );
+                }
+            }
+            CHECK( tCheckdNdx );
+
+            // linear displacement field u = A * x, strain is the symmetric part of A
+            Matrix< DDRMat > tA = {
+                { 0.1, 0.2, -0.3 },
+                { 0.4, -0.5, 0.6 },
+                { 0.7, 0.8, 0.9 }
+            };
+            Matrix< DDRMat > tUHat = tXHat * trans( tA );
+
+            // evaluate the strain with the strain-displacement matrix
+            Fixed_Matrix< 6, 24 > tB;
+            eval_B_matrix( tdNdx, tB );
+
+            std::array< real, 6 > tStrain;
+            for ( uint iStrain = 0; iStrain < 6; iStrain++ )
+            {
+                tStrain[ iStrain ] = 0.0;
+                for ( uint iField = 0; iField < 3; iField++ )
+                {
+                    for ( uint iBase = 0; iBase < 8; iBase++ )
+                    {
+                        tStrain[ iStrain ] += tB[ iStrain ][ iField * 8 + iBase ] * tUHat( iBase, iField );
+                    }
+                }
+            }
+
+            CHECK( std::abs( tStrain[ 0 ] - tA( 0, 0 ) ) < tEpsilon );
+            CHECK( std::abs( tStrain[ 1 ] - tA( 1, 1 ) ) < tEpsilon );
+            CHECK( std::abs( tStrain[ 2 ] - tA( 2, 2 ) ) < tEpsilon );
+            CHECK( std::abs( tStrain[ 3 ] - tA( 1, 2 ) - tA( 2, 1 ) ) < tEpsilon );
+            CHECK( std::abs( tStrain[ 4 ] - tA( 0, 2 ) - tA( 2, 0 ) ) < tEpsilon );
+            CHECK( std::abs( tStrain[ 5 ] - tA( 0, 1 ) - tA( 1, 0 ) ) < tEpsilon );
+
+            // the diffusive flux of a linear temperature field is the conductivity times its gradient
+            std::array< real, 8 > tTempHat;
+            for ( uint iBase = 0; iBase < 8; iBase++ )
+            {
+                tTempHat[ iBase ] = 2.0 * tXHat( iBase, 0 ) - tXHat( iBase, 1 ) + 0.5 * tXHat( iBase, 2 );
+            }
+
+            std::array< real, 3 > tFlux;
+            eval_diffusive_flux( 3.0, tdNdx, tTempHat, tFlux );
+
+            CHECK( std::abs( tFlux[ 0 ] - 6.0 ) < tEpsilon );
+            CHECK( std::abs( tFlux[ 1 ] + 3.0 ) < tEpsilon );
+            CHECK( std::abs( tFlux[ 2 ] - 1.5 ) < tEpsilon );
+        }
+
+        //------------------------------------------------------------------------------
+
+        TEST_CASE( "Fixed_Size_Kernels_Hex8_Diffusion", "[moris],[fem],[Fixed_Size_Kernels_Hex8_Diffusion]" )
+        {
+            // define an epsilon environment
+            real tEpsilon = 1.0e-12;
+
+            // create a space and time interpolation rule
+            mtk::Interpolation_Rule tRule(
+                    mtk::Geometry_Type::HEX,
+                    mtk::Interpolation_Type::LAGRANGE,
+                    mtk::Interpolation_Order::LINEAR,
+                    mtk::Interpolation_Type::LAGRANGE,
+                    mtk::Interpolation_Order::LINEAR );
+
+            // create a space time geometry interpolator
+            Geometry_Interpolator tGI( tRule );
+
+            // set the coefficients xHat, tHat
+            Matrix< DDRMat > tXHat = distorted_hex8_coefficients( 0.2 );
+            Matrix< DDRMat > tTHat = { { 0.0 }, { 0.5 } };
+            tGI.set_coeff( tXHat, tTHat );
+
+            // create a temperature field interpolator
+            Field_Interpolator tFI( 1, tRule, &tGI, { MSI::Dof_Type::TEMP } );
+
+            // set the evaluation point
+            Matrix< DDRMat > tXi         = { { -0.4 }, { 0.25 }, { 0.7 } };
+            Matrix< DDRMat > tTau        = { { 0.3 } };
+            Matrix< DDRMat > tParamPoint = { { tXi( 0 ) }, { tXi( 1 ) }, { tXi( 2 ) }, { tTau( 0 ) } };
+            tGI.set_space_time( tParamPoint );
+            tFI.set_space_time( tParamPoint );
+
+            // evaluate the space and time shape functions directly
+            mtk::Interpolation_Function_Base* tSpaceInterpolation = tRule.create_space_interpolation_function();
+            mtk::Interpolation_Function_Base* tTimeInterpolation  = tRule.create_time_interpolation_function();
+
+            Matrix< DDRMat > tNSpace;
+            Matrix< DDRMat > tdNSpacedXi;
+            Matrix< DDRMat > tNTime;
+            tSpaceInterpolation->eval_N( tXi, tNSpace );
+            tSpaceInterpolation->eval_dNdXi( tXi, tdNSpacedXi );
+            tTimeInterpolation->eval_N( tTau, tNTime );
+
+            // the geometry interpolator space Jacobian uses the fixed size path for hex8
+            Matrix< DDRMat > tJRef = tdNSpacedXi * tXHat;
+            CHECK( norm( tGI.space_jacobian() - tJRef ) < tEpsilon * norm( tJRef ) );
+
+            // reference space time shape functions and their derivatives wrt x
+            Matrix< DDRMat > tdNSpacedX = inv( tJRef ) * tdNSpacedXi;
+            Matrix< DDRMat > tNRef( 1, 16 );
+            Matrix< DDRMat > tdNdxRef( 3, 16 );
+            for ( uint iTime = 0; iTime < 2; iTime++ )
+            {
+                for ( uint iBase = 0; iBase < 8; iBase++ )
+                {
+                    tNRef( iTime * 8 + iBase ) = tNSpace( iBase ) * tNTime( iTime );
+                    for ( uint iDim = 0; iDim < 3; iDim++ )
+                    {
+                        tdNdxRef( iDim, iTime * 8 + iBase ) = tdNSpacedX( iDim, iBase ) * tNTime( iTime );
+                    }
+                }
+            }
+
+            // the field interpolator shape functions and derivatives use the fixed size path for hex8
+            CHECK( norm( tFI.NBuild() - tNRef ) < tEpsilon );
+            CHECK( norm( tFI.dnNdxn( 1 ) - tdNdxRef ) < tEpsilon * norm( tdNdxRef ) );
+
+            // add the weighted diffusion product to a block of a larger matrix
+            real             tWeight = 0.8;
+            Matrix< DDRMat > tJacobian( 20, 21, 1.0 );
+            add_weighted_trans_product< 3, 16 >( tWeight, tdNdxRef, tdNdxRef, tJacobian, 2, 3 );
+
+            // compare against the dynamic matrix product
+            Matrix< DDRMat > tJacobianRef( 20, 21, 1.0 );
+            tJacobianRef( { 2, 17 }, { 3, 18 } ) += tWeight * trans( tdNdxRef ) * tdNdxRef;
+
+            CHECK( norm( tJacobian - tJacobianRef ) < tEpsilon * norm( tJacobianRef ) );
+
+            // clean up
+            delete tSpaceInterpolation;
+            delete tTimeInterpolation;
+        }
+
+        //------------------------------------------------------------------------------
+
+        TEST_CASE( "Fixed_Size_Kernels_Hex27", "[moris],[fem],[Fixed_Size_Kernels_Hex27]" )
+        {
+            // define an epsilon environment
+            real tEpsilon = 1.0e-12;
+
+            // create a quadratic hex space and linear time interpolation rule
+            mtk::Interpolation_Rule tRule(
+                    mtk::Geometry_Type::HEX,
+                    mtk::Interpolation_Type::LAGRANGE,
+                    mtk::Interpolation_Order::QUADRATIC,
+                    mtk::Interpolation_Type::LAGRANGE,
+                    mtk::Interpolation_Order::LINEAR );
+
+            mtk::Interpolation_Function_Base* tSpaceInterpolation = tRule.create_space_interpolation_function();
+
+            // place the hex27 nodes on a distorted, curved hex
+            Matrix< DDRMat > tXiHat;
+            tSpaceInterpolation->get_param_coords( tXiHat );
+
+            Matrix< DDRMat > tXHat( 27, 3 );
+            for ( uint iBase = 0; iBase < 27; iBase++ )
+            {
+                real tXi   = tXiHat( 0, iBase );
+                real tEta  = tXiHat( 1, iBase );
+                real tZeta = tXiHat( 2, iBase );
+
+                tXHat( iBase, 0 ) = 1.0 + tXi + 0.1 * tEta * tEta;
+                tXHat( iBase, 1 ) = 1.2 * tEta + 0.1 * tXi * tZeta;
+                tXHat( iBase, 2 ) = 0.9 * tZeta - 0.05 * tXi * tXi;
+            }
+            Matrix< DDRMat > tTHat = { { 0.0 }, { 0.5 } };
+
+            // create a space time geometry interpolator and a temperature field interpolator
+            Geometry_Interpolator tGI( tRule );
+            tGI.set_coeff( tXHat, tTHat );
+
+            Field_Interpolator tFI( 1, tRule, &tGI, { MSI::Dof_Type::TEMP } );
+
+            // set the evaluation point
+            Matrix< DDRMat > tXi         = { { 0.3 }, { -0.6 }, { 0.45 } };
+            Matrix< DDRMat > tParamPoint = { { tXi( 0 ) }, { tXi( 1 ) }, { tXi( 2 ) }, { -0.2 } };
+            tGI.set_space_time( tParamPoint );
+            tFI.set_space_time( tParamPoint );
+
+            // reference space Jacobian and space derivatives wrt x
+            Matrix< DDRMat > tdNSpacedXi;
+            tSpaceInterpolation->eval_dNdXi( tXi, tdNSpacedXi );
+
+            Matrix< DDRMat > tJRef      = tdNSpacedXi * tXHat;
+            Matrix< DDRMat > tdNSpacedX = inv( tJRef ) * tdNSpacedXi;
+
+            // the geometry and field interpolators use the fixed size path for hex27
+            CHECK( norm( tGI.space_jacobian() - tJRef ) < tEpsilon * norm( tJRef ) );
+
+            const Matrix< DDRMat >& tdNdx = tFI.dnNdxn( 1 );
+            REQUIRE( tdNdx.n_cols() == 54 );
+
+            Matrix< DDRMat > tdNdxSum = tdNdx( { 0, 2 }, { 0, 26 } ) + tdNdx( { 0, 2 }, { 27, 53 } );
+            CHECK( norm( tdNdxSum - tdNSpacedX ) < tEpsilon * norm( tdNSpacedX ) );
+
+            // clean up
+            delete tSpaceInterpolation;
+        }
+
+        //------------------------------------------------------------------------------
+
+        // opt-in benchmark, run with the tag [.benchmark]
+        TEST_CASE( "Fixed_Size_Kernels_Benchmark", "[.benchmark],[fem],[Fixed_Size_Kernels_Benchmark]" )
+        {
+            // number of element evaluations
+            uint tNumElements = 2000;
+
+            real tTimeDynamic = 0.0;
+            real tTimeFixed   = 0.0;
+
+            real tErrorHex8 = benchmark_hex_diffusion_element< 8 >(
+                    mtk::Interpolation_Order::LINEAR, tNumElements, tTimeDynamic, tTimeFixed );
+
+            MORIS_LOG_INFO( "Hex8 diffusion element matrix, per element cost: %f us (Matrix< DDRMat >), %f us (fixed size kernels)",
+                    tTimeDynamic,
+                    tTimeFixed );
+
+            real tErrorHex27 = benchmark_hex_diffusion_element< 27 >(
+                    mtk::Interpolation_Order::QUADRATIC, tNumElements, tTimeDynamic, tTimeFixed );
+
+            MORIS_LOG_INFO( "Hex27 diffusion element matrix, per element cost: %f us (Matrix< DDRMat >), %f us (fixed size kernels)",
+                    tTimeDynamic,
+                    tTimeFixed );
+
+            // check that both paths give the same element matrices
+            CHECK( tErrorHex8 < 1.0e-12 );
+            CHECK( tErrorHex27 < 1.0e-12 );
+        }
+
+        //------------------------------------------------------------------------------
+    } /* namespace fem */
+} /* namespace moris */
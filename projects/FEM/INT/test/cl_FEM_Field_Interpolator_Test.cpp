@@ -15,6 +15,9 @@
 #include "cl_FEM_Field_Interpolator.hpp" //FEM/INT/src
 #undef protected
 #undef private
+#include "cl_FEM_Shape_Function_Table.hpp" //FEM/INT/src
+#include "cl_MTK_Integrator.hpp"           //MTK/src
+#include "fn_norm.hpp"
 
 using namespace moris;
 using namespace fem;
@@ -576,3 +579,134 @@ TEST_CASE( "FI_vectorialField", "[moris],[fem],[FI_vectorialField]" )
     }
     REQUIRE( tCheckTestN );
 }
+
+// This test case checks that field interpolators reading the shape functions from
+// shared tables at the integration points give the same results as direct evaluation.
+TEST_CASE( "FI_Shape_Function_Table", "[moris],[fem],[FI_Shape_Function_Table]" )
+{
+    // define an epsilon environment
+    real tEpsilon = 1E-12;
+
+    // geometry interpolator
+    //------------------------------------------------------------------------------
+    // create a distorted hex8 space element
+    Matrix< DDRMat > tXHat = {
+            { 0.0, 0.0, 0.0 },
+            { 2.0, 0.1, 0.0 },
+            { 2.2, 1.8, 0.1 },
+            { 0.1, 2.0, 0.0 },
+            { 0.0, 0.2, 1.9 },
+            { 2.1, 0.0, 2.0 },
+            { 2.0, 2.1, 2.2 },
+            { 0.2, 1.9, 2.0 } };
+
+    // create a line time element
+    Matrix< DDRMat > tTHat = { { 0.0 }, { 1.5 } };
+
+    // create a space geometry interpolation rule
+    mtk::Interpolation_Rule tGeomInterpRule(
+            mtk::Geometry_Type::HEX,
+            mtk::Interpolation_Type::LAGRANGE,
+            mtk::Interpolation_Order::LINEAR,
+            mtk::Interpolation_Type::LAGRANGE,
+            mtk::Interpolation_Order::LINEAR );
+
+    // create a geometry interpolator and set the coefficients
+    Geometry_Interpolator tGeomInterpolator( tGeomInterpRule );
+    tGeomInterpolator.set_coeff( tXHat, tTHat );
+
+    // field interpolators
+    //------------------------------------------------------------------------------
+    // create a quadratic space and time interpolation rule
+    mtk::Interpolation_Rule tInterpolationRule(
+            mtk::Geometry_Type::HEX,
+            mtk::Interpolation_Type::LAGRANGE,
+            mtk::Interpolation_Order::QUADRATIC,
+            mtk::Interpolation_Type::LAGRANGE,
+            mtk::Interpolation_Order::QUADRATIC );
+
+    // create a field interpolator with tables and one evaluating directly
+    Field_Interpolator tTableFI( 1, tInterpolationRule, &tGeomInterpolator, { MSI::Dof_Type::TEMP } );
+    Field_Interpolator tDirectFI( 1, tInterpolationRule, &tGeomInterpolator, { MSI::Dof_Type::TEMP } );
+
+    // integration points
+    //------------------------------------------------------------------------------
+    mtk::Integration_Rule tIntegrationRule(
+            mtk::Geometry_Type::HEX,
+            mtk::Integration_Type::GAUSS,
+            mtk::Integration_Order::HEX_3x3x3,
+            mtk::Geometry_Type::LINE,
+            mtk::Integration_Type::GAUSS,
+            mtk::Integration_Order::BAR_3 );
+
+    mtk::Integrator tIntegrator( tIntegrationRule );
+
+    Matrix< DDRMat > tIntegPoints;
+    tIntegrator.get_points( tIntegPoints );
+
+    uint tNumPoints = tIntegPoints.n_cols();
+
+    // build the space and time tables and share them with the field interpolator
+    mtk::Interpolation_Function_Base* tSpaceInterpolation = tInterpolationRule.create_space_interpolation_function();
+    mtk::Interpolation_Function_Base* tTimeInterpolation  = tInterpolationRule.create_time_interpolation_function();
+
+    Matrix< DDRMat > tSpacePoints = tIntegPoints( { 0, 2 }, { 0, tNumPoints - 1 } );
+    Matrix< DDRMat > tTimePoints  = tIntegPoints( { 3, 3 }, { 0, tNumPoints - 1 } );
+
+    std::shared_ptr< const Shape_Function_Table > tSpaceTable =
+            std::make_shared< const Shape_Function_Table >( tSpaceInterpolation, tSpacePoints );
+    std::shared_ptr< const Shape_Function_Table > tTimeTable =
+            std::make_shared< const Shape_Function_Table >( tTimeInterpolation, tTimePoints );
+
+    delete tSpaceInterpolation;
+    delete tTimeInterpolation;
+
+    REQUIRE( tSpaceTable->get_number_of_points() == tNumPoints );
+
+    tTableFI.set_shape_function_tables( tSpaceTable, tTimeTable );
+
+    // set the same coefficients on both field interpolators
+    uint             tNumBases = tTableFI.get_number_of_space_time_bases();
+    Matrix< DDRMat > tUHat( tNumBases, 1 );
+    for ( uint iBase = 0; iBase < tNumBases; iBase++ )
+    {
+        tUHat( iBase ) = 0.1 * iBase * iBase - 0.5 * iBase + 1.0;
+    }
+    tTableFI.set_coeff( tUHat );
+    tDirectFI.set_coeff( tUHat );
+
+    // compare tabulated and direct evaluations at every integration point
+    for ( uint iGP = 0; iGP < tNumPoints; iGP++ )
+    {
+        Matrix< DDRMat > tParamPoint = tIntegPoints.get_column( iGP );
+
+        tGeomInterpolator.set_space_time( tParamPoint );
+        tTableFI.set_space_time( tParamPoint, iGP );
+        tDirectFI.set_space_time( tParamPoint );
+
+        // the table is only used by the field interpolator it was set to
+        CHECK( tTableFI.mTablePointIndex == (sint)iGP );
+        CHECK( tDirectFI.mTablePointIndex == -1 );
+
+        CHECK( norm( tTableFI.NBuild() - tDirectFI.NBuild() ) < tEpsilon );
+        CHECK( norm( tTableFI.dnNdxn( 1 ) - tDirectFI.dnNdxn( 1 ) ) < tEpsilon );
+        CHECK( norm( tTableFI.dnNdxn( 2 ) - tDirectFI.dnNdxn( 2 ) ) < tEpsilon );
+        CHECK( norm( tTableFI.dnNdtn( 1 ) - tDirectFI.dnNdtn( 1 ) ) < tEpsilon );
+        CHECK( norm( tTableFI.dnNdtn( 2 ) - tDirectFI.dnNdtn( 2 ) ) < tEpsilon );
+        CHECK( norm( tTableFI.d2Ndxt() - tDirectFI.d2Ndxt() ) < tEpsilon );
+        CHECK( norm( tTableFI.gradx( 1 ) - tDirectFI.gradx( 1 ) ) < tEpsilon );
+        CHECK( norm( tTableFI.val() - tDirectFI.val() ) < tEpsilon );
+    }
+
+    // a point which is not tabulated is evaluated directly
+    Matrix< DDRMat > tParamPoint = { { 0.35 }, { -0.25 }, { 0.7 }, { 0.1 } };
+
+    tGeomInterpolator.set_space_time( tParamPoint );
+    tTableFI.set_space_time( tParamPoint );
+    tDirectFI.set_space_time( tParamPoint );
+
+    CHECK( tTableFI.mTablePointIndex == -1 );
+    CHECK( norm( tTableFI.NBuild() - tDirectFI.NBuild() ) < tEpsilon );
+    CHECK( norm( tTableFI.dnNdxn( 1 ) - tDirectFI.dnNdxn( 1 ) ) < tEpsilon );
+    CHECK( norm( tTableFI.dnNdtn( 1 ) - tDirectFI.dnNdtn( 1 ) ) < tEpsilon );
+}
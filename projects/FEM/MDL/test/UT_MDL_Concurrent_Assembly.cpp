@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * UT_MDL_Concurrent_Assembly.cpp
+ *
+ */
+
+#include "catch.hpp"
+
+#include "cl_Communication_Tools.hpp"
+
+#include "cl_MTK_Mesh_Manager.hpp"
+
+#include "cl_Matrix.hpp"    //LINALG
+#include "linalg_typedefs.hpp"
+#include "fn_norm.hpp"
+
+#include "cl_FEM_Model.hpp"    //FEM/INT/src
+
+#include "cl_MSI_Model_Solver_Interface.hpp"
+#include "cl_MSI_Solver_Interface.hpp"
+
+#include "cl_HMR.hpp"
+#include "cl_HMR_Mesh_Interpolation.hpp"
+#include "cl_HMR_Mesh_Integration.hpp"
+#include "cl_HMR_Parameters.hpp"    //HMR/src
+
+#include "cl_DLA_Solver_Factory.hpp"
+#include "cl_DLA_Linear_Problem.hpp"
+#include "cl_SOL_Matrix_Vector_Factory.hpp"
+#include "cl_SOL_Dist_Vector.hpp"
+#include "cl_SOL_Dist_Matrix.hpp"
+#include "cl_SOL_Dist_Map.hpp"
+
+#include "fn_PRM_FEM_Parameters.hpp"
+#include "fn_PRM_MSI_Parameters.hpp"
+
+namespace moris
+{
+    namespace mdl
+    {
+        // fem input for a 2D diffusion problem with a Nitsche Dirichlet boundary condition
+        void
+        tFEMParameterList_MDLConcurrent( moris::Cell< moris::Cell< ParameterList > >& aParameterList )
+        {
+            aParameterList.resize( 8 );
+
+            // properties
+            aParameterList( 0 ).resize( 3 );
+
+            aParameterList( 0 )( 0 ) = prm::create_property_parameter_list();
+            aParameterList( 0 )( 0 ).set( "property_name", "PropConductivity" );
+            aParameterList( 0 )( 0 ).set( "function_parameters", "1.0" );
+
+            aParameterList( 0 )( 1 ) = prm::create_property_parameter_list();
+            aParameterList( 0 )( 1 ).set( "property_name", "PropDirichlet" );
+            aParameterList( 0 )( 1 ).set( "function_parameters", "5.0" );
+
+            aParameterList( 0 )( 2 ) = prm::create_property_parameter_list();
+            aParameterList( 0 )( 2 ).set( "property_name", "PropLoad" );
+            aParameterList( 0 )( 2 ).set( "function_parameters", "2.0" );
+
+            // constitutive models
+            aParameterList( 1 ).resize( 1 );
+
+            aParameterList( 1 )( 0 ) = prm::create_constitutive_model_parameter_list();
+            aParameterList( 1 )( 0 ).set( "constitutive_name", "CMDiffusion" );
+            aParameterList( 1 )( 0 ).set( "constitutive_type", static_cast< uint >( fem::Constitutive_Type::DIFF_LIN_ISO ) );
+            aParameterList( 1 )( 0 ).set( "dof_dependencies", std::pair< std::string, std::string >( "TEMP", "Temperature" ) );
+            aParameterList( 1 )( 0 ).set( "properties", "PropConductivity,Conductivity" );
+
+            // stabilization parameters
+            aParameterList( 2 ).resize( 1 );
+
+            aParameterList( 2 )( 0 ) = prm::create_stabilization_parameter_parameter_list();
+            aParameterList( 2 )( 0 ).set( "stabilization_name", "SPNitsche" );
+            aParameterList( 2 )( 0 ).set( "stabilization_type", static_cast< uint >( fem::Stabilization_Type::DIRICHLET_NITSCHE ) );
+            aParameterList( 2 )( 0 ).set( "function_parameters", "10.0" );
+            aParameterList( 2 )( 0 ).set( "leader_properties", "PropConductivity,Material" );
+
+            // IWGs
+            aParameterList( 3 ).resize( 2 );
+
+            aParameterList( 3 )( 0 ) = prm::create_IWG_parameter_list();
+            aParameterList( 3 )( 0 ).set( "IWG_name", "IWGBulk" );
+            aParameterList( 3 )( 0 ).set( "IWG_type", static_cast< uint >( fem::IWG_Type::SPATIALDIFF_BULK ) );
+            aParameterList( 3 )( 0 ).set( "dof_residual", "TEMP" );
+            aParameterList( 3 )( 0 ).set( "leader_dof_dependencies", "TEMP" );
+            aParameterList( 3 )( 0 ).set( "leader_properties", "PropLoad,Load" );
+            aParameterList( 3 )( 0 ).set( "leader_constitutive_models", "CMDiffusion,Diffusion" );
+            aParameterList( 3 )( 0 ).set( "mesh_set_names", "HMR_dummy" );
+
+            aParameterList( 3 )( 1 ) = prm::create_IWG_parameter_list();
+            aParameterList( 3 )( 1 ).set( "IWG_name", "IWGDirichlet" );
+            aParameterList( 3 )( 1 ).set( "IWG_type", static_cast< uint >( fem::IWG_Type::SPATIALDIFF_DIRICHLET_UNSYMMETRIC_NITSCHE ) );
+            aParameterList( 3 )( 1 ).set( "dof_residual", "TEMP" );
+            aParameterList( 3 )( 1 ).set( "leader_dof_dependencies", "TEMP" );
+            aParameterList( 3 )( 1 ).set( "leader_properties", "PropDirichlet,Dirichlet" );
+            aParameterList( 3 )( 1 ).set( "leader_constitutive_models", "CMDiffusion,Diffusion" );
+            aParameterList( 3 )( 1 ).set( "stabilization_parameters", "SPNitsche,DirichletNitsche" );
+            aParameterList( 3 )( 1 ).set( "mesh_set_names", "SideSet_4" );
+
+            // computation
+            aParameterList( 5 ).resize( 1 );
+            aParameterList( 5 )( 0 ) = prm::create_computation_parameter_list();
+        }
+
+        TEST_CASE( "MDL Concurrent Assembly", "[MDL_Concurrent_Assembly]" )
+        {
+            if ( par_size() == 1 )
+            {
+                moris::uint tLagrangeMeshIndex = 0;
+
+                moris::hmr::Parameters tParameters;
+
+                tParameters.set_number_of_elements_per_dimension( { { 8 }, { 6 } } );
+                tParameters.set_domain_dimensions( { { 4 }, { 3 } } );
+                tParameters.set_domain_offset( { { 0.0 }, { 0.0 } } );
+                tParameters.set_bspline_truncation( true );
+                tParameters.set_side_sets( { { 1 }, { 2 }, { 3 }, { 4 } } );
+
+                tParameters.set_lagrange_orders( { { 1 } } );
+                tParameters.set_lagrange_patterns( { { 0 } } );
+
+                tParameters.set_bspline_orders( { { 1 } } );
+                tParameters.set_bspline_patterns( { { 0 } } );
+
+                tParameters.set_union_pattern( 2 );
+                tParameters.set_working_pattern( 3 );
+
+                Cell< Matrix< DDSMat > > tLagrangeToBSplineMesh( 1 );
+                tLagrangeToBSplineMesh( 0 ) = { { 0 } };
+
+                tParameters.set_lagrange_to_bspline_mesh( tLagrangeToBSplineMesh );
+
+                hmr::HMR tHMR( tParameters );
+
+                tHMR.perform_initial_refinement();
+
+                tHMR.finalize();
+
+                // construct a mesh manager for the fem
+                moris::hmr::Interpolation_Mesh_HMR* tInterpolationMesh = tHMR.create_interpolation_mesh( tLagrangeMeshIndex );
+                moris::hmr::Integration_Mesh_HMR*   tIntegrationMesh   = tHMR.create_integration_mesh( 1, 0, tInterpolationMesh );
+
+                std::shared_ptr< mtk::Mesh_Manager > tMeshManager = std::make_shared< mtk::Mesh_Manager >();
+                tMeshManager->register_mesh_pair( tInterpolationMesh, tIntegrationMesh );
+
+                // build the FEM model from parameter lists such that replicas of the IWGs can be created for further threads
+                moris::Cell< moris::Cell< ParameterList > > tFEMParameterList;
+                tFEMParameterList_MDLConcurrent( tFEMParameterList );
+
+                MSI::Design_Variable_Interface* tDesignVariableInterface = nullptr;
+
+                std::shared_ptr< fem::FEM_Model > tFEMModel = std::make_shared< fem::FEM_Model >(
+                        tMeshManager,
+                        0,
+                        tFEMParameterList,
+                        tDesignVariableInterface );
+
+                tFEMModel->initialize_from_inputfile( nullptr );
+
+                REQUIRE( tFEMModel->can_create_IWG_and_IQI_replicas() );
+
+                // create the model solver interface
+                MSI::Model_Solver_Interface* tModelSolverInterface = new MSI::Model_Solver_Interface(
+                        prm::create_msi_parameter_list(),
+                        tFEMModel,
+                        tInterpolationMesh );
+
+                tModelSolverInterface->finalize();
+
+                tFEMModel->finalize_equation_sets( tModelSolverInterface );
+
+                MSI::MSI_Solver_Interface* tSolverInterface = new MSI::MSI_Solver_Interface( tModelSolverInterface );
+
+                tSolverInterface->set_requested_dof_types( { MSI::Dof_Type::TEMP } );
+                tSolverInterface->set_time( { { 0.0 }, { 1.0 } } );
+
+                // both sets are built from parameter lists, use no fields and can be assembled concurrently
+                CHECK( tSolverInterface->is_concurrent_assembly_supported( 0 ) );
+                CHECK( tSolverInterface->is_concurrent_assembly_supported( 1 ) );
+
+                // set a non-trivial solution such that the residual does not vanish
+                sol::Matrix_Vector_Factory tMatFactory( sol::MapType::Epetra );
+
+                sol::Dist_Map* tFullMap = tMatFactory.create_full_map(
+                        tSolverInterface->get_my_local_global_map(),
+                        tSolverInterface->get_my_local_global_overlapping_map() );
+
+                sol::Dist_Vector* tFullVector = tMatFactory.create_vector( tSolverInterface, tFullMap, 1 );
+                tFullVector->random();
+
+                tSolverInterface->set_solution_vector( tFullVector );
+
+                // create the linear problem
+                dla::Solver_Factory  tSolFactory;
+                dla::Linear_Problem* tLinProblem = tSolFactory.create_linear_system( tSolverInterface, sol::MapType::Epetra );
+
+                // vectors to probe the jacobian with
+                sol::Dist_Map* tFreeMap = tMatFactory.create_map(
+                        tSolverInterface->get_my_local_global_map(),
+                        tSolverInterface->get_constrained_Ids() );
+
+                sol::Dist_Vector* tProbeVector  = tMatFactory.create_vector( tSolverInterface, tFreeMap, 1 );
+                sol::Dist_Vector* tResultVector = tMatFactory.create_vector( tSolverInterface, tFreeMap, 1 );
+                tProbeVector->random();
+
+                // assembles the jacobian and residual and extracts the residual, the jacobian times the probe vector and the diagonal
+                auto tAssemble = [ & ](
+                                         Matrix< DDRMat >& aResidual,
+                                         Matrix< DDRMat >& aJacobianTimesProbe,
+                                         Matrix< DDRMat >& aDiagonal )
+                {
+                    tLinProblem->assemble_jacobian();
+                    tLinProblem->assemble_residual();
+
+                    tLinProblem->get_solver_RHS()->extract_copy( aResidual );
+
+                    tLinProblem->get_matrix()->mat_vec_product( *tProbeVector, *tResultVector, false );
+                    tResultVector->extract_copy( aJacobianTimesProbe );
+
+                    tLinProblem->get_matrix()->get_diagonal( *tResultVector );
+                    tResultVector->extract_copy( aDiagonal );
+                };
+
+                // serial assembly
+                Matrix< DDRMat > tSerialResidual;
+                Matrix< DDRMat > tSerialJacobianTimesProbe;
+                Matrix< DDRMat > tSerialDiagonal;
+
+                tSolverInterface->set_assembly_parameters( 1, true );
+                tAssemble( tSerialResidual, tSerialJacobianTimesProbe, tSerialDiagonal );
+
+                REQUIRE( norm( tSerialResidual ) > 0.0 );
+                REQUIRE( norm( tSerialJacobianTimesProbe ) > 0.0 );
+
+                // deterministic threaded assembly scatters the element contributions in serial order
+                Matrix< DDRMat > tThreadedResidual;
+                Matrix< DDRMat > tThreadedJacobianTimesProbe;
+                Matrix< DDRMat > tThreadedDiagonal;
+
+                tSolverInterface->set_assembly_parameters( 4, true );
+                tAssemble( tThreadedResidual, tThreadedJacobianTimesProbe, tThreadedDiagonal );
+
+                CHECK( norm( tThreadedResidual - tSerialResidual ) == 0.0 );
+                CHECK( norm( tThreadedJacobianTimesProbe - tSerialJacobianTimesProbe ) == 0.0 );
+                CHECK( norm( tThreadedDiagonal - tSerialDiagonal ) == 0.0 );
+
+                // a second threaded assembly reuses the workspaces of the sets
+                tAssemble( tThreadedResidual, tThreadedJacobianTimesProbe, tThreadedDiagonal );
+
+                CHECK( norm( tThreadedResidual - tSerialResidual ) == 0.0 );
+                CHECK( norm( tThreadedJacobianTimesProbe - tSerialJacobianTimesProbe ) == 0.0 );
+                CHECK( norm( tThreadedDiagonal - tSerialDiagonal ) == 0.0 );
+
+                // clean up
+                delete tLinProblem;
+                delete tProbeVector;
+                delete tResultVector;
+                delete tFreeMap;
+                delete tFullVector;
+                delete tFullMap;
+                delete tSolverInterface;
+                delete tModelSolverInterface;
+                delete tInterpolationMesh;
+                delete tIntegrationMesh;
+            }
+        }
+    }    // namespace mdl
+}    // namespace moris
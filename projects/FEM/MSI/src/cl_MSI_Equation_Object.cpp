@@ -121,6 +121,7 @@ namespace moris
 
             // set size of vector containing this equation objects free pdofs
             mFreePdofs.reserve( tNumMyFreePdofs );
+            mFreePdofEntries.resize( mNumPdofSystems );
 
             // loop over pdof systems. Is one except for double sided clusters
             for ( uint Ia = 0; Ia < mNumPdofSystems; Ia++ )
@@ -129,15 +130,22 @@ namespace moris
 
                 // loop over all pdof types. Ask the first pdof host for the number of pdof types
                 uint tNumPdofTypes = ( mMyPdofHosts( Ia )( 0 )->get_pdof_hosts_pdof_list() ).size();
+                mFreePdofEntries( Ia ).resize( tNumPdofTypes );
+
                 for ( uint Ij = 0; Ij < tNumPdofTypes; Ij++ )
                 {
                     // loop over all time levels for this dof type
                     uint tNumTimeLevels = mMyPdofHosts( Ia )( 0 )->get_pdof_hosts_pdof_list()( Ij ).size();
+                    mFreePdofEntries( Ia )( Ij ).set_size( tNumTimeLevels, tNumMyPdofHosts );
+
                     for ( uint Ii = 0; Ii < tNumTimeLevels; Ii++ )
                     {
                         // loop over all pdof hosts and dof types. Appending the pdof pointers to the pdof list of this equation object
                         for ( uint Ik = 0; Ik < tNumMyPdofHosts; Ik++ )
                         {
+                            // store entry of this pdof in the elemental pdof value vector
+                            mFreePdofEntries( Ia )( Ij )( Ii, Ik ) = mFreePdofs.size();
+
                             // append all time levels of this pdof type
                             mFreePdofs.push_back( ( mMyPdofHosts( Ia )( Ik )->get_pdof_hosts_pdof_list() )(Ij)( Ii ) );
                         }
@@ -721,7 +729,7 @@ namespace moris
                         Cell< Cell< Matrix< DDRMat > > > tCoeff_Original;
 
                         this->get_my_pdof_values(
-                                mEquationSet->mPreviousAdjointPdofValues,
+                                mEquationSet->get_workspace().mPreviousAdjointPdofValues,
                                 tLeaderDofTypeList( Ik ),
                                 tCoeff_Original,
                                 mtk::Leader_Follower::LEADER );
@@ -881,7 +889,7 @@ namespace moris
                             // get the pdof values for the ith dof type group
                             Cell< Cell< Matrix< DDRMat > > > tCoeff_Original;
 
-                            this->get_my_pdof_values( mEquationSet->mAdjointPdofValues, tDofTypeGroup, tCoeff_Original, mtk::Leader_Follower::LEADER );
+                            this->get_my_pdof_values( mEquationSet->get_workspace().mAdjointPdofValues, tDofTypeGroup, tCoeff_Original, mtk::Leader_Follower::LEADER );
 
                             uint                     tNumRHS = tCoeff_Original.size();
                             Cell< Matrix< DDRMat > > tCoeff( tNumRHS );
@@ -934,7 +942,7 @@ namespace moris
                             // get the pdof values for the ith dof type group
                             Cell< Cell< Matrix< DDRMat > > > tCoeff_Original;
 
-                            this->get_my_pdof_values( mEquationSet->mAdjointPdofValues, tDofTypeGroup, tCoeff_Original, mtk::Leader_Follower::FOLLOWER );
+                            this->get_my_pdof_values( mEquationSet->get_workspace().mAdjointPdofValues, tDofTypeGroup, tCoeff_Original, mtk::Leader_Follower::FOLLOWER );
 
                             uint                     tNumRHS = tCoeff_Original.size();
                             Cell< Matrix< DDRMat > > tCoeff( tNumRHS );
@@ -998,7 +1006,7 @@ namespace moris
                             // get the pdof values for the ith dof type group
                             Cell< Cell< Matrix< DDRMat > > > tCoeff_Original;
 
-                            this->get_my_pdof_values( mEquationSet->mAdjointPdofValues, tDofTypeGroup, tCoeff_Original, mtk::Leader_Follower::LEADER );
+                            this->get_my_pdof_values( mEquationSet->get_workspace().mAdjointPdofValues, tDofTypeGroup, tCoeff_Original, mtk::Leader_Follower::LEADER );
 
                             uint                     tNumRHS = tCoeff_Original.size();
                             Cell< Matrix< DDRMat > > tCoeff( tNumRHS );
@@ -1053,7 +1061,7 @@ namespace moris
                             // get the pdof values for the ith dof type group
                             Cell< Cell< Matrix< DDRMat > > > tCoeff_Original;
 
-                            this->get_my_pdof_values( mEquationSet->mAdjointPdofValues, tDofTypeGroup, tCoeff_Original, mtk::Leader_Follower::FOLLOWER );
+                            this->get_my_pdof_values( mEquationSet->get_workspace().mAdjointPdofValues, tDofTypeGroup, tCoeff_Original, mtk::Leader_Follower::FOLLOWER );
 
                             uint                     tNumRHS = tCoeff_Original.size();
                             Cell< Matrix< DDRMat > > tCoeff( tNumRHS );
@@ -1107,18 +1115,19 @@ namespace moris
                             0,
                             tMyValues );
 
-            if ( mEquationSet->mPdofValues.size() != tMyValues.size() )
+            // get the pdof values of the calling thread
+            moris::Cell< Matrix< DDRMat > >& tPdofValues = mEquationSet->get_workspace().mPdofValues;
+
+            if ( tPdofValues.size() != tMyValues.size() )
             {
-                mEquationSet->mPdofValues.resize( tMyValues.size() );
+                tPdofValues.resize( tMyValues.size() );
             }
 
             // multiply t_matrix with adof values to get pdof values
             for ( uint Ik = 0; Ik < tMyValues.size(); Ik++ )
             {
-                mEquationSet->mPdofValues( Ik ) = tTMatrix * tMyValues( Ik );
+                tPdofValues( Ik ) = tTMatrix * tMyValues( Ik );
             }
-
-            this->set_vector_entry_number_of_pdof();    // FIXME should not be in MSI. Should be in FEM
         }
 
         //-------------------------------------------------------------------------------------------------
@@ -1138,19 +1147,19 @@ namespace moris
                     ->get_previous_solution_vector()
                     ->extract_my_values( tTMatrix.n_cols(), mUniqueAdofList, 0, tMyValues );
 
-            if ( mEquationSet->mPreviousPdofValues.size() != tMyValues.size() )
+            // get the previous pdof values of the calling thread
+            moris::Cell< Matrix< DDRMat > >& tPreviousPdofValues = mEquationSet->get_workspace().mPreviousPdofValues;
+
+            if ( tPreviousPdofValues.size() != tMyValues.size() )
             {
-                mEquationSet->mPreviousPdofValues.resize( tMyValues.size() );
+                tPreviousPdofValues.resize( tMyValues.size() );
             }
 
             // multiply t_matrix with adof values to get pdof values
             for ( uint Ik = 0; Ik < tMyValues.size(); Ik++ )
             {
-                mEquationSet->mPreviousPdofValues( Ik ) = tTMatrix * tMyValues( Ik );
+                tPreviousPdofValues( Ik ) = tTMatrix * tMyValues( Ik );
             }
-
-            // FIXME should not be in MSI. Should be in FEM
-            this->set_vector_entry_number_of_pdof();
         }
 
         //-------------------------------------------------------------------------------------------------
@@ -1170,19 +1179,19 @@ namespace moris
                     ->get_eigen_solution_vector()
                     ->extract_my_values( tTMatrix.n_cols(), mUniqueAdofList, 0, tMyValues );
 
-            if ( mEquationSet->mEigenVectorPdofValues.size() != tMyValues.size() )
+            // get the eigen vector pdof values of the calling thread
+            moris::Cell< Matrix< DDRMat > >& tEigenVectorPdofValues = mEquationSet->get_workspace().mEigenVectorPdofValues;
+
+            if ( tEigenVectorPdofValues.size() != tMyValues.size() )
             {
-                mEquationSet->mEigenVectorPdofValues.resize( tMyValues.size() );
+                tEigenVectorPdofValues.resize( tMyValues.size() );
             }
 
             // multiply t_matrix with adof values to get pdof values
             for ( uint Ik = 0; Ik < tMyValues.size(); Ik++ )
             {
-                mEquationSet->mEigenVectorPdofValues( Ik ) = tTMatrix * tMyValues( Ik );
+                tEigenVectorPdofValues( Ik ) = tTMatrix * tMyValues( Ik );
             }
-
-            // FIXME should not be in MSI. Should be in FEM
-            this->set_vector_entry_number_of_pdof();
         }
 
         //-------------------------------------------------------------------------------------------------
@@ -1202,19 +1211,19 @@ namespace moris
                     ->get_adjoint_solution_vector()
                     ->extract_my_values( tTMatrix.n_cols(), mUniqueAdofList, 0, tMyValues );
 
-            if ( mEquationSet->mAdjointPdofValues.size() != tMyValues.size() )
+            // get the adjoint pdof values of the calling thread
+            moris::Cell< Matrix< DDRMat > >& tAdjointPdofValues = mEquationSet->get_workspace().mAdjointPdofValues;
+
+            if ( tAdjointPdofValues.size() != tMyValues.size() )
             {
-                mEquationSet->mAdjointPdofValues.resize( tMyValues.size() );
+                tAdjointPdofValues.resize( tMyValues.size() );
             }
 
             // multiply t_matrix with adof values to get pdof values
             for ( uint Ik = 0; Ik < tMyValues.size(); Ik++ )
             {
-                mEquationSet->mAdjointPdofValues( Ik ) = tTMatrix * tMyValues( Ik );
+                tAdjointPdofValues( Ik ) = tTMatrix * tMyValues( Ik );
             }
-
-            // FIXME should not be in MSI. Should be in FEM
-            this->set_vector_entry_number_of_pdof();
         }
 
         //-------------------------------------------------------------------------------------------------
@@ -1232,18 +1241,19 @@ namespace moris
             // Extract this equation objects adof values from solution vector
             mEquationSet->mEquationModel->get_previous_adjoint_solution_vector()->extract_my_values( tTMatrix.n_cols(), mUniqueAdofList, 0, tMyValues );
 
-            if ( mEquationSet->mPreviousAdjointPdofValues.size() != tMyValues.size() )
+            // get the previous adjoint pdof values of the calling thread
+            moris::Cell< Matrix< DDRMat > >& tPreviousAdjointPdofValues = mEquationSet->get_workspace().mPreviousAdjointPdofValues;
+
+            if ( tPreviousAdjointPdofValues.size() != tMyValues.size() )
             {
-                mEquationSet->mPreviousAdjointPdofValues.resize( tMyValues.size() );
+                tPreviousAdjointPdofValues.resize( tMyValues.size() );
             }
 
             // multiply t_matrix with adof values to get pdof values
             for ( uint Ik = 0; Ik < tMyValues.size(); Ik++ )
             {
-                mEquationSet->mPreviousAdjointPdofValues( Ik ) = tTMatrix * tMyValues( Ik );
+                tPreviousAdjointPdofValues( Ik ) = tTMatrix * tMyValues( Ik );
             }
-
-            this->set_vector_entry_number_of_pdof();    // FIXME should not be in MSI. Should be in FEM
         }
 
         //-------------------------------------------------------------------------------------------------
@@ -1424,11 +1434,9 @@ namespace moris
                         // Check if number of time levels on this dof type is smaller than maximal number of time levels on dof type
                         if ( (sint)mMyPdofHosts( tIsLeader )( Ik )->get_num_time_levels_of_type( tDofTypeIndex ) == tMaxTimeLevelsOnDofType )
                         {
-                            // get pointer list all time pdofs on this pdof type
-                            moris::Cell< Pdof* > tPdofTimeList = mMyPdofHosts( tIsLeader )( Ik )->get_pdof_time_list( tDofTypeIndex );
-
-                            // get entry number of this pdof in the elemental pdof value vector
-                            uint tElementalSolVecEntry = tPdofTimeList( Ia )->mElementalSolVecEntry;
+                            // get entry number of this pdof in the elemental pdof value vector, stored per
+                            // equation object since pdofs are shared between equation objects assembled concurrently
+                            uint tElementalSolVecEntry = mFreePdofEntries( tIsLeader )( tDofTypeIndex )( Ia, Ik );
 
                             for ( uint Ib = 0; Ib < tNumVectors; Ib++ )
                             {
@@ -1486,17 +1494,5 @@ namespace moris
             }
         }
 
-        //-------------------------------------------------------------------------------------------------
-
-        void
-        Equation_Object::set_vector_entry_number_of_pdof()
-        {
-            uint tNumMyPdofs = mFreePdofs.size();
-            // Loop over all pdofs of this element
-            for ( uint Ik = 0; Ik < tNumMyPdofs; Ik++ )
-            {
-                mFreePdofs( Ik )->mElementalSolVecEntry = Ik;
-            }
-        }
     }    // namespace MSI
 }    // namespace moris
@@ -65,6 +65,7 @@ namespace moris
 
             moris::Cell< Pdof* >                               mFreePdofs;       // List of the pdof pointers of this equation obj
             moris::Cell< moris::Cell< moris::Cell< Pdof* > > > mFreePdofList;    // FIXME list of free pdofs ordered after their dof type . mFreePdofs or mFreePdofList should be deleted
+            moris::Cell< moris::Cell< Matrix< DDUMat > > >     mFreePdofEntries;    // entry of each free pdof in mFreePdofs, ( pdof system )( pdof type )( time level, pdof host )
 
             Matrix< DDSMat >                               mUniqueAdofList;    // Unique adof list for this equation object
             moris::Cell< moris::Cell< Matrix< DDSMat > > > mUniqueAdofTypeList;
@@ -294,12 +295,6 @@ namespace moris
                     const Cell< Matrix< DDRMat > >& aPdofValues,
                     Matrix< DDRMat >&               aReshapedPdofValues );
 
-            //------------------------------------------------------------------------------
-            /**
-             * FIXME doc????
-             */
-            void set_vector_entry_number_of_pdof();
-
             //------------------------------------------------------------------------------
             /**
              * get jacobian for equation object
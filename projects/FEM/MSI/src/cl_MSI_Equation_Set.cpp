@@ -421,43 +421,29 @@ namespace moris
 
         //------------------------------------------------------------------------------
 
-        void Equation_Set::free_matrix_memory()
+        void Equation_Set::free_matrix_memory( const bool aKeepCapacity )
         {
-            // if the Jacobian matrix was created
-            if ( mJacobianExist )
+            // reset the buffers of the first thread
+            if ( aKeepCapacity )
             {
-                // resize it to 0x0
-                mJacobian.set_size( 0, 0 );
-
-                // reset the exist flag
-                mJacobianExist = false;
+                this->reset();
             }
-
-            // if the residual cell of matrices was created
-            if ( mResidualExist )
+            else
             {
-                // resize each matrix to 0x0
-                for( auto & tResidual : mResidual )
-                {
-                    tResidual.set_size( 0, 0 );
-                }
-                mResidual.clear();
-
-                // reset the exist flag
-                mResidualExist = false;
+                this->free();
             }
 
-            if ( mQIExist )
+            // reset the buffers of all other workspaces
+            for ( Equation_Set_Workspace& tWorkspace : mWorkspaces )
             {
-//                // resize each matrix to 0x0
-//                for( auto & tQI : mQI )
-//                {
-//                    tQI.resize( 0, 0 );
-//                }
-//                mQI.clear();
-
-                // reset the exist flag
-                mQIExist = false;
+                if ( aKeepCapacity )
+                {
+                    tWorkspace.reset();
+                }
+                else
+                {
+                    tWorkspace.free();
+                }
             }
 
             mIsStaggered = false;
@@ -17,6 +17,7 @@
 #include "cl_MTK_Enums.hpp"
 #include "cl_FEM_Enums.hpp"
 #include "cl_GEN_Pdv_Enums.hpp"
+#include "cl_MSI_Equation_Set_Workspace.hpp"
 
 
 namespace moris
@@ -48,19 +49,19 @@ namespace moris
         //------------------------------------------------------------------------------
         /**
          * \brief Equation Set class
+         *
+         * The set is the evaluation workspace of the first thread. Workspaces for further
+         * threads are created by create_workspaces().
          */
-        class Equation_Set
+        class Equation_Set : protected Equation_Set_Workspace
         {
           private:
 
           protected:
             moris::Cell< MSI::Equation_Object* > mEquationObjList;
 
-            moris::Cell< Matrix< DDRMat > >                mResidual;
-            Matrix< DDRMat >                               mJacobian;
-            moris::Cell< Matrix< DDRMat > >                mQI;
-            moris::Cell< Matrix< DDRMat > >                mdRdp;
-            moris::Cell< moris::Cell< Matrix< DDRMat > > > mdQIdp;
+            // evaluation workspaces of the worker threads other than the first one
+            moris::Cell< Equation_Set_Workspace > mWorkspaces;
 
             // lists of leader and follower groups of dof types
             moris::Cell< moris::Cell< enum MSI::Dof_Type > > mLeaderDofTypes;
@@ -102,13 +103,6 @@ namespace moris
             // However as long as we go by name I do not see another way.
             moris::map< std::string, moris_index > mRequestedIQINamesAssemblyMap;
 
-            // initialization flag for jacobian, residual, QI, dRdp, dQIdp
-            bool mJacobianExist = false;
-            bool mResidualExist = false;
-            bool mQIExist       = false;
-            bool mdRdpMatExist  = false;
-            bool mdQIdpMatExist = false;
-
             // bool for time continuity
             bool mIsStaggered = false;
 
@@ -140,21 +134,6 @@ namespace moris
 
             MSI::Equation_Model* mEquationModel = nullptr;
 
-            //! actual pdof values. Cells are for different multi-vectors
-            moris::Cell< Matrix< DDRMat > > mPdofValues;
-
-            //! previous pdof values
-            moris::Cell< Matrix< DDRMat > > mPreviousPdofValues;
-
-            //! adjoint pdof values
-            moris::Cell< Matrix< DDRMat > > mAdjointPdofValues;
-
-            //! previous adjoint pdof values
-            moris::Cell< Matrix< DDRMat > > mPreviousAdjointPdofValues;
-
-            //! previous adjoint pdof values
-            moris::Cell< Matrix< DDRMat > > mEigenVectorPdofValues;
-
             friend class MSI::Equation_Object;
             friend class Element_Bulk;
             friend class Element_Sideset;
@@ -303,12 +282,61 @@ namespace moris
                     enum mtk::Field_Type aFieldType,
                     mtk::Leader_Follower    aIsLeader = mtk::Leader_Follower::LEADER );
 
+            //-------------------------------------------------------------------------------------------------
+            /**
+             * get the workspace of the calling thread
+             */
+            Equation_Set_Workspace&
+            get_workspace()
+            {
+                uint tWorkspaceIndex = get_workspace_index();
+
+                // the first thread works on the set itself
+                if ( tWorkspaceIndex == 0 )
+                {
+                    return *this;
+                }
+
+                MORIS_ERROR( tWorkspaceIndex <= mWorkspaces.size(),
+                        "Equation_Set::get_workspace - no workspace created for thread %i.",
+                        tWorkspaceIndex );
+
+                return mWorkspaces( tWorkspaceIndex - 1 );
+            }
+
+            //-------------------------------------------------------------------------------------------------
+            /**
+             * create one workspace per worker thread.
+             * Existing workspaces are kept, additional ones are initialized on first use.
+             * @param[ in ] aNumWorkspaces number of workspaces, including the one of the first thread
+             */
+            virtual void
+            create_workspaces( const uint aNumWorkspaces )
+            {
+                if ( mWorkspaces.size() + 1 < aNumWorkspaces )
+                {
+                    mWorkspaces.resize( aNumWorkspaces - 1 );
+                }
+            }
+
+            //-------------------------------------------------------------------------------------------------
+            /**
+             * returns if equation objects of this set can be evaluated concurrently,
+             * i.e. if all per-evaluation state is held in workspaces
+             */
+            virtual bool
+            supports_concurrent_evaluation()
+            {
+                return false;
+            }
+
             //-------------------------------------------------------------------------------------------------
             /**
              * free matrix memory,
-             * i.e. free residual and jacobian matrices
+             * i.e. reset residual and jacobian matrices of all workspaces
+             * @param[ in ] aKeepCapacity if true, the jacobian memory is kept for the next assembly
              */
-            void free_matrix_memory();
+            void free_matrix_memory( const bool aKeepCapacity = true );
 
             //-------------------------------------------------------------------------------------------------
             /**
@@ -360,7 +388,7 @@ namespace moris
             Cell< Matrix< DDRMat > >&
             get_residual()
             {
-                return mResidual;
+                return this->get_workspace().mResidual;
             }
 
             //------------------------------------------------------------------------------
@@ -380,7 +408,7 @@ namespace moris
             Cell< Matrix< DDRMat > >&
             get_QI()
             {
-                return mQI;
+                return this->get_workspace().mQI;
             }
 
             //-------------------------------------------------------------------------------------------------
@@ -408,7 +436,7 @@ namespace moris
             Matrix< DDRMat >&
             get_jacobian()
             {
-                return mJacobian;
+                return this->get_workspace().mJacobian;
             }
 
             //------------------------------------------------------------------------------
@@ -428,7 +456,7 @@ namespace moris
             moris::Cell< Matrix< DDRMat > >&
             get_drdp()
             {
-                return mdRdp;
+                return this->get_workspace().mdRdp;
             }
 
             //-------------------------------------------------------------------------------------------------
@@ -438,7 +466,7 @@ namespace moris
             Matrix< DDRMat >&
             get_drdpmat()
             {
-                return mdRdp( 0 );
+                return this->get_workspace().mdRdp( 0 );
             }
 
             //------------------------------------------------------------------------------
@@ -468,7 +496,7 @@ namespace moris
             Matrix< DDRMat >&
             get_drdpgeo()
             {
-                return mdRdp( 1 );
+                return this->get_workspace().mdRdp( 1 );
             }
 
             //------------------------------------------------------------------------------
@@ -508,7 +536,7 @@ namespace moris
             moris::Cell< moris::Cell< Matrix< DDRMat > > >&
             get_dqidp()
             {
-                return mdQIdp;
+                return this->get_workspace().mdQIdp;
             }
 
             //-----------------------------------------------------------------------------------------
@@ -518,7 +546,7 @@ namespace moris
             moris::Cell< Matrix< DDRMat > >&
             get_dqidpmat()
             {
-                return mdQIdp( 0 );
+                return this->get_workspace().mdQIdp( 0 );
             }
 
             //-----------------------------------------------------------------------------------------
@@ -528,7 +556,7 @@ namespace moris
             moris::Cell< Matrix< DDRMat > >&
             get_dqidpgeo()
             {
-                return mdQIdp( 1 );
+                return this->get_workspace().mdQIdp( 1 );
             }
 
             //-----------------------------------------------------------------------------------------
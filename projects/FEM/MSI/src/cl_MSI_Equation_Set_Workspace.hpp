@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_MSI_Equation_Set_Workspace.hpp
+ *
+ */
+
+#ifndef SRC_FEM_CL_MSI_EQUATION_SET_WORKSPACE_HPP_
+#define SRC_FEM_CL_MSI_EQUATION_SET_WORKSPACE_HPP_
+
+#include "typedefs.hpp"           // COR/src
+#include "fn_thread_index.hpp"    // COR/src
+#include "cl_Cell.hpp"
+#include "cl_Matrix.hpp"
+#include "linalg_typedefs.hpp"
+
+namespace moris
+{
+    namespace MSI
+    {
+        //------------------------------------------------------------------------------
+        /**
+         * \brief Per-evaluation state of an equation set
+         *
+         * Holds the element level buffers that are filled while evaluating one equation
+         * object of a set, i.e. the pdof values of the equation object, residual, jacobian,
+         * QI and their sensitivities. The equation set itself is the workspace of the first
+         * thread and owns one additional workspace per further worker thread, such that
+         * equation objects of the same set can be evaluated concurrently.
+         */
+        struct Equation_Set_Workspace
+        {
+            moris::Cell< Matrix< DDRMat > >                mResidual;
+            Matrix< DDRMat >                               mJacobian;
+            moris::Cell< Matrix< DDRMat > >                mQI;
+            moris::Cell< Matrix< DDRMat > >                mdRdp;
+            moris::Cell< moris::Cell< Matrix< DDRMat > > > mdQIdp;
+
+            //! actual pdof values. Cells are for different multi-vectors
+            moris::Cell< Matrix< DDRMat > > mPdofValues;
+
+            //! previous pdof values
+            moris::Cell< Matrix< DDRMat > > mPreviousPdofValues;
+
+            //! adjoint pdof values
+            moris::Cell< Matrix< DDRMat > > mAdjointPdofValues;
+
+            //! previous adjoint pdof values
+            moris::Cell< Matrix< DDRMat > > mPreviousAdjointPdofValues;
+
+            //! eigen vector pdof values
+            moris::Cell< Matrix< DDRMat > > mEigenVectorPdofValues;
+
+            // initialization flag for jacobian, residual, QI, dRdp, dQIdp
+            bool mJacobianExist = false;
+            bool mResidualExist = false;
+            bool mQIExist       = false;
+            bool mdRdpMatExist  = false;
+            bool mdQIdpMatExist = false;
+
+            //------------------------------------------------------------------------------
+            /**
+             * mark the buffers for re-initialization before the next evaluation.
+             * The jacobian keeps its memory as it is resized on re-initialization.
+             */
+            void
+            reset()
+            {
+                // keep the jacobian allocated, it is resized on the next initialization
+                mJacobianExist = false;
+
+                // if the residual cell of matrices was created
+                if ( mResidualExist )
+                {
+                    // resize each matrix to 0x0
+                    for ( auto& tResidual : mResidual )
+                    {
+                        tResidual.set_size( 0, 0 );
+                    }
+                    mResidual.clear();
+
+                    // reset the exist flag
+                    mResidualExist = false;
+                }
+
+                // reset the QI exist flag
+                mQIExist = false;
+            }
+
+            //------------------------------------------------------------------------------
+            /**
+             * release all memory held by the buffers
+             */
+            void
+            free()
+            {
+                this->reset();
+
+                mJacobian.set_size( 0, 0 );
+            }
+        };
+
+        //------------------------------------------------------------------------------
+        /**
+         * returns the index of the workspace used by the calling thread
+         */
+        inline uint
+        get_workspace_index()
+        {
+            return moris::get_thread_index();
+        }
+
+        //------------------------------------------------------------------------------
+    }    // namespace MSI
+} /* namespace moris */
+
+#endif /* SRC_FEM_CL_MSI_EQUATION_SET_WORKSPACE_HPP_ */
@@ -40,8 +40,6 @@ namespace moris
             Matrix< DDSMat > mAdofIds;
             Matrix< DDRMat > mTmatrix;
 
-            uint mElementalSolVecEntry;
-
             moris::Cell< Adof* > mAdofPtrList;    // FIXME: delete this list after call to get adof ids or replace it
         };
 
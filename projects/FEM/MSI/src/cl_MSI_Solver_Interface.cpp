@@ -281,6 +281,12 @@ namespace moris
             // This is meant for the mapper solver since it is working with Trillions
             if ( !mSolverWarehouse ) return;
 
+            // reuse the sparsity pattern if the requested dof types did not change
+            if ( mIsSparsityPatternCached && mSparsityPatternDofTypes.data() == mListOfDofTypes.data() )
+            {
+                return;
+            }
+
             /* ---------------------------------------------------------------------------------------- */
             /* Step 0: build the comm map  */
 
@@ -544,6 +550,10 @@ namespace moris
                 mNonZeroDigonal( iRowNum )    = std::distance( tOwnedRows( iRowNum ).begin(), tOwnedUnique );
                 mNonZeroOffDigonal( iRowNum ) = std::distance( tSharedRows( iRowNum ).begin(), tSharedUnique );
             }
+
+            // store dof types the sparsity pattern was computed for
+            mSparsityPatternDofTypes = mListOfDofTypes;
+            mIsSparsityPatternCached = this->get_reuse_matrix_graph();
         }
 
         //-------------------------------------------------------------------------------------------------------
@@ -56,6 +56,11 @@ namespace moris
             moris::Cell< enum MSI::Dof_Type > mListOfDofTypes;
             moris::Cell< enum MSI::Dof_Type > mListOfSecondaryDofTypes;
 
+            // dof types the cached sparsity pattern was computed for. The pattern is built from the adofs of
+            // this interface's DOF manager, the interface is recreated with the mesh when remeshing.
+            moris::Cell< enum MSI::Dof_Type > mSparsityPatternDofTypes;
+            bool                              mIsSparsityPatternCached = false;
+
             mdl::Model* mModel = nullptr;
 
           public:
@@ -275,6 +280,24 @@ namespace moris
 
             //------------------------------------------------------------------------------
 
+            bool
+            is_concurrent_assembly_supported( const uint aMyEquSetInd ) override
+            {
+                return mMSI->get_equation_set( aMyEquSetInd )->supports_concurrent_evaluation();
+            };
+
+            //------------------------------------------------------------------------------
+
+            void
+            prepare_concurrent_assembly(
+                    const uint aMyEquSetInd,
+                    const uint aNumThreads ) override
+            {
+                mMSI->get_equation_set( aMyEquSetInd )->create_workspaces( aNumThreads );
+            };
+
+            //------------------------------------------------------------------------------
+
             moris::uint
             get_num_my_dofs()
             {
@@ -562,6 +585,17 @@ namespace moris
 
             //------------------------------------------------------------------------------
 
+            void
+            reset_matrix_graph_cache() override
+            {
+                Solver_Interface::reset_matrix_graph_cache();
+
+                mSparsityPatternDofTypes.clear();
+                mIsSparsityPatternCached = false;
+            };
+
+            //------------------------------------------------------------------------------
+
             /**
              * @brief initial estimate size of the stencil based on the spatial dimension and
              *
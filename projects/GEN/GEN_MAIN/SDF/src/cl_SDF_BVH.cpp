@@ -0,0 +1,311 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_SDF_BVH.cpp
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#include "cl_SDF_BVH.hpp"
+#include "assert.hpp"
+
+namespace moris
+{
+    namespace sdf
+    {
+        // maximum depth of the tree, limits the traversal stack
+        const uint gBVHMaxDepth = 64;
+
+        //-------------------------------------------------------------------------------
+
+        BVH::BVH( const uint aMaxLeafSize )
+                : mMaxLeafSize( std::max( aMaxLeafSize, ( uint ) 1 ) )
+        {
+        }
+
+        //-------------------------------------------------------------------------------
+
+        void
+        BVH::build( const moris::Cell< Triangle* >& aTriangles )
+        {
+            uint tNumberOfTriangles = aTriangles.size();
+
+            mNodes.clear();
+            mDepth = 0;
+
+            // the tree never has more than twice as many nodes as triangles
+            mNodes.reserve( 2 * tNumberOfTriangles );
+
+            // initialize triangle order
+            mTriangleIndices.resize( tNumberOfTriangles, 0 );
+            std::iota( mTriangleIndices.begin(), mTriangleIndices.end(), 0 );
+
+            // centers of the triangle bounding boxes used for splitting
+            moris::Cell< real > tCenters( 3 * tNumberOfTriangles, 0.0 );
+
+            for ( uint k = 0; k < tNumberOfTriangles; ++k )
+            {
+                for ( uint i = 0; i < 3; ++i )
+                {
+                    tCenters( 3 * k + i ) = 0.5 * ( aTriangles( k )->get_min_coord( i ) + aTriangles( k )->get_max_coord( i ) );
+                }
+            }
+
+            if ( tNumberOfTriangles > 0 )
+            {
+                this->build_node( aTriangles, tCenters, 0, tNumberOfTriangles, 1 );
+            }
+
+            MORIS_ERROR( mDepth <= gBVHMaxDepth,
+                    "BVH::build() - depth of tree exceeds maximum of %u", gBVHMaxDepth );
+
+            // copy bounding boxes of triangles into tree order
+            mTriangleMinCoords.resize( 3 * tNumberOfTriangles, 0.0 );
+            mTriangleMaxCoords.resize( 3 * tNumberOfTriangles, 0.0 );
+
+            for ( uint k = 0; k < tNumberOfTriangles; ++k )
+            {
+                Triangle* tTriangle = aTriangles( mTriangleIndices( k ) );
+
+                for ( uint i = 0; i < 3; ++i )
+                {
+                    mTriangleMinCoords( 3 * k + i ) = tTriangle->get_min_coord( i );
+                    mTriangleMaxCoords( 3 * k + i ) = tTriangle->get_max_coord( i );
+                }
+            }
+        }
+
+        //-------------------------------------------------------------------------------
+
+        uint
+        BVH::build_node(
+                const moris::Cell< Triangle* >& aTriangles,
+                moris::Cell< real >&            aCenters,
+                const uint                      aFirst,
+                const uint                      aLast,
+                const uint                      aLevel )
+        {
+            mDepth = std::max( mDepth, aLevel );
+
+            // reserve slot for this node, children are appended behind it
+            uint tNodeIndex = mNodes.size();
+            mNodes.push_back( Node() );
+
+            Node tNode;
+
+            // bounding box of triangles and of their centers
+            real tCenterMin[ 3 ];
+            real tCenterMax[ 3 ];
+
+            for ( uint i = 0; i < 3; ++i )
+            {
+                tNode.mMinCoord[ i ] = std::numeric_limits< real >::max();
+                tNode.mMaxCoord[ i ] = -std::numeric_limits< real >::max();
+                tCenterMin[ i ]      = std::numeric_limits< real >::max();
+                tCenterMax[ i ]      = -std::numeric_limits< real >::max();
+            }
+
+            for ( uint k = aFirst; k < aLast; ++k )
+            {
+                uint      tTriangleIndex = mTriangleIndices( k );
+                Triangle* tTriangle      = aTriangles( tTriangleIndex );
+
+                for ( uint i = 0; i < 3; ++i )
+                {
+                    tNode.mMinCoord[ i ] = std::min( tNode.mMinCoord[ i ], tTriangle->get_min_coord( i ) );
+                    tNode.mMaxCoord[ i ] = std::max( tNode.mMaxCoord[ i ], tTriangle->get_max_coord( i ) );
+                    tCenterMin[ i ]      = std::min( tCenterMin[ i ], aCenters( 3 * tTriangleIndex + i ) );
+                    tCenterMax[ i ]      = std::max( tCenterMax[ i ], aCenters( 3 * tTriangleIndex + i ) );
+                }
+            }
+
+            // split along the direction with the largest extent of the centers
+            uint tSplitAxis = 0;
+            for ( uint i = 1; i < 3; ++i )
+            {
+                if ( tCenterMax[ i ] - tCenterMin[ i ] > tCenterMax[ tSplitAxis ] - tCenterMin[ tSplitAxis ] )
+                {
+                    tSplitAxis = i;
+                }
+            }
+
+            uint tNumberOfTriangles = aLast - aFirst;
+
+            // create leaf if few triangles are left or if all centers coincide
+            if ( tNumberOfTriangles <= mMaxLeafSize || tCenterMax[ tSplitAxis ] <= tCenterMin[ tSplitAxis ] )
+            {
+                tNode.mFirst = aFirst;
+                tNode.mCount = tNumberOfTriangles;
+
+                mNodes( tNodeIndex ) = tNode;
+
+                return tNodeIndex;
+            }
+
+            // median split
+            uint tMiddle = aFirst + tNumberOfTriangles / 2;
+
+            std::nth_element(
+                    mTriangleIndices.begin() + aFirst,
+                    mTriangleIndices.begin() + tMiddle,
+                    mTriangleIndices.begin() + aLast,
+                    [ &aCenters, tSplitAxis ]( const uint aA, const uint aB ) {
+                        return aCenters( 3 * aA + tSplitAxis ) < aCenters( 3 * aB + tSplitAxis );
+                    } );
+
+            // left child directly follows this node
+            this->build_node( aTriangles, aCenters, aFirst, tMiddle, aLevel + 1 );
+
+            tNode.mRightChild = this->build_node( aTriangles, aCenters, tMiddle, aLast, aLevel + 1 );
+
+            mNodes( tNodeIndex ) = tNode;
+
+            return tNodeIndex;
+        }
+
+        //-------------------------------------------------------------------------------
+
+        void
+        BVH::find_triangles_along_ray(
+                const uint               aAxis,
+                const Matrix< F31RMat >& aPoint,
+                const real               aEpsilon,
+                moris::Cell< uint >&     aTriangleIndices ) const
+        {
+            aTriangleIndices.clear();
+
+            if ( mNodes.size() == 0 )
+            {
+                return;
+            }
+
+            // directions orthogonal to the ray
+            const uint tI = ( aAxis + 1 ) % 3;
+            const uint tJ = ( aAxis + 2 ) % 3;
+
+            const real tPointI = aPoint( tI );
+            const real tPointJ = aPoint( tJ );
+
+            // ( p - min ) * ( max - p ) > -eps can only hold if p is less than sqrt( eps ) outside of the box
+            const real tTolerance = std::sqrt( std::max( aEpsilon, 0.0 ) );
+
+            uint tStack[ gBVHMaxDepth + 1 ];
+            uint tStackSize = 0;
+
+            tStack[ tStackSize++ ] = 0;
+
+            while ( tStackSize > 0 )
+            {
+                uint        tNodeIndex = tStack[ --tStackSize ];
+                const Node& tNode      = mNodes( tNodeIndex );
+
+                if ( tPointI < tNode.mMinCoord[ tI ] - tTolerance || tPointI > tNode.mMaxCoord[ tI ] + tTolerance
+                        || tPointJ < tNode.mMinCoord[ tJ ] - tTolerance || tPointJ > tNode.mMaxCoord[ tJ ] + tTolerance )
+                {
+                    continue;
+                }
+
+                if ( tNode.is_leaf() )
+                {
+                    for ( uint k = tNode.mFirst; k < tNode.mFirst + tNode.mCount; ++k )
+                    {
+                        // same test as the linear preselection
+                        if ( ( tPointJ - mTriangleMinCoords( 3 * k + tJ ) ) * ( mTriangleMaxCoords( 3 * k + tJ ) - tPointJ ) > -aEpsilon
+                                && ( tPointI - mTriangleMinCoords( 3 * k + tI ) ) * ( mTriangleMaxCoords( 3 * k + tI ) - tPointI ) > -aEpsilon )
+                        {
+                            aTriangleIndices.push_back( mTriangleIndices( k ) );
+                        }
+                    }
+                }
+                else
+                {
+                    tStack[ tStackSize++ ] = tNode.mRightChild;
+                    tStack[ tStackSize++ ] = tNodeIndex + 1;
+                }
+            }
+
+            std::sort( aTriangleIndices.begin(), aTriangleIndices.end() );
+        }
+
+        //-------------------------------------------------------------------------------
+
+        void
+        BVH::find_triangles_near_point(
+                const Matrix< F31RMat >& aPoint,
+                const real               aBuffer,
+                moris::Cell< uint >&     aTriangleIndices ) const
+        {
+            aTriangleIndices.clear();
+
+            if ( mNodes.size() == 0 )
+            {
+                return;
+            }
+
+            const real tPoint[ 3 ] = { aPoint( 0 ), aPoint( 1 ), aPoint( 2 ) };
+
+            uint tStack[ gBVHMaxDepth + 1 ];
+            uint tStackSize = 0;
+
+            tStack[ tStackSize++ ] = 0;
+
+            while ( tStackSize > 0 )
+            {
+                uint        tNodeIndex = tStack[ --tStackSize ];
+                const Node& tNode      = mNodes( tNodeIndex );
+
+                bool tIsInside = true;
+                for ( uint i = 0; i < 3; ++i )
+                {
+                    if ( tPoint[ i ] < tNode.mMinCoord[ i ] - aBuffer || tPoint[ i ] > tNode.mMaxCoord[ i ] + aBuffer )
+                    {
+                        tIsInside = false;
+                        break;
+                    }
+                }
+
+                if ( !tIsInside )
+                {
+                    continue;
+                }
+
+                if ( tNode.is_leaf() )
+                {
+                    for ( uint k = tNode.mFirst; k < tNode.mFirst + tNode.mCount; ++k )
+                    {
+                        bool tTriangleIsNear = true;
+                        for ( uint i = 0; i < 3; ++i )
+                        {
+                            if ( tPoint[ i ] < mTriangleMinCoords( 3 * k + i ) - aBuffer || tPoint[ i ] > mTriangleMaxCoords( 3 * k + i ) + aBuffer )
+                            {
+                                tTriangleIsNear = false;
+                                break;
+                            }
+                        }
+
+                        if ( tTriangleIsNear )
+                        {
+                            aTriangleIndices.push_back( mTriangleIndices( k ) );
+                        }
+                    }
+                }
+                else
+                {
+                    tStack[ tStackSize++ ] = tNode.mRightChild;
+                    tStack[ tStackSize++ ] = tNodeIndex + 1;
+                }
+            }
+
+            std::sort( aTriangleIndices.begin(), aTriangleIndices.end() );
+        }
+
+        //-------------------------------------------------------------------------------
+    } /* namespace sdf */
+} /* namespace moris */
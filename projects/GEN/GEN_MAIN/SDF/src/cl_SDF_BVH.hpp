@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_SDF_BVH.hpp
+ *
+ */
+
+#ifndef PROJECTS_GEN_SDF_SRC_CL_SDF_BVH_HPP_
+#define PROJECTS_GEN_SDF_SRC_CL_SDF_BVH_HPP_
+
+#include "typedefs.hpp"
+#include "cl_Cell.hpp"
+#include "cl_Matrix.hpp"
+#include "linalg_typedefs.hpp"
+
+#include "cl_SDF_Triangle.hpp"
+
+namespace moris
+{
+    namespace sdf
+    {
+        //-------------------------------------------------------------------------------
+
+        /**
+         * Bounding volume hierarchy over the axis aligned bounding boxes of the
+         * triangles of an object. The tree is stored as a flat array of nodes in
+         * depth first order, i.e. the left child of a node directly follows its parent.
+         *
+         * All queries return triangle indices sorted in ascending order such that
+         * the results are identical to a linear search over all triangles.
+         */
+        class BVH
+        {
+            struct Node
+            {
+                // bounding box of all triangles in this node
+                real mMinCoord[ 3 ];
+                real mMaxCoord[ 3 ];
+
+                // first entry in mTriangleIndices and number of triangles, leafs only
+                uint mFirst = 0;
+                uint mCount = 0;
+
+                // index of the right child, the left child is the next node
+                uint mRightChild = 0;
+
+                bool
+                is_leaf() const
+                {
+                    return mCount > 0;
+                }
+            };
+
+            // maximum number of triangles in a leaf
+            const uint mMaxLeafSize;
+
+            // nodes of the tree, the root is the first entry
+            moris::Cell< Node > mNodes;
+
+            // triangle indices, sorted such that each leaf references a contiguous range
+            moris::Cell< uint > mTriangleIndices;
+
+            // bounding boxes of triangles, stored in the order of mTriangleIndices
+            moris::Cell< real > mTriangleMinCoords;
+            moris::Cell< real > mTriangleMaxCoords;
+
+            // depth of the tree
+            uint mDepth = 0;
+
+            //-------------------------------------------------------------------------------
+
+          public:
+            //-------------------------------------------------------------------------------
+
+            BVH( const uint aMaxLeafSize = 4 );
+
+            //-------------------------------------------------------------------------------
+
+            ~BVH(){};
+
+            //-------------------------------------------------------------------------------
+
+            /**
+             * (re-)builds the tree from the current bounding boxes of the triangles.
+             * Must be called again whenever the triangles have moved.
+             *
+             * @param aTriangles triangles of the object, indexed by their position in the cell
+             */
+            void
+            build( const moris::Cell< Triangle* >& aTriangles );
+
+            //-------------------------------------------------------------------------------
+
+            /**
+             * finds all triangles whose bounding box is hit by a ray through aPoint
+             * parallel to the coordinate axis aAxis. Uses the same criterion as the linear
+             * triangle preselection, i.e. ( p - min ) * ( max - p ) > -aEpsilon in both
+             * directions orthogonal to the ray.
+             *
+             * @param aAxis coordinate axis of the ray
+             * @param aPoint point on the ray
+             * @param aEpsilon tolerance of the bounding box test
+             * @param aTriangleIndices sorted indices of candidate triangles
+             */
+            void
+            find_triangles_along_ray(
+                    const uint               aAxis,
+                    const Matrix< F31RMat >& aPoint,
+                    const real               aEpsilon,
+                    moris::Cell< uint >&     aTriangleIndices ) const;
+
+            //-------------------------------------------------------------------------------
+
+            /**
+             * finds all triangles whose bounding box, grown by aBuffer, contains aPoint.
+             * The closest triangle to aPoint is among them if it is closer than aBuffer.
+             *
+             * @param aPoint point to be tested
+             * @param aBuffer distance the triangle bounding boxes are grown by
+             * @param aTriangleIndices sorted indices of candidate triangles
+             */
+            void
+            find_triangles_near_point(
+                    const Matrix< F31RMat >& aPoint,
+                    const real               aBuffer,
+                    moris::Cell< uint >&     aTriangleIndices ) const;
+
+            //-------------------------------------------------------------------------------
+
+            uint
+            get_number_of_nodes() const
+            {
+                return mNodes.size();
+            }
+
+            //-------------------------------------------------------------------------------
+
+            uint
+            get_depth() const
+            {
+                return mDepth;
+            }
+
+            //-------------------------------------------------------------------------------
+
+          private:
+            //-------------------------------------------------------------------------------
+
+            /**
+             * recursively creates the node for the triangles in the range [ aFirst, aLast )
+             * of mTriangleIndices
+             */
+            uint
+            build_node(
+                    const moris::Cell< Triangle* >& aTriangles,
+                    moris::Cell< real >&            aCenters,
+                    const uint                      aFirst,
+                    const uint                      aLast,
+                    const uint                      aLevel );
+
+            //-------------------------------------------------------------------------------
+        };
+
+        //-------------------------------------------------------------------------------
+    } /* namespace sdf */
+} /* namespace moris */
+
+#endif /* PROJECTS_GEN_SDF_SRC_CL_SDF_BVH_HPP_ */
@@ -16,6 +16,11 @@
 #include "cl_SDF_Core.hpp"
 #include "fn_sort.hpp"
 #include "fn_print.hpp"
+#include "fn_thread_index.hpp"
+
+#ifdef MORIS_USE_OPENMP
+#include <omp.h>
+#endif
 
 namespace moris
 {
@@ -31,6 +36,30 @@ namespace moris
             // fill unsure nodes list
             //uint tNumberOfNodes = aMesh.get_num_nodes();
         }
+//-------------------------------------------------------------------------------
+
+        uint
+        Core::get_num_threads() const
+        {
+#ifdef MORIS_USE_OPENMP
+            // the linear triangle preselection uses temporary variables shared by all nodes
+            if( mNumThreads < 2 || ! mUseBVH )
+            {
+                return 1;
+            }
+
+            // no nested parallel regions
+            if( omp_in_parallel() )
+            {
+                return 1;
+            }
+
+            return mNumThreads;
+#else
+            return 1;
+#endif
+        }
+
 //-------------------------------------------------------------------------------
 
         void
@@ -239,37 +268,61 @@ namespace moris
                 tTriangle->unflag();
             }
 
-            // loop over all nodes
-            for( uint k=0; k<tNumberOfNodes; ++k )
+            // get number of threads and create one workspace per thread
+            uint tNumThreads = this->get_num_threads();
+
+            mData.mWorkspaces.resize( std::max( tNumThreads, ( uint ) mData.mWorkspaces.size() ) );
+
+            for( Raycast_Workspace & tWorkspace : mData.mWorkspaces )
+            {
+                tWorkspace.mUnsureNodesCount = 0;
+            }
+
+            // loop over all nodes, each node only modifies its own vertex
+#ifdef MORIS_USE_OPENMP
+#pragma omp parallel for num_threads( tNumThreads ) schedule( dynamic, 256 )
+#endif
+            for( sint k=0; k<( sint ) tNumberOfNodes; ++k )
             {
                 if(  mMesh.get_vertex( k )->is_flagged() )
                 {
+                    // get workspace of this thread
+                    Raycast_Workspace & tWorkspace = mData.mWorkspaces( get_thread_index() );
+
                     // get node coordinate
                     const Matrix< F31RMat > & tPoint = mMesh.get_node_coordinate( k );
 
                     // preselect triangles for intersection test
-                    if(aAxis == 0)
-                        this->preselect_triangles_x( tPoint );
+                    if( mUseBVH )
+                        this->preselect_triangles_with_bvh( aAxis, tPoint, tWorkspace );
+                    else if(aAxis == 0)
+                        this->preselect_triangles_x( tPoint, tWorkspace );
                     else if (aAxis == 1)
-                        this->preselect_triangles_y( tPoint );
+                        this->preselect_triangles_y( tPoint, tWorkspace );
                     else
-                        this->preselect_triangles_z( tPoint );
+                        this->preselect_triangles_z( tPoint, tWorkspace );
 
                     // from the candidate triangles, perform intersection
-                    if( mData.mCandidateTriangles.length() > 0 )
+                    if( tWorkspace.mCandidateTriangles.length() > 0 )
                     {
-                        this->intersect_triangles( aAxis, tPoint );
+                        this->intersect_triangles( aAxis, tPoint, tWorkspace );
 
                         // intersect ray with triangles and check if node is inside
-                        if( mData.mIntersectedTriangles.size() > 0 )
+                        if( tWorkspace.mIntersectedTriangles.size() > 0 )
                         {
-                            this->intersect_ray_with_triangles( aAxis, tPoint, k );
+                            this->intersect_ray_with_triangles( aAxis, tPoint, k, tWorkspace );
 
-                            this->check_if_node_is_inside( aAxis, k );
+                            this->check_if_node_is_inside( aAxis, k, tWorkspace );
                         }
                     }
                 }
             }
+
+            // collect unsure nodes of all threads
+            for( Raycast_Workspace & tWorkspace : mData.mWorkspaces )
+            {
+                mData.mUnsureNodesCount += tWorkspace.mUnsureNodesCount;
+            }
         }
 
 //-------------------------------------------------------------------------------
@@ -281,30 +334,73 @@ namespace moris
             // get number of triangles
             uint tNumberOfTriangles = mData.mTriangles.size();
             std::cout<<"number of triangles            : "<<tNumberOfTriangles<<std::endl; //======
-            // loop over all triangles
-            for( uint k=0; k<tNumberOfTriangles; ++k )
-            {
-                // get pointer to triangle
-                Triangle * tTriangle = mData.mTriangles( k );
 
-                // get nodes withing triangle
-                moris::Cell< Vertex * > tNodes;
+            // The linear search uses the vertex flags to mark the candidates within the bounding box of each
+            // triangle and leaves them flagged for the last triangle. The BVH search does not touch the flags.
+            // The flags are not read again before the next raycast resets them, so the unsigned distance is the same.
+            if( mUseBVH )
+            {
+                // get number of candidate nodes
+                uint tNumberOfCandidates = aCandidateList.size();
 
-                this->get_nodes_withing_bounding_box_of_triangle(
-                        tTriangle, tNodes, aCandidateList );
+                // get number of threads and create one workspace per thread
+                uint tNumThreads = this->get_num_threads();
 
-                // get number of nodes
-                uint tNumberOfNodes = tNodes.size();
+                mData.mWorkspaces.resize( std::max( tNumThreads, ( uint ) mData.mWorkspaces.size() ) );
 
-                // calculate distance of this point to the triangle
-                // and update udf value if it is smaller
-                for( uint i=0; i<tNumberOfNodes; ++i )
+                // loop over all candidate nodes, each node only modifies its own vertex
+#ifdef MORIS_USE_OPENMP
+#pragma omp parallel for num_threads( tNumThreads ) schedule( dynamic, 256 )
+#endif
+                for( sint k=0; k<( sint ) tNumberOfCandidates; ++k )
                 {
-                	// update UDF of this node
-                	tNodes( i )->update_udf( tTriangle );
+                    // get pointer to node
+                    Vertex * tNode = aCandidateList( k );
+
+                    // get candidate list of this thread
+                    moris::Cell< uint > & tTriangleIndices
+                        = mData.mWorkspaces( get_thread_index() ).mCandidateTriangleIndices;
+
+                    // get triangles whose buffered bounding box contains this node
+                    mData.mBVH.find_triangles_near_point(
+                            tNode->get_coords(),
+                            mData.mBufferDiagonal,
+                            tTriangleIndices );
+
+                    // update UDF of this node, triangles are visited in the same order as below
+                    for( uint tTriangleIndex : tTriangleIndices )
+                    {
+                        tNode->update_udf( mData.mTriangles( tTriangleIndex ) );
+                    }
                 }
+            }
+            else
+            {
+                // loop over all triangles
+                for( uint k=0; k<tNumberOfTriangles; ++k )
+                {
+                    // get pointer to triangle
+                    Triangle * tTriangle = mData.mTriangles( k );
+
+                    // get nodes withing triangle
+                    moris::Cell< Vertex * > tNodes;
+
+                    this->get_nodes_withing_bounding_box_of_triangle(
+                            tTriangle, tNodes, aCandidateList );
+
+                    // get number of nodes
+                    uint tNumberOfNodes = tNodes.size();
+
+                    // calculate distance of this point to the triangle
+                    // and update udf value if it is smaller
+                    for( uint i=0; i<tNumberOfNodes; ++i )
+                    {
+                    	// update UDF of this node
+                    	tNodes( i )->update_udf( tTriangle );
+                    }
 
-            } // end loop over all triangles
+                } // end loop over all triangles
+            }
 
             if( mVerbose )
             {
@@ -330,7 +426,9 @@ namespace moris
 //-------------------------------------------------------------------------------
 
         void
-        Core::preselect_triangles_x( const Matrix< F31RMat >& aPoint )
+        Core::preselect_triangles_x(
+                const Matrix< F31RMat >& aPoint,
+                Raycast_Workspace      & aWorkspace )
         {
             // x: k = x, j = z, i = y
 #ifdef MORIS_USE_ARMA
@@ -345,13 +443,13 @@ namespace moris
                     (aPoint(1) - mData.mTriangleMinCoordsY.elem(mData.mCandJ)) %
                     (mData.mTriangleMaxCoordsY.elem(mData.mCandJ) - aPoint(1)) > -gSDFepsilon );
 
-            // help vector to be written in mData.mCandidateTriangles.data()
+            // help vector to be written in aWorkspace.mCandidateTriangles.data()
             mData.mCandK = mData.mCandJ.elem(mData.mCandI);
             // resize data object
-            mData.mCandidateTriangles.resize(mData.mCandK.n_elem, 1);
+            aWorkspace.mCandidateTriangles.resize(mData.mCandK.n_elem, 1);
 
             // link to current object
-            arma::Mat<uint> &tCand = mData.mCandidateTriangles.matrix_data();
+            arma::Mat<uint> &tCand = aWorkspace.mCandidateTriangles.matrix_data();
 
             // write data
             tCand = arma::conv_to<arma::Mat<uint> >::from(mData.mCandK);
@@ -376,7 +474,7 @@ namespace moris
             uint tCount = 0;
 
             // reset candidate size
-            mData.mCandidateTriangles.resize(mData.mNumberOfTriangles, 1);
+            aWorkspace.mCandidateTriangles.resize(mData.mNumberOfTriangles, 1);
 
             // loop over remaining triangles in I-direction
             for (uint k = 0; k<tCountJ; ++k)
@@ -385,19 +483,21 @@ namespace moris
                 if((aPoint(1) - mData.mTriangleMinCoordsY(mData.mCandJ(k)))*
                 (mData.mTriangleMaxCoordsY(mData.mCandJ(k)) - aPoint(1)) > -gSDFepsilon )
                 {
-                    mData.mCandidateTriangles(tCount) = mData.mCandJ(k);
+                    aWorkspace.mCandidateTriangles(tCount) = mData.mCandJ(k);
                     ++tCount;
                 }
             }
 
-            mData.mCandidateTriangles.resize(tCount, 1);
+            aWorkspace.mCandidateTriangles.resize(tCount, 1);
 #endif
         }
 
 //-------------------------------------------------------------------------------
 
         void
-        Core::preselect_triangles_y( const Matrix< F31RMat >& aPoint )
+        Core::preselect_triangles_y(
+                const Matrix< F31RMat >& aPoint,
+                Raycast_Workspace      & aWorkspace )
         {
             // y: k = y, j = x, i = z
 #ifdef MORIS_USE_ARMA
@@ -411,14 +511,14 @@ namespace moris
                     (aPoint(2) - mData.mTriangleMinCoordsZ.elem(mData.mCandJ)) %
                     (mData.mTriangleMaxCoordsZ.elem(mData.mCandJ) - aPoint(2)) > -gSDFepsilon );
 
-            // help vector to be written in mData.mCandidateTriangles.data()
+            // help vector to be written in aWorkspace.mCandidateTriangles.data()
             mData.mCandK = mData.mCandJ.elem(mData.mCandI);
 
             // resize data object
-            mData.mCandidateTriangles.resize(mData.mCandK.n_elem, 1);
+            aWorkspace.mCandidateTriangles.resize(mData.mCandK.n_elem, 1);
 
             // link to current object
-            arma::Mat<uint> &tCand = mData.mCandidateTriangles.matrix_data();
+            arma::Mat<uint> &tCand = aWorkspace.mCandidateTriangles.matrix_data();
 
             // write data
             tCand = arma::conv_to<arma::Mat<uint> >::from(mData.mCandK);
@@ -444,7 +544,7 @@ namespace moris
             uint tCount = 0;
 
             // reset candidate size
-            mData.mCandidateTriangles.resize(mData.mNumberOfTriangles, 1);
+            aWorkspace.mCandidateTriangles.resize(mData.mNumberOfTriangles, 1);
 
             // loop over remaining triangles in I-direction
             for (uint k = 0; k<tCountJ; ++k)
@@ -453,19 +553,21 @@ namespace moris
                 if((aPoint(2) - mData.mTriangleMinCoordsZ(mData.mCandJ(k)))*
                         (mData.mTriangleMaxCoordsZ(mData.mCandJ(k)) - aPoint(2)) > -gSDFepsilon )
                 {
-                    mData.mCandidateTriangles(tCount) = mData.mCandJ(k);
+                    aWorkspace.mCandidateTriangles(tCount) = mData.mCandJ(k);
                     ++tCount;
                 }
             }
 
-            mData.mCandidateTriangles.resize(tCount, 1);
+            aWorkspace.mCandidateTriangles.resize(tCount, 1);
 #endif
         }
 
 //-------------------------------------------------------------------------------
 
         void
-        Core::preselect_triangles_z( const Matrix< F31RMat >& aPoint )
+        Core::preselect_triangles_z(
+                const Matrix< F31RMat >& aPoint,
+                Raycast_Workspace      & aWorkspace )
         {
             // z: k = z, j = y, i = x
 #ifdef MORIS_USE_ARMA
@@ -481,14 +583,14 @@ namespace moris
                     (aPoint(0) - mData.mTriangleMinCoordsX.elem(mData.mCandJ)) %
                     (mData.mTriangleMaxCoordsX.elem(mData.mCandJ) - aPoint(0)) > -gSDFepsilon );
 
-            // help vector to be written in mData.mCandidateTriangles.data()
+            // help vector to be written in aWorkspace.mCandidateTriangles.data()
             mData.mCandK = mData.mCandJ.elem(mData.mCandI);
 
             // resize data object
-            mData.mCandidateTriangles.resize(mData.mCandK.n_elem, 1);
+            aWorkspace.mCandidateTriangles.resize(mData.mCandK.n_elem, 1);
 
             // link to current object
-            arma::Mat<uint> &tCand = mData.mCandidateTriangles.matrix_data();
+            arma::Mat<uint> &tCand = aWorkspace.mCandidateTriangles.matrix_data();
 
             // write data
             tCand = arma::conv_to<arma::Mat<uint> >::from(mData.mCandK);
@@ -513,7 +615,7 @@ namespace moris
             uint tCount = 0;
 
             // reset candidate size
-            mData.mCandidateTriangles.resize(mData.mNumberOfTriangles, 1);
+            aWorkspace.mCandidateTriangles.resize(mData.mNumberOfTriangles, 1);
 
             // loop over remaining triangles in I-direction
             for (uint k = 0; k<tCountJ; ++k)
@@ -522,32 +624,62 @@ namespace moris
                 if((aPoint(0) - mData.mTriangleMinCoordsX(mData.mCandJ(k)))*
                         (mData.mTriangleMaxCoordsX(mData.mCandJ(k)) - aPoint(0)) > -gSDFepsilon )
                 {
-                    mData.mCandidateTriangles(tCount) = mData.mCandJ(k);
+                    aWorkspace.mCandidateTriangles(tCount) = mData.mCandJ(k);
                     ++tCount;
                 }
             }
 
-            mData.mCandidateTriangles.resize(tCount, 1);
+            aWorkspace.mCandidateTriangles.resize(tCount, 1);
 #endif
         }
 
 //-------------------------------------------------------------------------------
 
         void
-        Core::intersect_triangles( const uint aAxis, const Matrix< F31RMat >& aPoint )
+        Core::preselect_triangles_with_bvh(
+                const uint               aAxis,
+                const Matrix< F31RMat >& aPoint,
+                Raycast_Workspace      & aWorkspace )
+        {
+            // get triangles whose bounding box is hit by the ray
+            mData.mBVH.find_triangles_along_ray(
+                    aAxis,
+                    aPoint,
+                    gSDFepsilon,
+                    aWorkspace.mCandidateTriangleIndices );
+
+            // get number of candidates
+            uint tCount = aWorkspace.mCandidateTriangleIndices.size();
+
+            // write candidates into data object
+            aWorkspace.mCandidateTriangles.set_size( tCount, 1 );
+
+            for( uint k=0; k<tCount; ++k )
+            {
+                aWorkspace.mCandidateTriangles( k ) = aWorkspace.mCandidateTriangleIndices( k );
+            }
+        }
+
+//-------------------------------------------------------------------------------
+
+        void
+        Core::intersect_triangles(
+                const uint               aAxis,
+                const Matrix< F31RMat >& aPoint,
+                Raycast_Workspace      & aWorkspace )
         {
             // get number of candidate triangles
-            uint tNumberOfTriangles = mData.mCandidateTriangles.length();
+            uint tNumberOfTriangles = aWorkspace.mCandidateTriangles.length();
 
-            // initialize counter for intersected triangles
-            uint tCount = 0;
+            // reset container with intersected triangles
+            aWorkspace.mIntersectedTriangles.clear();
 
             // loop over all candidates
             for( uint k=0; k<tNumberOfTriangles; ++k )
             {
                 // get pointer to triangle
                 Triangle * tTriangle
-                    = mData.mTriangles( mData.mCandidateTriangles( k ) );
+                    = mData.mTriangles( aWorkspace.mCandidateTriangles( k ) );
 
                 if( tTriangle->check_edge( 0, aAxis, aPoint ) )
                 {
@@ -555,35 +687,12 @@ namespace moris
                     {
                         if( tTriangle->check_edge( 2, aAxis, aPoint ) )
                         {
-                            tTriangle->flag();
-                            ++tCount;
+                            // add triangle to list
+                            aWorkspace.mIntersectedTriangles.push_back( tTriangle );
                         }
                     }
                 }
             }
-
-            // resize container with intersected triangles
-            mData.mIntersectedTriangles.resize( tCount, nullptr );
-
-            // reset counter
-            tCount = 0;
-
-            // loop over all candidates
-            for( uint k=0; k<tNumberOfTriangles; ++k )
-            {
-                // get pointer to triangle
-                Triangle * tTriangle
-                    = mData.mTriangles( mData.mCandidateTriangles( k ) );
-
-                if( tTriangle->is_flagged() )
-                {
-                    // add triangle to list
-                    mData.mIntersectedTriangles( tCount++ ) = tTriangle;
-
-                    // unflag triangle
-                    tTriangle->unflag();
-                }
-            }
         }
 
 //-------------------------------------------------------------------------------
@@ -592,10 +701,11 @@ namespace moris
         Core::intersect_ray_with_triangles(
                 const uint               aAxis,
                 const Matrix< F31RMat >& aPoint,
-                const uint aNodeIndex )
+                const uint               aNodeIndex,
+                Raycast_Workspace      & aWorkspace )
         {
             // get number of triangles
-            uint tNumberOfTriangles = mData.mIntersectedTriangles.size();
+            uint tNumberOfTriangles = aWorkspace.mIntersectedTriangles.size();
 
             // initialize vector with coords in axis
             Matrix< DDRMat > tCoordsK( tNumberOfTriangles, 1 );
@@ -610,7 +720,7 @@ namespace moris
                 real tCoordK;
 
                 // calculate intersection coordinate
-                mData.mIntersectedTriangles( k )->intersect_with_coordinate_axis(
+                aWorkspace.mIntersectedTriangles( k )->intersect_with_coordinate_axis(
                         aPoint,
                         aAxis,
                         tCoordK,
@@ -634,7 +744,7 @@ namespace moris
             if( tError )
             {
                 // this way, the matrix is ignored
-                mData.mCoordsK.set_size( 1, 1, 0.0 );
+                aWorkspace.mCoordsK.set_size( 1, 1, 0.0 );
             }
             else
             {
@@ -649,7 +759,7 @@ namespace moris
                 uint tCountUnique = 0;
 
                 // set size of output array
-                mData.mCoordsK.set_size( tCount, 1 );
+                aWorkspace.mCoordsK.set_size( tCount, 1 );
 
                 real tMinCoord = mMesh.get_min_coord( aAxis );
                 real tMaxCoord = mMesh.get_max_coord( aAxis );
@@ -657,7 +767,7 @@ namespace moris
                 // set first entry
                 if( tMinCoord < tCoordsKSorted( 0 ) )
                 {
-                    mData.mCoordsK( tCountUnique++ ) = tCoordsKSorted( 0 );
+                    aWorkspace.mCoordsK( tCountUnique++ ) = tCoordsKSorted( 0 );
                 }
 
                 // find unique entries
@@ -668,13 +778,13 @@ namespace moris
 
                         if( std::abs( tCoordsKSorted( k ) - tCoordsKSorted( k-1 ) ) > 10*gSDFepsilon )
                         {
-                            mData.mCoordsK( tCountUnique++ ) = tCoordsKSorted( k );
+                            aWorkspace.mCoordsK( tCountUnique++ ) = tCoordsKSorted( k );
                         }
                     }
                 }
 
                 // chop vector
-                mData.mCoordsK.resize( tCountUnique, 1 );
+                aWorkspace.mCoordsK.resize( tCountUnique, 1 );
             }
         }
 
@@ -682,10 +792,11 @@ namespace moris
 
         void
         Core::check_if_node_is_inside(
-                           const uint aAxis,
-                           const uint aNodeIndex )
+                           const uint          aAxis,
+                           const uint          aNodeIndex,
+                           Raycast_Workspace & aWorkspace )
         {
-            uint tNumCoordsK = mData.mCoordsK.length();
+            uint tNumCoordsK = aWorkspace.mCoordsK.length();
 
             bool tNodeIsInside = false;
 
@@ -696,8 +807,8 @@ namespace moris
             {
                 for ( uint k=0; k< tNumCoordsK / 2; ++k)
                 {
-                    tNodeIsInside = ( aPoint( aAxis ) > mData.mCoordsK( 2 * k )) &&
-                            ( aPoint( aAxis ) < mData.mCoordsK( 2 * k + 1 ));
+                    tNodeIsInside = ( aPoint( aAxis ) > aWorkspace.mCoordsK( 2 * k )) &&
+                            ( aPoint( aAxis ) < aWorkspace.mCoordsK( 2 * k + 1 ));
 
                     // break the loop if inside
                     if ( tNodeIsInside )
@@ -724,7 +835,7 @@ namespace moris
                 mMesh.get_vertex( aNodeIndex )->flag();
 
                 // increment counter
-                ++mData.mUnsureNodesCount;
+                ++aWorkspace.mUnsureNodesCount;
             }
         }
 
@@ -1025,6 +1136,18 @@ namespace moris
 
             uint tNumberOfVertices = mMesh.get_num_nodes();
 
+            uint tNumThreads = this->get_num_threads();
+
+            // closer triangles and their distances found in the current sweep, threaded sweep only
+            moris::Cell< Triangle * > tCloserTriangles;
+            moris::Cell< real >       tCloserDistances;
+
+            if( tNumThreads > 1 )
+            {
+                tCloserTriangles.resize( tNumberOfVertices, nullptr );
+                tCloserDistances.resize( tNumberOfVertices, 0.0 );
+            }
+
             uint tSweepCount = 1;
 
             while ( tSweepCount != 0 )
@@ -1032,17 +1155,57 @@ namespace moris
                 tic tTimer;
                 tSweepCount = 0;
 
-                // loop over all vertices
-                for( uint k=0; k<tNumberOfVertices; ++k )
+                if( tNumThreads == 1 )
+                {
+                    // loop over all vertices
+                    for( uint k=0; k<tNumberOfVertices; ++k )
+                    {
+                        // get vertex
+                        Vertex * tVertex = mMesh.get_vertex( k );
+
+                        // test if node has sdf
+                        if( tVertex->has_sdf() )
+                        {
+                            // sweep this vertex
+                            tSweepCount += tVertex->sweep();
+                        }
+                    }
+                }
+                else
                 {
-                    // get vertex
-                    Vertex * tVertex = mMesh.get_vertex( k );
+                    // find closer triangles based on the state of the previous sweep.
+                    // Vertices are not modified in this loop, so neighbors can be read concurrently
+#ifdef MORIS_USE_OPENMP
+#pragma omp parallel for num_threads( tNumThreads ) schedule( dynamic, 256 )
+#endif
+                    for( sint k=0; k<( sint ) tNumberOfVertices; ++k )
+                    {
+                        // get vertex
+                        Vertex * tVertex = mMesh.get_vertex( k );
+
+                        // test if node has sdf
+                        if( tVertex->has_sdf() )
+                        {
+                            tCloserTriangles( k ) = tVertex->get_closer_neighbor_triangle( tCloserDistances( k ) );
+                        }
+                        else
+                        {
+                            tCloserTriangles( k ) = nullptr;
+                        }
+                    }
 
-                    // test if node has sdf
-                    if( tVertex->has_sdf() )
+                    // update vertices
+#ifdef MORIS_USE_OPENMP
+#pragma omp parallel for num_threads( tNumThreads ) reduction( + : tSweepCount )
+#endif
+                    for( sint k=0; k<( sint ) tNumberOfVertices; ++k )
                     {
-                        // sweep this vertex
-                        tSweepCount += tVertex->sweep();
+                        if( tCloserTriangles( k ) != nullptr )
+                        {
+                            mMesh.get_vertex( k )->set_closest_triangle( tCloserTriangles( k ), tCloserDistances( k ) );
+
+                            ++tSweepCount;
+                        }
                     }
                 }
 
@@ -1613,7 +1776,10 @@ namespace moris
             uint tNumberOfNodes = mMesh.get_num_nodes();
 
             // loop over all nodes
-            for( uint k=0; k<tNumberOfNodes; ++k )
+#ifdef MORIS_USE_OPENMP
+#pragma omp parallel for num_threads( this->get_num_threads() )
+#endif
+            for( sint k=0; k<( sint ) tNumberOfNodes; ++k )
             {
                 // get pointer to node
                 mMesh.get_vertex( k )->unflag();
@@ -1648,6 +1814,9 @@ namespace moris
                 tTriangle->update_data();
             }
 
+            // update bounding boxes and BVH
+            mData.update_triangles();
+
             // rotate unsure nodes
             uint tNumberOfNodes = mMesh.get_num_nodes();
 
@@ -1679,6 +1848,9 @@ namespace moris
                 tTriangle->update_data();
             }
 
+            // update bounding boxes and BVH
+            mData.update_triangles();
+
             // rotate unsure nodes
             uint tNumberOfNodes = mMesh.get_num_nodes();
 
@@ -35,6 +35,12 @@ namespace moris
                   real            mCandidateSearchDepthEpsilon = 0.01;
                   bool            mVerbose;
 
+                  // flag if triangle queries use the BVH instead of a linear search
+                  bool            mUseBVH = true;
+
+                  // number of threads used to process the mesh nodes
+                  uint            mNumThreads = 1;
+
 //-------------------------------------------------------------------------------
         public :
 //-------------------------------------------------------------------------------
@@ -63,6 +69,31 @@ namespace moris
                 mCandidateSearchDepthEpsilon = aCandidateSearchEpsilon;
             }
 
+//-------------------------------------------------------------------------------
+
+            /**
+             * switch between the BVH and a linear search over all triangles
+             * for triangle preselection and unsigned distance. Both give the same
+             * result, but only the linear search modifies the vertex flags in calculate_udf()
+             */
+            void
+            set_use_bvh( const bool aUseBVH )
+            {
+                mUseBVH = aUseBVH;
+            }
+
+//-------------------------------------------------------------------------------
+
+            /**
+             * sets the number of threads used for raycast, unsigned distance and sweep.
+             * Threading requires OpenMP and the BVH, otherwise nodes are processed serially.
+             */
+            void
+            set_num_threads( const uint aNumThreads )
+            {
+                mNumThreads = aNumThreads;
+            }
+
 //-------------------------------------------------------------------------------
 
             void
@@ -107,6 +138,14 @@ namespace moris
         private :
 //-------------------------------------------------------------------------------
 
+//-------------------------------------------------------------------------------
+
+            /**
+             * returns the number of threads that can be used for node loops
+             */
+            uint
+            get_num_threads() const;
+
 //-------------------------------------------------------------------------------
 
             void
@@ -128,6 +167,12 @@ namespace moris
              * Kehrwoche :
              * make sure that each vertex is really associated
              * to its closest triangle
+             *
+             * The serial sweep updates the vertices in place (Gauss-Seidel order). With more than
+             * one thread, each pass first reads the closer triangles of all vertices and then updates
+             * them (Jacobi order). The threaded result is therefore independent of the number of threads,
+             * but may need more passes and can differ from the serial result. Both only assign distances
+             * to actual triangles, so no value is smaller than the exact unsigned distance.
              */
             void
             sweep();
@@ -140,39 +185,56 @@ namespace moris
 //-------------------------------------------------------------------------------
 
             void
-            preselect_triangles_x( const Matrix< F31RMat >& aPoint );
+            preselect_triangles_x(
+                    const Matrix< F31RMat >& aPoint,
+                    Raycast_Workspace      & aWorkspace );
+
+//-------------------------------------------------------------------------------
+
+            void
+            preselect_triangles_y(
+                    const Matrix< F31RMat >& aPoint,
+                    Raycast_Workspace      & aWorkspace );
 
 //-------------------------------------------------------------------------------
 
             void
-            preselect_triangles_y( const Matrix< F31RMat >& aPoint );
+            preselect_triangles_z(
+                    const Matrix< F31RMat >& aPoint,
+                    Raycast_Workspace      & aWorkspace );
 
 //-------------------------------------------------------------------------------
 
             void
-            preselect_triangles_z( const Matrix< F31RMat >& aPoint );
+            preselect_triangles_with_bvh(
+                    const uint               aAxis,
+                    const Matrix< F31RMat >& aPoint,
+                    Raycast_Workspace      & aWorkspace );
 
 //-------------------------------------------------------------------------------
 
             void
             intersect_triangles(
-                    const uint aAxis,
-                    const Matrix< F31RMat >& aPoint );
+                    const uint               aAxis,
+                    const Matrix< F31RMat >& aPoint,
+                    Raycast_Workspace      & aWorkspace );
 
 //-------------------------------------------------------------------------------
 
             void
             intersect_ray_with_triangles(
-                    const uint aAxis,
+                    const uint               aAxis,
                     const Matrix< F31RMat >& aPoint,
-                    const uint aNodeIndex );
+                    const uint               aNodeIndex,
+                    Raycast_Workspace      & aWorkspace );
 
 //-------------------------------------------------------------------------------
 
             void
             check_if_node_is_inside(
-                    const uint aAxis,
-                    const uint aNodeIndex );
+                    const uint          aAxis,
+                    const uint          aNodeIndex,
+                    Raycast_Workspace & aWorkspace );
 //-------------------------------------------------------------------------------
 
             void
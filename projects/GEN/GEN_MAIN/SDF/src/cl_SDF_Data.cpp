@@ -31,7 +31,7 @@ namespace moris
 #else
                        mCandJ(mNumberOfTriangles, 1),
 #endif
-                       mCandidateTriangles(mNumberOfTriangles, 1)
+                       mWorkspaces( 1 )
 
         {
             this->init_triangles();
@@ -65,6 +65,9 @@ namespace moris
                 mTriangleMaxCoordsZ ( k )
                     = mTriangles( k )->get_max_coord( 2 );
             }
+
+            // build search tree over triangle bounding boxes
+            mBVH.build( mTriangles );
         }
 
 //-------------------------------------------------------------------------------
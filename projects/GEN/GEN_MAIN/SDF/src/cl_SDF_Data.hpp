@@ -17,11 +17,32 @@
 #include "linalg_typedefs.hpp"
 
 #include "cl_SDF_Object.hpp"
+#include "cl_SDF_BVH.hpp"
 
 namespace moris
 {
     namespace sdf
     {
+//-------------------------------------------------------------------------------
+
+        /**
+         * temporary variables needed for processing one node in the voxelizing
+         * algorithm and the unsigned distance calculation
+         */
+        struct Raycast_Workspace
+        {
+            Matrix< DDRMat > mCoordsK;                //!< intersection coordinates of ray
+            Matrix< DDUMat > mCandidateTriangles;     //!< preselected triangles
+
+            moris::Cell< Triangle * > mIntersectedTriangles;
+
+            //! candidate triangles of queries on the BVH
+            moris::Cell< uint > mCandidateTriangleIndices;
+
+            //! counter for unsure nodes found by this workspace
+            uint mUnsureNodesCount = 0;
+        };
+
 //-------------------------------------------------------------------------------
 
         struct Data
@@ -55,10 +76,11 @@ namespace moris
             Matrix< DDUMat > mCandJ;                 //!< temporary variable needed for triangle preselection
 #endif
 
-            Matrix< DDRMat > mCoordsK;                //!< temporary variable needed for voxelizing
-            Matrix< DDUMat > mCandidateTriangles;
+            //! bounding volume hierarchy over triangle bounding boxes
+            BVH mBVH;
 
-            moris::Cell< Triangle * > mIntersectedTriangles;
+            //! temporary variables of the node loops, one per thread
+            moris::Cell< Raycast_Workspace > mWorkspaces;
 
             real mBufferDiagonal;
 
@@ -78,6 +100,18 @@ namespace moris
 
             ~Data(){};
 
+//-------------------------------------------------------------------------------
+
+            /**
+             * updates the triangle bounding boxes and the BVH,
+             * needs to be called after the triangles were moved
+             */
+            void
+            update_triangles()
+            {
+                this->init_triangles();
+            }
+
 //-------------------------------------------------------------------------------
         private:
 //-------------------------------------------------------------------------------
@@ -55,6 +55,9 @@ namespace moris
             // create core
             Core tCore( tMesh, tData );
 
+            // set number of threads
+            tCore.set_num_threads( mNumThreads );
+
             // perform raycast
             tCore.calculate_raycast( aElementsAtSurface );
         }
@@ -74,6 +77,9 @@ namespace moris
             // create core
             Core tCore( tMesh, tData );
 
+            // set number of threads
+            tCore.set_num_threads( mNumThreads );
+
             // perform raycast
             tCore.calculate_raycast( aElementsAtSurface );
         }
@@ -95,6 +101,9 @@ namespace moris
             // create core
             Core tCore( tMesh, tData );
 
+            // set number of threads
+            tCore.set_num_threads( mNumThreads );
+
             // perform raycast
             tCore.calculate_raycast( aElementsAtSurface, aElementsInVolume );
         }
@@ -116,6 +125,9 @@ namespace moris
             // create core
             Core tCore( tMesh, tData, mVerboseFlag );
 
+            // set number of threads
+            tCore.set_num_threads( mNumThreads );
+
             // perform raycast
             tCore.calculate_raycast( aElementsAtSurface, aElementsInVolume );
         }
@@ -136,6 +148,9 @@ namespace moris
             // create core
             Core tCore( tMesh, tData, mVerboseFlag );
 
+            // set number of threads
+            tCore.set_num_threads( mNumThreads );
+
             // calculate SDF
             tCore.calculate_raycast_and_sdf( aSDF );
 
@@ -157,6 +172,9 @@ namespace moris
             // create core
             Core tCore( tMesh, tData, mVerboseFlag );
 
+            // set number of threads
+            tCore.set_num_threads( mNumThreads );
+
             // calculate SDF
             tCore.calculate_raycast_and_sdf( aSDF );
         }
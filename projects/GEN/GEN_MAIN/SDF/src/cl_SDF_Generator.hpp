@@ -33,6 +33,9 @@ namespace moris
 
             //! verbosity flag
             bool          mVerboseFlag = false;
+
+            //! number of threads used to process the mesh nodes
+            uint          mNumThreads = 1;
 //-------------------------------------------------------------------------------
 public:
 //-------------------------------------------------------------------------------
@@ -54,6 +57,17 @@ public:
              */
             ~SDF_Generator(){};
 
+//-------------------------------------------------------------------------------
+
+            /**
+             * sets the number of threads used for raycast and sdf calculation
+             */
+            void
+            set_num_threads( const uint aNumThreads )
+            {
+                mNumThreads = aNumThreads;
+            }
+
 //-------------------------------------------------------------------------------
 
             /**
@@ -69,7 +69,31 @@ namespace moris
         uint
         Vertex::sweep()
         {
-            bool tSwept = false;
+            real tDistance;
+
+            // get closest triangle of neighbors
+            Triangle * tTriangle = this->get_closer_neighbor_triangle( tDistance );
+
+            if( tTriangle != nullptr )
+            {
+                this->set_closest_triangle( tTriangle, tDistance );
+
+                return 1;
+            }
+            else
+            {
+                return 0;
+            }
+        }
+
+// -----------------------------------------------------------------------------
+
+        Triangle *
+        Vertex::get_closer_neighbor_triangle( real & aDistance ) const
+        {
+            Triangle * tCloserTriangle = nullptr;
+
+            aDistance = mSDF;
 
             // loop over all neighbors
             for( Vertex * tNeighbor : mNeighbors )
@@ -83,23 +107,15 @@ namespace moris
                     real tDistance
                         = tTriangle->get_distance_to_point( mNodeCoords );
 
-                    if( tDistance < mSDF )
+                    if( tDistance < aDistance )
                     {
-                        tSwept = true;
-                        mSDF = tDistance;
-                        mClosestTriangle = tTriangle;
+                        aDistance = tDistance;
+                        tCloserTriangle = tTriangle;
                     }
                 }
             }
 
-            if( tSwept )
-            {
-                return 1;
-            }
-            else
-            {
-                return 0;
-            }
+            return tCloserTriangle;
         }
 
 //-------------------------------------------------------------------------------
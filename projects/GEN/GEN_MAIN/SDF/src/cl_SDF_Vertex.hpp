@@ -295,6 +295,28 @@ namespace moris
             uint
             sweep();
 
+// -----------------------------------------------------------------------------
+
+            /**
+             * returns the closest triangle of the neighbors if it is closer than
+             * the current one, nullptr otherwise. Does not modify this vertex.
+             *
+             * @param[ out ] aDistance distance to the returned triangle
+             */
+            Triangle *
+            get_closer_neighbor_triangle( real & aDistance ) const;
+
+// -----------------------------------------------------------------------------
+
+            void
+            set_closest_triangle(
+                    Triangle * aTriangle,
+                    const real aDistance )
+            {
+                mSDF = aDistance;
+                mClosestTriangle = aTriangle;
+            }
+
 // -----------------------------------------------------------------------------
 
             real
@@ -0,0 +1,417 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_SDF_BVH.cpp
+ *
+ */
+
+#include <cmath>
+#include <string>
+#include <catch.hpp>
+
+// core
+#include "typedefs.hpp"
+#include "paths.hpp"
+
+// comm
+#include "cl_Communication_Tools.hpp" // COM/src
+
+// linalg
+#include "cl_Matrix.hpp"
+#include "linalg_typedefs.hpp"
+#include "op_equal_equal.hpp"
+#include "op_minus.hpp"
+#include "fn_norm.hpp"
+#include "fn_all_true.hpp"
+
+#include "cl_Stopwatch.hpp" // CHR/src
+#include "cl_Logger.hpp" // MRS/IOS/src
+#include "cl_MTK_Mesh_Factory.hpp"
+
+// SDF
+#include "SDF_Tools.hpp"
+#include "cl_SDF_Mesh.hpp"
+#include "cl_SDF_Core.hpp"
+#include "cl_SDF_Data.hpp"
+#include "cl_SDF_Object.hpp"
+#include "cl_SDF_Vertex.hpp"
+#include "cl_SDF_BVH.hpp"
+
+using namespace moris;
+
+TEST_CASE(
+        "ge::sdf::BVH",
+        "[geomeng],[sdf],[BVH]")
+{
+    if( par_size() == 1 )
+    {
+        // get root from environment
+        std::string tMorisRoot = moris::get_base_moris_dir();
+
+        // the bracket is the largest object file shipped with the repository
+        std::string tObjectPath = tMorisRoot + "/projects/HMR/tutorials/bracket.obj" ;
+
+        // create triangle object
+        sdf::Object tObject( tObjectPath );
+
+        // create data container, this builds the BVH
+        sdf::Data tData( tObject );
+
+        moris::Cell< sdf::Triangle * > & tTriangles = tObject.get_triangles();
+
+        uint tNumberOfTriangles = tTriangles.size();
+
+        // bounding box of object
+        Matrix< F31RMat > tMinCoord( 3, 1, MORIS_REAL_MAX );
+        Matrix< F31RMat > tMaxCoord( 3, 1, -MORIS_REAL_MAX );
+
+        for( sdf::Triangle * tTriangle : tTriangles )
+        {
+            for( uint i=0; i<3; ++i )
+            {
+                tMinCoord( i ) = std::min( tMinCoord( i ), tTriangle->get_min_coord( i ) );
+                tMaxCoord( i ) = std::max( tMaxCoord( i ), tTriangle->get_max_coord( i ) );
+            }
+        }
+
+        // number of sample points per direction, slightly larger than the object
+        uint tNumberOfSamples = 40;
+
+        auto tSamplePoint = [ & ]( uint aI, uint aJ, uint aK )
+        {
+            Matrix< F31RMat > tPoint( 3, 1 );
+            uint tIndex[ 3 ] = { aI, aJ, aK };
+            for( uint i=0; i<3; ++i )
+            {
+                real tLength = tMaxCoord( i ) - tMinCoord( i );
+                tPoint( i ) = tMinCoord( i ) - 0.05 * tLength
+                        + 1.1 * tLength * ( tIndex[ i ] + 0.5 ) / tNumberOfSamples;
+            }
+            return tPoint;
+        };
+
+//-------------------------------------------------------------------------------
+        SECTION("SDF BVH: Ray Preselection")
+        {
+            moris::Cell< uint > tBVHCandidates;
+            moris::Cell< uint > tLinearCandidates;
+
+            bool tAllEqual = true;
+
+            for( uint tAxis=0; tAxis<3; ++tAxis )
+            {
+                uint tI = ( tAxis + 1 ) % 3;
+                uint tJ = ( tAxis + 2 ) % 3;
+
+                for( uint i=0; i<tNumberOfSamples; ++i )
+                {
+                    for( uint j=0; j<tNumberOfSamples; ++j )
+                    {
+                        Matrix< F31RMat > tPoint = tSamplePoint( i, j, i );
+
+                        tData.mBVH.find_triangles_along_ray( tAxis, tPoint, sdf::gSDFepsilon, tBVHCandidates );
+
+                        tLinearCandidates.clear();
+                        for( uint k=0; k<tNumberOfTriangles; ++k )
+                        {
+                            if( ( tPoint( tJ ) - tTriangles( k )->get_min_coord( tJ ) ) *
+                                    ( tTriangles( k )->get_max_coord( tJ ) - tPoint( tJ ) ) > -sdf::gSDFepsilon &&
+                                    ( tPoint( tI ) - tTriangles( k )->get_min_coord( tI ) ) *
+                                    ( tTriangles( k )->get_max_coord( tI ) - tPoint( tI ) ) > -sdf::gSDFepsilon )
+                            {
+                                tLinearCandidates.push_back( k );
+                            }
+                        }
+
+                        tAllEqual = tAllEqual && tBVHCandidates.data() == tLinearCandidates.data();
+                    }
+                }
+            }
+
+            REQUIRE( tAllEqual );
+        }
+
+//-------------------------------------------------------------------------------
+        SECTION("SDF BVH: Near Point Query")
+        {
+            moris::Cell< uint > tBVHCandidates;
+            moris::Cell< uint > tLinearCandidates;
+
+            // buffer of roughly one sample spacing
+            real tBuffer = 1.1 * ( tMaxCoord( 0 ) - tMinCoord( 0 ) ) / tNumberOfSamples;
+
+            bool tAllEqual = true;
+
+            for( uint i=0; i<tNumberOfSamples; ++i )
+            {
+                for( uint j=0; j<tNumberOfSamples; ++j )
+                {
+                    for( uint k=0; k<tNumberOfSamples; ++k )
+                    {
+                        Matrix< F31RMat > tPoint = tSamplePoint( i, j, k );
+
+                        tData.mBVH.find_triangles_near_point( tPoint, tBuffer, tBVHCandidates );
+
+                        tLinearCandidates.clear();
+                        for( uint t=0; t<tNumberOfTriangles; ++t )
+                        {
+                            bool tIsNear = true;
+                            for( uint d=0; d<3; ++d )
+                            {
+                                tIsNear = tIsNear
+                                        && tPoint( d ) >= tTriangles( t )->get_min_coord( d ) - tBuffer
+                                        && tPoint( d ) <= tTriangles( t )->get_max_coord( d ) + tBuffer;
+                            }
+
+                            if( tIsNear )
+                            {
+                                tLinearCandidates.push_back( t );
+                            }
+                        }
+
+                        tAllEqual = tAllEqual && tBVHCandidates.data() == tLinearCandidates.data();
+                    }
+                }
+            }
+
+            REQUIRE( tAllEqual );
+        }
+    }
+}
+
+//-------------------------------------------------------------------------------
+
+TEST_CASE(
+        "ge::sdf::BVH Raycast and SDF",
+        "[geomeng],[sdf],[BVH]")
+{
+    if( par_size() == 1 )
+    {
+        // get root from environment
+        std::string tMorisRoot = moris::get_base_moris_dir();
+
+        // determine path for object file
+        std::string tObjectPath = tMorisRoot + "/projects/GEN/GEN_MAIN/SDF/test/data/tetrahedron.obj" ;
+
+        // determine path for mesh file
+        std::string tMeshPath =  tMorisRoot + "/projects/GEN/GEN_MAIN/SDF/test/data/TensorMesh.g" ;
+
+        // create triangle object
+        sdf::Object tObject( tObjectPath );
+
+        // load MTK mesh from file
+        mtk::Mesh * tInput = mtk::create_interpolation_mesh( MeshType::STK, tMeshPath , nullptr);
+
+        // create SDF wrapper for mesh
+        sdf::Mesh tMesh( tInput );
+
+        // create data container
+        sdf::Data tData( tObject );
+
+        // create core
+        sdf::Core tCore( tMesh, tData );
+
+        // results using linear search
+        Matrix< DDRMat >   tLinearSDF;
+        Matrix< IndexMat > tLinearElementsAtSurface;
+        Matrix< IndexMat > tLinearElementsInVolume;
+
+        tCore.set_use_bvh( false );
+        tCore.calculate_raycast_and_sdf( tLinearSDF, tLinearElementsAtSurface, tLinearElementsInVolume );
+
+        // results using BVH
+        Matrix< DDRMat >   tSDF;
+        Matrix< IndexMat > tElementsAtSurface;
+        Matrix< IndexMat > tElementsInVolume;
+
+        tCore.set_use_bvh( true );
+        tCore.calculate_raycast_and_sdf( tSDF, tElementsAtSurface, tElementsInVolume );
+
+        REQUIRE( all_true( tElementsAtSurface == tLinearElementsAtSurface ) );
+        REQUIRE( all_true( tElementsInVolume == tLinearElementsInVolume ) );
+        REQUIRE( all_true( tSDF == tLinearSDF ) );
+
+        // results using threads, serial if OpenMP is not available
+        Matrix< DDRMat >   tThreadedSDF;
+        Matrix< IndexMat > tThreadedElementsAtSurface;
+        Matrix< IndexMat > tThreadedElementsInVolume;
+
+        tCore.set_num_threads( 4 );
+        tCore.calculate_raycast_and_sdf( tThreadedSDF, tThreadedElementsAtSurface, tThreadedElementsInVolume );
+
+        REQUIRE( all_true( tThreadedElementsAtSurface == tLinearElementsAtSurface ) );
+        REQUIRE( all_true( tThreadedElementsInVolume == tLinearElementsInVolume ) );
+        REQUIRE( norm( tThreadedSDF - tLinearSDF ) < 1e-12 );
+
+        // threaded sweep does not depend on the number of threads
+        Matrix< DDRMat >   tTwoThreadSDF;
+        Matrix< IndexMat > tTwoThreadElementsAtSurface;
+        Matrix< IndexMat > tTwoThreadElementsInVolume;
+
+        tCore.set_num_threads( 2 );
+        tCore.calculate_raycast_and_sdf( tTwoThreadSDF, tTwoThreadElementsAtSurface, tTwoThreadElementsInVolume );
+
+        REQUIRE( all_true( tTwoThreadSDF == tThreadedSDF ) );
+
+        // tidy up
+        delete tInput;
+    }
+}
+
+//-------------------------------------------------------------------------------
+
+TEST_CASE(
+        "ge::sdf::BVH Unsigned Distance",
+        "[geomeng],[sdf],[BVH]")
+{
+    if( par_size() == 1 )
+    {
+        // get root from environment
+        std::string tMorisRoot = moris::get_base_moris_dir();
+
+        // determine path for object file
+        std::string tObjectPath = tMorisRoot + "/projects/GEN/GEN_MAIN/SDF/test/data/tetrahedron.obj" ;
+
+        // determine path for mesh file
+        std::string tMeshPath =  tMorisRoot + "/projects/GEN/GEN_MAIN/SDF/test/data/TensorMesh.g" ;
+
+        // create triangle object
+        sdf::Object tObject( tObjectPath );
+
+        // load MTK mesh from file
+        mtk::Mesh * tInput = mtk::create_interpolation_mesh( MeshType::STK, tMeshPath , nullptr);
+
+        // create SDF wrapper for mesh
+        sdf::Mesh tMesh( tInput );
+
+        // create data container
+        sdf::Data tData( tObject );
+
+        // create core
+        sdf::Core tCore( tMesh, tData );
+
+        moris::Cell< sdf::Triangle * > & tTriangles = tObject.get_triangles();
+
+        // serial sweep and threaded sweep, the latter is serial if OpenMP is not available
+        for( uint tNumThreads : { 1, 4 } )
+        {
+            Matrix< DDRMat >   tSDF;
+            Matrix< IndexMat > tElementsAtSurface;
+            Matrix< IndexMat > tElementsInVolume;
+
+            tCore.set_use_bvh( true );
+            tCore.set_num_threads( tNumThreads );
+            tCore.calculate_raycast_and_sdf( tSDF, tElementsAtSurface, tElementsInVolume );
+
+            uint tNumberOfCandidates = 0;
+
+            for( uint k=0; k<tMesh.get_num_nodes(); ++k )
+            {
+                sdf::Vertex * tVertex = tMesh.get_vertex( k );
+
+                if( ! tVertex->has_sdf() )
+                {
+                    continue;
+                }
+
+                // distance to the closest triangle by brute force
+                real tDistance = MORIS_REAL_MAX;
+
+                for( sdf::Triangle * tTriangle : tTriangles )
+                {
+                    tDistance = std::min( tDistance, tTriangle->get_distance_to_point( tVertex->get_coords() ) );
+                }
+
+                // no value may be smaller than the true distance
+                REQUIRE( std::abs( tVertex->get_sdf() ) >= tDistance );
+
+                // the closest triangle of a candidate within the buffer is always found by the unsigned distance
+                if( tVertex->is_candidate() && tDistance <= tData.mBufferDiagonal )
+                {
+                    REQUIRE( std::abs( tVertex->get_sdf() ) == tDistance );
+
+                    ++tNumberOfCandidates;
+                }
+            }
+
+            // make sure that the check above is not empty
+            REQUIRE( tNumberOfCandidates > 0 );
+        }
+
+        // tidy up
+        delete tInput;
+    }
+}
+
+//-------------------------------------------------------------------------------
+
+// opt-in benchmark, run with the tag [.benchmark]
+TEST_CASE(
+        "ge::sdf::BVH Benchmark",
+        "[.benchmark],[sdf],[BVH_Benchmark]")
+{
+    if( par_size() == 1 )
+    {
+        // get root from environment
+        std::string tMorisRoot = moris::get_base_moris_dir();
+
+        // the bracket is the largest object file shipped with the repository
+        std::string tObjectPath = tMorisRoot + "/projects/HMR/tutorials/bracket.obj" ;
+
+        // background mesh around the bounding box of the bracket
+        std::string tMeshPath = "generated:60x30x36|bbox:-5.0,3.2,-1.8,0.7,6.0,1.8";
+
+        // create triangle object
+        sdf::Object tObject( tObjectPath );
+
+        // load MTK mesh
+        mtk::Mesh * tInput = mtk::create_interpolation_mesh( MeshType::STK, tMeshPath , nullptr);
+
+        // create SDF wrapper for mesh
+        sdf::Mesh tMesh( tInput );
+
+        // create data container, this builds the BVH
+        sdf::Data tData( tObject );
+
+        // create core
+        sdf::Core tCore( tMesh, tData );
+
+        Matrix< DDRMat > tLinearSDF;
+        Matrix< DDRMat > tSDF;
+
+        for( bool tUseBVH : { false, true } )
+        {
+            tCore.set_use_bvh( tUseBVH );
+
+            // raycast only
+            tic tRaycastTimer;
+
+            tCore.calculate_raycast();
+
+            real tRaycastTime = tRaycastTimer.toc< moris::chronos::milliseconds >().wall;
+
+            // raycast followed by unsigned distance and sweep
+            tic tSDFTimer;
+
+            tCore.calculate_raycast_and_sdf( tUseBVH ? tSDF : tLinearSDF );
+
+            real tSDFTime = tSDFTimer.toc< moris::chronos::milliseconds >().wall;
+
+            MORIS_LOG_INFO( "SDF of %u triangles on %u nodes with %s: raycast %.1f ms, unsigned distance and sweep %.1f ms",
+                    ( uint ) tObject.get_triangles().size(),
+                    ( uint ) tMesh.get_num_nodes(),
+                    tUseBVH ? "BVH" : "linear search",
+                    tRaycastTime,
+                    tSDFTime - tRaycastTime );
+        }
+
+        // both searches give the same result
+        REQUIRE( all_true( tSDF == tLinearSDF ) );
+
+        // tidy up
+        delete tInput;
+    }
+}
@@ -67,6 +67,13 @@ namespace moris
             MORIS_ERROR( mIsocontourTolerance > 1e-14,
                     "Geometry_Engine::Geometry_Engine - Isocontour tolerance should be larger than 1e-14" );
 
+            sint tNumThreads = aParameterLists( 0 )( 0 ).get< sint >( "num_threads" );
+
+            MORIS_ERROR( tNumThreads > 0,
+                    "Geometry_Engine::Geometry_Engine - num_threads needs to be positive." );
+
+            mNumThreads = static_cast< uint >( tNumThreads );
+
             MORIS_ERROR( mIntersectionTolerance > 1e-14,
                     "Geometry_Engine::Geometry_Engine - Intersection tolerance should be larger than 1e-14" );
 
@@ -175,6 +182,7 @@ namespace moris
                 , mIntersectionTolerance( aParameters.mIntersectionTolerance )
                 , mInitialPrimitiveADVs( aParameters.mADVs )
                 , mTimeOffset( aParameters.mTimeOffset )
+                , mNumThreads( aParameters.mNumThreads )
         {
             // Tracer
             Tracer tTracer( "GEN", "Create geometry engine" );
@@ -185,6 +193,9 @@ namespace moris
             MORIS_ERROR( mIntersectionTolerance > 1e-14,
                     "Geometry_Engine::Geometry_Engine - Intersection tolerance should be larger than 1e-14" );
 
+            MORIS_ERROR( mNumThreads > 0,
+                    "Geometry_Engine::Geometry_Engine - Number of threads needs to be positive." );
+
             mtk::Integration_Mesh* tIntegrationMesh = create_integration_mesh_from_interpolation_mesh(
                     aMesh->get_mesh_type(),
                     aMesh );
@@ -397,19 +408,12 @@ namespace moris
             {
                 case Intersection_Mode::LEVEL_SET:
                 {
-                    // Initialize by evaluating the first node
-                    real tMin = mGeometries( mActiveGeometryIndex )->get_field_value( 0, aNodeCoordinates.get_row( 0 ) );
-                    real tMax = tMin;
+                    // Evaluate all nodes at once
+                    Matrix< DDRMat > tFieldValues;
+                    mGeometries( mActiveGeometryIndex )->get_field_values( aNodeIndices, aNodeCoordinates, tFieldValues );
 
-                    // Evaluate the rest of the nodes
-                    for ( uint tNodeCount = 1; tNodeCount < aNodeIndices.length(); tNodeCount++ )
-                    {
-                        real tEval = mGeometries( mActiveGeometryIndex )->    //
-                                     get_field_value( tNodeCount, aNodeCoordinates.get_row( tNodeCount ) );
-
-                        tMin = std::min( tMin, tEval );
-                        tMax = std::max( tMax, tEval );
-                    }
+                    real tMin = tFieldValues.min();
+                    real tMax = tFieldValues.max();
 
                     tIsIntersected = ( tMax >= mIsocontourThreshold and tMin <= mIsocontourThreshold )
                                   or ( std::abs( tMax - mIsocontourThreshold ) < mIsocontourTolerance )
@@ -512,6 +516,75 @@ namespace moris
 
         //--------------------------------------------------------------------------------------------------------------
 
+        void
+        Geometry_Engine::determine_intersected_cells(
+                uint                      aGeometryIndex,
+                const Matrix< DDUMat >&   aCellVertexOffsets,
+                const Matrix< IndexMat >& aCellVertexIndices,
+                const Matrix< DDRMat >&   aVertexCoordinates,
+                Matrix< DDBMat >&         aIsIntersected )
+        {
+            // Evaluate the geometry once per vertex
+            uint tNumVertices = aVertexCoordinates.n_rows();
+
+            Matrix< IndexMat > tVertexIndices( tNumVertices, 1 );
+            for ( uint tVertexIndex = 0; tVertexIndex < tNumVertices; tVertexIndex++ )
+            {
+                tVertexIndices( tVertexIndex ) = tVertexIndex;
+            }
+
+            Matrix< DDRMat > tFieldValues;
+            mGeometries( aGeometryIndex )->get_field_values( tVertexIndices, aVertexCoordinates, tFieldValues );
+
+            // Classify cells from the nodal field values only, which is safe to do in parallel
+            uint tNumCells     = aCellVertexOffsets.numel() > 0 ? aCellVertexOffsets.numel() - 1 : 0;
+            bool tLevelSetMode = mIntersectionMode == Intersection_Mode::LEVEL_SET;
+            real tThreshold    = mIsocontourThreshold;
+            real tTolerance    = mIsocontourTolerance;
+
+            MORIS_ERROR( tLevelSetMode or mIntersectionMode == Intersection_Mode::COLORING,
+                    "Geometry_Engine::determine_intersected_cells(), unknown intersection type." );
+
+            aIsIntersected.set_size( tNumCells, 1 );
+
+            uint tNumThreads = mNumThreads;
+
+#ifdef MORIS_USE_OPENMP
+#pragma omp parallel for num_threads( tNumThreads ) schedule( static )
+#endif
+            for ( uint tCellIndex = 0; tCellIndex < tNumCells; tCellIndex++ )
+            {
+                uint tFirst = aCellVertexOffsets( tCellIndex );
+                uint tLast  = aCellVertexOffsets( tCellIndex + 1 );
+
+                real tFirstValue = tFieldValues( aCellVertexIndices( tFirst ) );
+                real tMin        = tFirstValue;
+                real tMax        = tFirstValue;
+
+                for ( uint tEntry = tFirst + 1; tEntry < tLast; tEntry++ )
+                {
+                    real tValue = tFieldValues( aCellVertexIndices( tEntry ) );
+
+                    tMin = std::min( tMin, tValue );
+                    tMax = std::max( tMax, tValue );
+                }
+
+                if ( tLevelSetMode )
+                {
+                    aIsIntersected( tCellIndex ) = ( tMax >= tThreshold and tMin <= tThreshold )
+                                                or ( std::abs( tMax - tThreshold ) < tTolerance )
+                                                or ( std::abs( tMin - tThreshold ) < tTolerance );
+                }
+                else
+                {
+                    // coloring: intersected if not all vertices have the same color
+                    aIsIntersected( tCellIndex ) = tMin != tMax;
+                }
+            }
+        }
+
+        //--------------------------------------------------------------------------------------------------------------
+
         bool
         Geometry_Engine::queue_intersection(
                 uint                            aFirstNodeIndex,
@@ -2052,24 +2125,21 @@ namespace moris
                 // Set nodal fields based on field names
                 tWriter.set_nodal_fields( tFieldNames );
 
-                // Get all node coordinates
-                Cell< Matrix< DDRMat > > tNodeCoordinates( aMesh->get_num_nodes() );
+                // Get all node indices and coordinates
+                Matrix< IndexMat > tNodeIndices( aMesh->get_num_nodes(), 1 );
+                Matrix< DDRMat >   tNodeCoordinates( aMesh->get_num_nodes(), aMesh->get_spatial_dim() );
                 for ( uint tNodeIndex = 0; tNodeIndex < aMesh->get_num_nodes(); tNodeIndex++ )
                 {
-                    tNodeCoordinates( tNodeIndex ) = aMesh->get_node_coordinate( tNodeIndex );
+                    tNodeIndices( tNodeIndex ) = tNodeIndex;
+                    tNodeCoordinates.set_row( tNodeIndex, aMesh->get_node_coordinate( tNodeIndex ) );
                 }
 
                 // Loop over geometries
                 for ( uint tGeometryIndex = 0; tGeometryIndex < tNumGeometries; tGeometryIndex++ )
                 {
-                    // Create field vector
-                    Matrix< DDRMat > tFieldData( aMesh->get_num_nodes(), 1 );
-
-                    // Assign field to vector
-                    for ( uint tNodeIndex = 0; tNodeIndex < aMesh->get_num_nodes(); tNodeIndex++ )
-                    {
-                        tFieldData( tNodeIndex ) = mGeometries( tGeometryIndex )->get_field_value( tNodeIndex, tNodeCoordinates( tNodeIndex ) );
-                    }
+                    // Evaluate field at all nodes
+                    Matrix< DDRMat > tFieldData;
+                    mGeometries( tGeometryIndex )->get_field_values( tNodeIndices, tNodeCoordinates, tFieldData );
 
                     // Create field on mesh
                     tWriter.write_nodal_field( tFieldNames( tGeometryIndex ), tFieldData );
@@ -2078,14 +2148,9 @@ namespace moris
                 // Loop over properties
                 for ( uint tPropertyIndex = 0; tPropertyIndex < tNumProperties; tPropertyIndex++ )
                 {
-                    // Create field vector
-                    Matrix< DDRMat > tFieldData( aMesh->get_num_nodes(), 1 );
-
-                    // Assign field to vector
-                    for ( uint tNodeIndex = 0; tNodeIndex < aMesh->get_num_nodes(); tNodeIndex++ )
-                    {
-                        tFieldData( tNodeIndex ) = mProperties( tPropertyIndex )->get_field_value( tNodeIndex, tNodeCoordinates( tNodeIndex ) );
-                    }
+                    // Evaluate field at all nodes
+                    Matrix< DDRMat > tFieldData;
+                    mProperties( tPropertyIndex )->get_field_values( tNodeIndices, tNodeCoordinates, tFieldData );
 
                     // Create field on mesh
                     tWriter.write_nodal_field( tFieldNames( tNumGeometries + tPropertyIndex ), tFieldData );
@@ -2443,18 +2508,29 @@ namespace moris
             mVertexGeometricProximity =
                     Cell< Geometric_Proximity >( aMesh->get_num_nodes(), Geometric_Proximity( mGeometries.size() ) );
 
-            // iterate through vertices then geometries
-            for ( uint iV = 0; iV < aMesh->get_num_nodes(); iV++ )
+            // collect all vertex coordinates for batch evaluation
+            uint tNumNodes = aMesh->get_num_nodes();
+
+            Matrix< IndexMat > tNodeIndices( tNumNodes, 1 );
+            Matrix< DDRMat >   tNodeCoordinates( tNumNodes, aMesh->get_spatial_dim() );
+
+            for ( uint iV = 0; iV < tNumNodes; iV++ )
             {
-                Matrix< DDRMat > tCoords = aMesh->get_node_coordinate( moris_index( iV ) );
+                tNodeIndices( iV ) = (moris_index)iV;
+                tNodeCoordinates.set_row( iV, aMesh->get_node_coordinate( moris_index( iV ) ) );
 
                 mVertexGeometricProximity( iV ).mAssociatedVertexIndex = (moris_index)iV;
+            }
 
-                for ( uint iGeometryIndex = 0; iGeometryIndex < mGeometries.size(); iGeometryIndex++ )
-                {
-                    real tVertGeomVal = mGeometries( iGeometryIndex )->get_field_value( iV, tCoords );
+            // iterate through geometries then vertices
+            Matrix< DDRMat > tFieldValues;
+            for ( uint iGeometryIndex = 0; iGeometryIndex < mGeometries.size(); iGeometryIndex++ )
+            {
+                mGeometries( iGeometryIndex )->get_field_values( tNodeIndices, tNodeCoordinates, tFieldValues );
 
-                    moris_index tGeomProxIndex = this->get_geometric_proximity_index( tVertGeomVal );
+                for ( uint iV = 0; iV < tNumNodes; iV++ )
+                {
+                    moris_index tGeomProxIndex = this->get_geometric_proximity_index( tFieldValues( iV ) );
 
                     mVertexGeometricProximity( iV ).set_geometric_proximity( tGeomProxIndex, iGeometryIndex );
                 }
@@ -104,6 +104,9 @@ namespace moris
             bool        mShapeSensitivities = false;
             real        mTimeOffset;
 
+            // Number of threads for classifying background cells
+            uint mNumThreads = 1;
+
             // PDVs
             Pdv_Host_Manager                     mPDVHostManager;
             std::shared_ptr< Intersection_Node > mQueuedIntersectionNode;
@@ -262,10 +265,12 @@ namespace moris
             //-------------------------------------------------------------------------------
             
             /**
-             * Determines if the element consisting of the given node coordinates is intersected.
+             * Determines if the element consisting of the given node coordinates is intersected. In level set mode,
+             * the geometry is evaluated at the mesh node aNodeIndices( i ) with the coordinates in row i. Discrete
+             * geometries therefore use the field values of the element's nodes, not of the nodes 0 to n-1.
              *
-             * @param aNodeIndices Node indices
-             * @param aNodeCoordinates Node coordinates
+             * @param aNodeIndices Mesh indices of the element nodes
+             * @param aNodeCoordinates Node coordinates, one row per node in the order of aNodeIndices
              * @return If the element is intersected
              */
             bool is_intersected(
@@ -279,6 +284,27 @@ namespace moris
                     Cell< std::shared_ptr< Matrix< DDRMat > > >* aNodeCoordinates );
 
             //-------------------------------------------------------------------------------
+
+            /**
+             * Determines for many cells at once if they are intersected by the given geometry. The geometry is
+             * evaluated once per vertex in a batch call; the cells are then classified in parallel, with the number
+             * of threads set by the num_threads parameter, from the nodal field values with the same criterion as
+             * is_intersected().
+             *
+             * @param aGeometryIndex Geometry index
+             * @param aCellVertexOffsets Offsets of each cell into the vertex index list, number of cells + 1 entries
+             * @param aCellVertexIndices Vertex indices of all cells in compressed row format
+             * @param aVertexCoordinates Vertex coordinates, one row per vertex index
+             * @param aIsIntersected Intersection flag of each cell
+             */
+            void determine_intersected_cells(
+                    uint                      aGeometryIndex,
+                    const Matrix< DDUMat >&   aCellVertexOffsets,
+                    const Matrix< IndexMat >& aCellVertexIndices,
+                    const Matrix< DDRMat >&   aVertexCoordinates,
+                    Matrix< DDBMat >&         aIsIntersected );
+
+            //-------------------------------------------------------------------------------
             
             bool geometric_query( Geometric_Query_Interface* aGeometricQuery );
 
@@ -223,6 +223,106 @@ namespace moris
 
         //--------------------------------------------------------------------------------------------------------------
 
+        void
+        BSpline_Field::get_dfield_dadvs_sparse(
+                uint                    aNodeIndex,
+                const Matrix< DDRMat >& aCoordinates,
+                ADV_Sensitivities&      aSensitivities )
+        {
+            // Child nodes join the sensitivities of their ancestors
+            if ( aNodeIndex >= mNumOriginalNodes )
+            {
+                Field::get_dfield_dadvs_sparse( aNodeIndex, aCoordinates, aSensitivities );
+                return;
+            }
+
+            mtk::Mesh* tMesh = mMeshPair.get_interpolation_mesh();
+
+            if ( not tMesh->get_mtk_vertex( aNodeIndex ).has_interpolation( this->get_discretization_mesh_index() ) )
+            {
+                // no sensitivities when no T-matrix has been found, same as the dense evaluation
+                aSensitivities.clear();
+                return;
+            }
+
+            // Build ADV ID table once
+            if ( mNodeADVIdOffsets.numel() == 0 )
+            {
+                this->build_node_adv_id_table();
+            }
+
+            uint tFirst = mNodeADVIdOffsets( aNodeIndex );
+
+            aSensitivities.mValues = tMesh->get_t_matrix_of_node_loc_ind( aNodeIndex, this->get_discretization_mesh_index() ).data();
+            aSensitivities.mADVIds = mNodeADVIds.data() + tFirst;
+            aSensitivities.mSize   = mNodeADVIdOffsets( aNodeIndex + 1 ) - tFirst;
+        }
+
+        //--------------------------------------------------------------------------------------------------------------
+
+        void
+        BSpline_Field::build_node_adv_id_table()
+        {
+            Tracer tTracer( "GEN", "BSpline Field", "Build node ADV ID table" );
+
+            mtk::Mesh* tMesh      = mMeshPair.get_interpolation_mesh();
+            uint       tMeshIndex = this->get_discretization_mesh_index();
+            uint       tNumNodes  = mNumOriginalNodes;
+
+            // Count ADVs per node
+            mNodeADVIdOffsets.set_size( tNumNodes + 1, 1 );
+            mNodeADVIdOffsets( 0 ) = 0;
+
+            for ( uint tNodeIndex = 0; tNodeIndex < tNumNodes; tNodeIndex++ )
+            {
+                uint tNumADVs = 0;
+
+                if ( tMesh->get_mtk_vertex( tNodeIndex ).has_interpolation( tMeshIndex ) )
+                {
+                    tNumADVs = tMesh->get_t_matrix_of_node_loc_ind( tNodeIndex, tMeshIndex ).numel();
+                }
+
+                mNodeADVIdOffsets( tNodeIndex + 1 ) = mNodeADVIdOffsets( tNodeIndex ) + tNumADVs;
+            }
+
+            // Fill ADV IDs
+            mNodeADVIds.set_size( mNodeADVIdOffsets( tNumNodes ), 1 );
+
+            for ( uint tNodeIndex = 0; tNodeIndex < tNumNodes; tNodeIndex++ )
+            {
+                uint tFirst = mNodeADVIdOffsets( tNodeIndex );
+                uint tLast  = mNodeADVIdOffsets( tNodeIndex + 1 );
+
+                if ( tLast > tFirst )
+                {
+                    Matrix< IdMat > tCoefficientIDs = tMesh->get_coefficient_IDs_of_node( tNodeIndex, tMeshIndex );
+
+                    MORIS_ASSERT( tCoefficientIDs.numel() == tLast - tFirst,
+                            "BSpline_Field::build_node_adv_id_table() - Number of coefficient IDs and T-matrix entries do not match." );
+
+                    for ( uint tEntry = tFirst; tEntry < tLast; tEntry++ )
+                    {
+                        mNodeADVIds( tEntry ) = tCoefficientIDs( tEntry - tFirst ) + mADVOffsetID;
+                    }
+                }
+            }
+        }
+
+        //--------------------------------------------------------------------------------------------------------------
+
+        void
+        BSpline_Field::reset_nodal_data()
+        {
+            // Reset child nodes
+            Field_Discrete_Integration::reset_nodal_data();
+
+            // The nodes may have changed with the mesh, rebuild the ADV ID table on the next request
+            mNodeADVIdOffsets.set_size( 0, 0 );
+            mNodeADVIds.set_size( 0, 0 );
+        }
+
+        //--------------------------------------------------------------------------------------------------------------
+
         void
         BSpline_Field::get_coefficient_vector()
         {
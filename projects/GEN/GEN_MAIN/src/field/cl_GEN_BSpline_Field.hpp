@@ -27,6 +27,10 @@ namespace moris
             sol::Dist_Vector* mOwnedNodalValues = nullptr;
             sol::Dist_Vector* mSharedNodalValues = nullptr;
 
+            // ADV IDs of all nodes in compressed row format, built on first request of sparse sensitivities
+            Matrix<DDUMat> mNodeADVIdOffsets;
+            Matrix<DDSMat> mNodeADVIds;
+
         public:
             /**
              * Constructor where ADVs are added based on an input field and a B-spline mesh.
@@ -94,6 +98,21 @@ namespace moris
              */
             Matrix<DDSMat> get_determining_adv_ids(uint aNodeIndex);
 
+            /**
+             * Gets the sparse sensitivities of the field with respect to the ADVs. For nodes of the interpolation
+             * mesh, the values point directly to the T-matrix of the node and the IDs to a table built once per
+             * field, so no memory is allocated. Child nodes, which includes all intersection nodes on the integration
+             * mesh, join the sensitivities of their parents and allocate them as before.
+             *
+             * @param aNodeIndex Node index
+             * @param aCoordinates Node coordinates
+             * @param aSensitivities Sparse sensitivities to be filled
+             */
+            void get_dfield_dadvs_sparse(
+                    uint                  aNodeIndex,
+                    const Matrix<DDRMat>& aCoordinates,
+                    ADV_Sensitivities&    aSensitivities);
+
             /**
              * Imports the local ADVs required from the full owned ADV distributed vector, and recomputes nodal values.
              *
@@ -103,6 +122,11 @@ namespace moris
 
             void get_coefficient_vector();
 
+            /**
+             * Resets all child nodes and the ADV ID table, called when a new XTK mesh is being created.
+             */
+            void reset_nodal_data();
+
         protected:
 
             /**
@@ -121,6 +145,11 @@ namespace moris
              */
             Matrix<DDRMat> map_to_bsplines(std::shared_ptr<Field> aField);
 
+            /**
+             * Builds the table of ADV IDs for all nodes of the interpolation mesh.
+             */
+            void build_node_adv_id_table();
+
         };
     }
 }
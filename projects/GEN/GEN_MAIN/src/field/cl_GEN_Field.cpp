@@ -146,6 +146,76 @@ namespace moris
 
         //--------------------------------------------------------------------------------------------------------------
 
+        void
+        Field::get_dfield_dadvs_sparse(
+                uint                    aNodeIndex,
+                const Matrix< DDRMat >& aCoordinates,
+                ADV_Sensitivities&      aSensitivities )
+        {
+            aSensitivities.mADVIdStorage = this->get_determining_adv_ids( aNodeIndex, aCoordinates );
+            aSensitivities.mValueStorage = this->get_dfield_dadvs( aNodeIndex, aCoordinates );
+
+            aSensitivities.point_to_storage();
+        }
+
+        //--------------------------------------------------------------------------------------------------------------
+
+        void
+        Field::get_field_values(
+                const Matrix< IndexMat >& aNodeIndices,
+                const Matrix< DDRMat >&   aCoordinates,
+                Matrix< DDRMat >&         aFieldValues )
+        {
+            MORIS_ASSERT( aNodeIndices.numel() == aCoordinates.n_rows(),
+                    "Field::get_field_values() - Number of node indices and coordinate rows must match." );
+
+            uint tNumNodes = aNodeIndices.numel();
+
+            aFieldValues.set_size( tNumNodes, 1 );
+
+            for ( uint iNode = 0; iNode < tNumNodes; iNode++ )
+            {
+                aFieldValues( iNode ) = this->get_field_value( aNodeIndices( iNode ), aCoordinates.get_row( iNode ) );
+            }
+        }
+
+        //--------------------------------------------------------------------------------------------------------------
+
+        void
+        Field::get_dfields_dadvs(
+                const Matrix< IndexMat >& aNodeIndices,
+                const Matrix< DDRMat >&   aCoordinates,
+                Matrix< DDRMat >&         aSensitivities )
+        {
+            MORIS_ASSERT( aNodeIndices.numel() == aCoordinates.n_rows(),
+                    "Field::get_dfields_dadvs() - Number of node indices and coordinate rows must match." );
+
+            uint tNumNodes = aNodeIndices.numel();
+
+            for ( uint iNode = 0; iNode < tNumNodes; iNode++ )
+            {
+                const Matrix< DDRMat >& tSensitivities = this->get_dfield_dadvs( aNodeIndices( iNode ), aCoordinates.get_row( iNode ) );
+
+                // size output with the first evaluation, all nodes have the same number of sensitivities
+                if ( iNode == 0 )
+                {
+                    aSensitivities.set_size( tNumNodes, tSensitivities.numel() );
+                }
+
+                for ( uint iADV = 0; iADV < tSensitivities.numel(); iADV++ )
+                {
+                    aSensitivities( iNode, iADV ) = tSensitivities( iADV );
+                }
+            }
+
+            if ( tNumNodes == 0 )
+            {
+                aSensitivities.set_size( 0, mSensitivities.numel() );
+            }
+        }
+
+        //--------------------------------------------------------------------------------------------------------------
+
         template< typename Vector_Type >
         void
         Field::set_advs( Vector_Type& aADVs )
@@ -13,6 +13,7 @@
 
 #include "cl_MTK_Field.hpp"
 #include "st_GEN_Field_Parameters.hpp"
+#include "st_GEN_ADV_Sensitivities.hpp"
 #include "cl_GEN_Child_Node.hpp"
 #include "cl_SOL_Dist_Vector.hpp"
 #include "cl_MTK_Interpolation_Mesh.hpp"
@@ -131,6 +132,46 @@ namespace moris
                     const Matrix< DDRMat >& aCoordinates,
                     Matrix< DDRMat >&       aSensitivities ) = 0;
 
+            /**
+             * Given a node index or coordinates, gets the sparse field derivatives with respect to the ADVs this
+             * field depends on, together with their IDs. The default implementation copies the results of
+             * get_determining_adv_ids() and get_dfield_dadvs() into the storage of aSensitivities.
+             *
+             * @param aNodeIndex Node index
+             * @param aCoordinates Vector of coordinate values
+             * @param aSensitivities Sparse sensitivities to be filled
+             */
+            virtual void get_dfield_dadvs_sparse(
+                    uint                    aNodeIndex,
+                    const Matrix< DDRMat >& aCoordinates,
+                    ADV_Sensitivities&      aSensitivities );
+
+            /**
+             * Evaluates the field at many nodes at once. The default implementation calls get_field_value() node by
+             * node; analytic fields override this with a loop over the coordinate columns.
+             *
+             * @param aNodeIndices Node indices
+             * @param aCoordinates Node coordinates, one row per node
+             * @param aFieldValues Field values, one row per node
+             */
+            virtual void get_field_values(
+                    const Matrix< IndexMat >& aNodeIndices,
+                    const Matrix< DDRMat >&   aCoordinates,
+                    Matrix< DDRMat >&         aFieldValues );
+
+            /**
+             * Evaluates the field derivatives with respect to its ADVs at many nodes at once. The default
+             * implementation calls get_dfield_dadvs() node by node.
+             *
+             * @param aNodeIndices Node indices
+             * @param aCoordinates Node coordinates, one row per node
+             * @param aSensitivities d(field value)/d(ADV_j), one row per node
+             */
+            virtual void get_dfields_dadvs(
+                    const Matrix< IndexMat >& aNodeIndices,
+                    const Matrix< DDRMat >&   aCoordinates,
+                    Matrix< DDRMat >&         aSensitivities );
+
             /**
              * Sets the ADVs and grabs the field variables needed from the ADV vector
              *
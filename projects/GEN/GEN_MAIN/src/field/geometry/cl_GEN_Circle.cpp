@@ -64,6 +64,77 @@ namespace moris
 
         //--------------------------------------------------------------------------------------------------------------
 
+        void
+        Circle::get_field_values(
+                const Matrix< IndexMat >& aNodeIndices,
+                const Matrix< DDRMat >&   aCoordinates,
+                Matrix< DDRMat >&         aFieldValues )
+        {
+            // Get variables
+            const real tXCenter = *( mFieldVariables( 0 ) );
+            const real tYCenter = *( mFieldVariables( 1 ) );
+            const real tRadius  = *( mFieldVariables( 2 ) );
+
+            uint tNumNodes = aCoordinates.n_rows();
+
+            aFieldValues.set_size( tNumNodes, 1 );
+
+            // Coordinates are stored column by column
+            const real* tX      = aCoordinates.data();
+            const real* tY      = tX + tNumNodes;
+            real*       tValues = aFieldValues.data();
+
+            // Evaluate field
+            for ( uint iNode = 0; iNode < tNumNodes; iNode++ )
+            {
+                const real tDeltaX = tX[ iNode ] - tXCenter;
+                const real tDeltaY = tY[ iNode ] - tYCenter;
+
+                tValues[ iNode ] = std::sqrt( tDeltaX * tDeltaX + tDeltaY * tDeltaY ) - tRadius;
+            }
+        }
+
+        //--------------------------------------------------------------------------------------------------------------
+
+        void
+        Circle::get_dfields_dadvs(
+                const Matrix< IndexMat >& aNodeIndices,
+                const Matrix< DDRMat >&   aCoordinates,
+                Matrix< DDRMat >&         aSensitivities )
+        {
+            // Get variables
+            const real tXCenter = *( mFieldVariables( 0 ) );
+            const real tYCenter = *( mFieldVariables( 1 ) );
+
+            uint tNumNodes = aCoordinates.n_rows();
+
+            aSensitivities.set_size( tNumNodes, 3 );
+
+            // Coordinates and sensitivities are stored column by column
+            const real* tX        = aCoordinates.data();
+            const real* tY        = tX + tNumNodes;
+            real*       tDXCenter = aSensitivities.data();
+            real*       tDYCenter = tDXCenter + tNumNodes;
+            real*       tDRadius  = tDYCenter + tNumNodes;
+
+            // Calculate sensitivities
+            for ( uint iNode = 0; iNode < tNumNodes; iNode++ )
+            {
+                const real tDeltaX = tX[ iNode ] - tXCenter;
+                const real tDeltaY = tY[ iNode ] - tYCenter;
+
+                real tConstant = std::sqrt( tDeltaX * tDeltaX + tDeltaY * tDeltaY );
+
+                tConstant = tConstant ? 1.0 / tConstant : 0.0;
+
+                tDXCenter[ iNode ] = -tConstant * tDeltaX;
+                tDYCenter[ iNode ] = -tConstant * tDeltaY;
+                tDRadius[ iNode ]  = -1.0;
+            }
+        }
+
+        //--------------------------------------------------------------------------------------------------------------
+
         void
         Circle::get_dfield_dcoordinates(
                 const Matrix< DDRMat >& aCoordinates,
@@ -26,7 +26,8 @@ namespace moris
                 std::string               aObjectPath,
                 Matrix< DDRMat >          aObjectOffset,
                 real                      aSDFShift,
-                Geometry_Field_Parameters aParameters )
+                Geometry_Field_Parameters aParameters,
+                uint                      aNumThreads )
                 : Field( Matrix< DDRMat >( 1, 1, 0.0 ), aParameters )
                 , Geometry( aParameters )
                 , Field_Discrete_Integration()
@@ -39,6 +40,8 @@ namespace moris
             }
 
             mShift = aSDFShift;
+
+            mNumThreads = aNumThreads;
         }
 
         //--------------------------------------------------------------------------------------------------------------
@@ -73,6 +76,8 @@ namespace moris
 
                 sdf::SDF_Generator tSDFGenerator( mObjectPath, mObjectOffset, true );
 
+                tSDFGenerator.set_num_threads( mNumThreads );
+
                 tSDFGenerator.calculate_sdf( tMesh, mValues );
 
                 for ( uint Ik = 0; Ik < mValues.numel(); Ik++ )
@@ -29,6 +29,7 @@ namespace moris
             std::string      mObjectPath   = "";
             Matrix< DDRMat > mObjectOffset = { { 0, 0, 0 } };
             real             mShift        = 0;
+            uint             mNumThreads   = 1;
 
             Matrix< DDRMat > mDummyMat;
 
@@ -42,7 +43,8 @@ namespace moris
             Geometry_SDF( std::string         aObjectPath,
                     Matrix< DDRMat >          aObjectOffset,
                     real                      aSDFShift   = 0,
-                    Geometry_Field_Parameters aParameters = {} );
+                    Geometry_Field_Parameters aParameters = {},
+                    uint                      aNumThreads = 1 );
 
             /**
              * Given a node index, returns the field value.
@@ -88,6 +88,121 @@ namespace moris
 
         //--------------------------------------------------------------------------------------------------------------
 
+        void Multigeometry::get_field_values(
+                const Matrix<IndexMat>& aNodeIndices,
+                const Matrix<DDRMat>&   aCoordinates,
+                Matrix<DDRMat>&         aFieldValues)
+        {
+            mGeometries(0)->get_field_values(aNodeIndices, aCoordinates, aFieldValues);
+
+            Matrix<DDRMat> tGeometryValues;
+            for (uint tGeometryIndex = 1; tGeometryIndex < mGeometries.size(); tGeometryIndex++)
+            {
+                mGeometries(tGeometryIndex)->get_field_values(aNodeIndices, aCoordinates, tGeometryValues);
+
+                for (uint iNode = 0; iNode < aFieldValues.numel(); iNode++)
+                {
+                    aFieldValues(iNode) = std::min(aFieldValues(iNode), tGeometryValues(iNode));
+                }
+            }
+        }
+
+        //--------------------------------------------------------------------------------------------------------------
+
+        void Multigeometry::get_dfields_dadvs(
+                const Matrix<IndexMat>& aNodeIndices,
+                const Matrix<DDRMat>&   aCoordinates,
+                Matrix<DDRMat>&         aSensitivities)
+        {
+            uint tNumNodes = aCoordinates.n_rows();
+
+            // Find which geometry is the minimum at each node
+            Matrix<DDRMat> tMin;
+            Matrix<DDRMat> tGeometryValues;
+            Matrix<DDUMat> tMinGeometryIndices(tNumNodes, 1, 0);
+
+            mGeometries(0)->get_field_values(aNodeIndices, aCoordinates, tMin);
+
+            for (uint tGeometryIndex = 1; tGeometryIndex < mGeometries.size(); tGeometryIndex++)
+            {
+                mGeometries(tGeometryIndex)->get_field_values(aNodeIndices, aCoordinates, tGeometryValues);
+
+                for (uint iNode = 0; iNode < tNumNodes; iNode++)
+                {
+                    if (tGeometryValues(iNode) < tMin(iNode))
+                    {
+                        tMin(iNode) = tGeometryValues(iNode);
+                        tMinGeometryIndices(iNode) = tGeometryIndex;
+                    }
+                }
+            }
+
+            // Evaluate each geometry only at the nodes where it is the minimum
+            Matrix<IndexMat> tSubsetIndices;
+            Matrix<DDRMat>   tSubsetCoordinates;
+            Matrix<DDRMat>   tSubsetSensitivities;
+            Matrix<DDUMat>   tSubsetNodes(tNumNodes, 1);
+            bool             tIsFirstSubset = true;
+
+            for (uint tGeometryIndex = 0; tGeometryIndex < mGeometries.size(); tGeometryIndex++)
+            {
+                uint tNumSubsetNodes = 0;
+                for (uint iNode = 0; iNode < tNumNodes; iNode++)
+                {
+                    if (tMinGeometryIndices(iNode) == tGeometryIndex)
+                    {
+                        tSubsetNodes(tNumSubsetNodes++) = iNode;
+                    }
+                }
+
+                if (tNumSubsetNodes == 0)
+                {
+                    continue;
+                }
+
+                tSubsetIndices.set_size(tNumSubsetNodes, 1);
+                tSubsetCoordinates.set_size(tNumSubsetNodes, aCoordinates.n_cols());
+
+                for (uint iSubset = 0; iSubset < tNumSubsetNodes; iSubset++)
+                {
+                    tSubsetIndices(iSubset) = aNodeIndices(tSubsetNodes(iSubset));
+
+                    for (uint iDimension = 0; iDimension < aCoordinates.n_cols(); iDimension++)
+                    {
+                        tSubsetCoordinates(iSubset, iDimension) = aCoordinates(tSubsetNodes(iSubset), iDimension);
+                    }
+                }
+
+                mGeometries(tGeometryIndex)->get_dfields_dadvs(tSubsetIndices, tSubsetCoordinates, tSubsetSensitivities);
+
+                // All geometries share the ADVs of the first one, so the number of sensitivities has to match
+                if (tIsFirstSubset)
+                {
+                    aSensitivities.set_size(tNumNodes, tSubsetSensitivities.n_cols());
+                    tIsFirstSubset = false;
+                }
+
+                MORIS_ERROR(tSubsetSensitivities.n_cols() == aSensitivities.n_cols(),
+                        "Multigeometry::get_dfields_dadvs() - All geometries need the same number of sensitivities.");
+
+                for (uint iADV = 0; iADV < aSensitivities.n_cols(); iADV++)
+                {
+                    for (uint iSubset = 0; iSubset < tNumSubsetNodes; iSubset++)
+                    {
+                        aSensitivities(tSubsetNodes(iSubset), iADV) = tSubsetSensitivities(iSubset, iADV);
+                    }
+                }
+            }
+
+            // No nodes given
+            if (tIsFirstSubset)
+            {
+                aSensitivities.set_size(0, 0);
+            }
+        }
+
+        //--------------------------------------------------------------------------------------------------------------
+
         void Multigeometry::add_geometry(std::shared_ptr<Geometry> aGeometry)
         {
             mGeometries.push_back(aGeometry);
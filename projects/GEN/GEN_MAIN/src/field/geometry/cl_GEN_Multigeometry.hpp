@@ -67,6 +67,31 @@ namespace moris
                     const Matrix<DDRMat>& aCoordinates,
                     Matrix<DDRMat>&       aSensitivities);
 
+            /**
+             * Evaluates the minimum of all geometries at many nodes at once.
+             *
+             * @param aNodeIndices Node indices
+             * @param aCoordinates Node coordinates, one row per node
+             * @param aFieldValues Field values, one row per node
+             */
+            void get_field_values(
+                    const Matrix<IndexMat>& aNodeIndices,
+                    const Matrix<DDRMat>&   aCoordinates,
+                    Matrix<DDRMat>&         aFieldValues);
+
+            /**
+             * Evaluates the ADV sensitivities at many nodes at once, taken from the geometry which is the minimum at
+             * each node.
+             *
+             * @param aNodeIndices Node indices
+             * @param aCoordinates Node coordinates, one row per node
+             * @param aSensitivities Sensitivities, one row per node
+             */
+            void get_dfields_dadvs(
+                    const Matrix<IndexMat>& aNodeIndices,
+                    const Matrix<DDRMat>&   aCoordinates,
+                    Matrix<DDRMat>&         aSensitivities);
+
             /**
              * Adds a geometry to this multigeometry.
              *
@@ -65,6 +65,89 @@ namespace moris
 
         //--------------------------------------------------------------------------------------------------------------
 
+        void
+        Plane::get_field_values(
+                const Matrix< IndexMat >& aNodeIndices,
+                const Matrix< DDRMat >&   aCoordinates,
+                Matrix< DDRMat >&         aFieldValues )
+        {
+            uint tNumNodes = aCoordinates.n_rows();
+
+            aFieldValues.set_size( tNumNodes, 1 );
+
+            // Coordinates are stored column by column
+            const real* tX      = aCoordinates.data();
+            const real* tY      = tX + tNumNodes;
+            real*       tValues = aFieldValues.data();
+
+            if ( mFieldVariables.size() == 4 )
+            {
+                // Get variables
+                const real tXCenter = *( mFieldVariables( 0 ) );
+                const real tYCenter = *( mFieldVariables( 1 ) );
+                const real tXNormal = *( mFieldVariables( 2 ) );
+                const real tYNormal = *( mFieldVariables( 3 ) );
+
+                // Evaluate field values
+                for ( uint iNode = 0; iNode < tNumNodes; iNode++ )
+                {
+                    tValues[ iNode ] = tXNormal * ( tX[ iNode ] - tXCenter ) + tYNormal * ( tY[ iNode ] - tYCenter );
+                }
+            }
+            else
+            {
+                // Get variables
+                const real tXCenter = *( mFieldVariables( 0 ) );
+                const real tYCenter = *( mFieldVariables( 1 ) );
+                const real tZCenter = *( mFieldVariables( 2 ) );
+                const real tXNormal = *( mFieldVariables( 3 ) );
+                const real tYNormal = *( mFieldVariables( 4 ) );
+                const real tZNormal = *( mFieldVariables( 5 ) );
+
+                const real* tZ = tY + tNumNodes;
+
+                // Evaluate field values
+                for ( uint iNode = 0; iNode < tNumNodes; iNode++ )
+                {
+                    tValues[ iNode ] = tXNormal * ( tX[ iNode ] - tXCenter ) + tYNormal * ( tY[ iNode ] - tYCenter ) + tZNormal * ( tZ[ iNode ] - tZCenter );
+                }
+            }
+        }
+
+        //--------------------------------------------------------------------------------------------------------------
+
+        void
+        Plane::get_dfields_dadvs(
+                const Matrix< IndexMat >& aNodeIndices,
+                const Matrix< DDRMat >&   aCoordinates,
+                Matrix< DDRMat >&         aSensitivities )
+        {
+            uint tNumNodes      = aCoordinates.n_rows();
+            uint tNumDimensions = mFieldVariables.size() / 2;
+
+            aSensitivities.set_size( tNumNodes, 2 * tNumDimensions );
+
+            // Sensitivities with respect to the center are the negative normal, with respect to the normal they are
+            // the distance to the center
+            for ( uint iDimension = 0; iDimension < tNumDimensions; iDimension++ )
+            {
+                const real  tCenter     = *( mFieldVariables( iDimension ) );
+                const real  tNormal     = *( mFieldVariables( iDimension + tNumDimensions ) );
+                const real* tCoordinate = aCoordinates.data() + iDimension * tNumNodes;
+
+                real* tDCenter = aSensitivities.data() + iDimension * tNumNodes;
+                real* tDNormal = aSensitivities.data() + ( iDimension + tNumDimensions ) * tNumNodes;
+
+                for ( uint iNode = 0; iNode < tNumNodes; iNode++ )
+                {
+                    tDCenter[ iNode ] = -tNormal;
+                    tDNormal[ iNode ] = tCoordinate[ iNode ] - tCenter;
+                }
+            }
+        }
+
+        //--------------------------------------------------------------------------------------------------------------
+
         void
         Plane::get_dfield_dcoordinates(
                 const Matrix< DDRMat >& aCoordinates,
@@ -73,6 +73,85 @@ namespace moris
 
         //--------------------------------------------------------------------------------------------------------------
 
+        void
+        Sphere::get_field_values(
+                const Matrix< IndexMat >& aNodeIndices,
+                const Matrix< DDRMat >&   aCoordinates,
+                Matrix< DDRMat >&         aFieldValues )
+        {
+            // Get variables
+            const real tXCenter = *( mFieldVariables( 0 ) );
+            const real tYCenter = *( mFieldVariables( 1 ) );
+            const real tZCenter = *( mFieldVariables( 2 ) );
+            const real tRadius  = *( mFieldVariables( 3 ) );
+
+            uint tNumNodes = aCoordinates.n_rows();
+
+            aFieldValues.set_size( tNumNodes, 1 );
+
+            // Coordinates are stored column by column
+            const real* tX      = aCoordinates.data();
+            const real* tY      = tX + tNumNodes;
+            const real* tZ      = tY + tNumNodes;
+            real*       tValues = aFieldValues.data();
+
+            // Evaluate field
+            for ( uint iNode = 0; iNode < tNumNodes; iNode++ )
+            {
+                const real tDeltaX = tX[ iNode ] - tXCenter;
+                const real tDeltaY = tY[ iNode ] - tYCenter;
+                const real tDeltaZ = tZ[ iNode ] - tZCenter;
+
+                tValues[ iNode ] = std::sqrt( tDeltaX * tDeltaX + tDeltaY * tDeltaY + tDeltaZ * tDeltaZ ) - tRadius;
+            }
+        }
+
+        //--------------------------------------------------------------------------------------------------------------
+
+        void
+        Sphere::get_dfields_dadvs(
+                const Matrix< IndexMat >& aNodeIndices,
+                const Matrix< DDRMat >&   aCoordinates,
+                Matrix< DDRMat >&         aSensitivities )
+        {
+            // Get variables
+            const real tXCenter = *( mFieldVariables( 0 ) );
+            const real tYCenter = *( mFieldVariables( 1 ) );
+            const real tZCenter = *( mFieldVariables( 2 ) );
+
+            uint tNumNodes = aCoordinates.n_rows();
+
+            aSensitivities.set_size( tNumNodes, 4 );
+
+            // Coordinates and sensitivities are stored column by column
+            const real* tX        = aCoordinates.data();
+            const real* tY        = tX + tNumNodes;
+            const real* tZ        = tY + tNumNodes;
+            real*       tDXCenter = aSensitivities.data();
+            real*       tDYCenter = tDXCenter + tNumNodes;
+            real*       tDZCenter = tDYCenter + tNumNodes;
+            real*       tDRadius  = tDZCenter + tNumNodes;
+
+            // Calculate sensitivities
+            for ( uint iNode = 0; iNode < tNumNodes; iNode++ )
+            {
+                const real tDeltaX = tX[ iNode ] - tXCenter;
+                const real tDeltaY = tY[ iNode ] - tYCenter;
+                const real tDeltaZ = tZ[ iNode ] - tZCenter;
+
+                real tConstant = std::sqrt( tDeltaX * tDeltaX + tDeltaY * tDeltaY + tDeltaZ * tDeltaZ );
+
+                tConstant = tConstant ? 1.0 / tConstant : 0.0;
+
+                tDXCenter[ iNode ] = -tConstant * tDeltaX;
+                tDYCenter[ iNode ] = -tConstant * tDeltaY;
+                tDZCenter[ iNode ] = -tConstant * tDeltaZ;
+                tDRadius[ iNode ]  = -1.0;
+            }
+        }
+
+        //--------------------------------------------------------------------------------------------------------------
+
         void
         Sphere::get_dfield_dcoordinates(
                 const Matrix< DDRMat >& aCoordinates,
@@ -66,12 +66,18 @@ namespace moris
 
         void Stored_Geometry::evaluate_nodal_values()
         {
-            // Assign nodal values
+            // Collect node indices and coordinates
             uint tNumNodes = mMesh->get_num_nodes();
+            Matrix<IndexMat> tNodeIndices(tNumNodes, 1);
+            Matrix<DDRMat>   tNodeCoordinates(tNumNodes, mMesh->get_spatial_dim());
             for (uint tNodeIndex = 0; tNodeIndex < tNumNodes; tNodeIndex++)
             {
-                mFieldValues(tNodeIndex) = mGeometry->get_field_value(tNodeIndex, mMesh->get_node_coordinate(tNodeIndex));
+                tNodeIndices(tNodeIndex) = tNodeIndex;
+                tNodeCoordinates.set_row(tNodeIndex, mMesh->get_node_coordinate(tNodeIndex));
             }
+
+            // Assign nodal values
+            mGeometry->get_field_values(tNodeIndices, tNodeCoordinates, mFieldValues);
         }
 
         //--------------------------------------------------------------------------------------------------------------
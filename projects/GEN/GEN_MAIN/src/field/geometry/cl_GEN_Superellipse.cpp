@@ -109,6 +109,114 @@ namespace moris
 
         //--------------------------------------------------------------------------------------------------------------
 
+        void Superellipse::get_field_values(
+                const Matrix<IndexMat>& aNodeIndices,
+                const Matrix<DDRMat>&   aCoordinates,
+                Matrix<DDRMat>&         aFieldValues)
+        {
+            // Get variables
+            const real tXCenter        = *(mFieldVariables(0));
+            const real tYCenter        = *(mFieldVariables(1));
+            const real tXSemidiameter  = *(mFieldVariables(2));
+            const real tYSemidiameter  = *(mFieldVariables(3));
+            const real tExponent       = *(mFieldVariables(4));
+            const real tScaling        = *(mFieldVariables(5));
+            const real tRegularization = *(mFieldVariables(6));
+            const real tShift          = *(mFieldVariables(7));
+
+            // Node independent terms
+            const real tRegularizationTerm = pow(tRegularization, tExponent);
+            const real tInverseExponent    = 1.0 / tExponent;
+
+            uint tNumNodes = aCoordinates.n_rows();
+
+            aFieldValues.set_size(tNumNodes, 1);
+
+            // Coordinates are stored column by column
+            const real* tX      = aCoordinates.data();
+            const real* tY      = tX + tNumNodes;
+            real*       tValues = aFieldValues.data();
+
+            // Evaluate field
+            for (uint iNode = 0; iNode < tNumNodes; iNode++)
+            {
+                real tConstant = pow(
+                        pow((tX[iNode] - tXCenter) / tXSemidiameter, tExponent) +
+                        pow((tY[iNode] - tYCenter) / tYSemidiameter, tExponent) +
+                        tRegularizationTerm, tInverseExponent) - tRegularization;
+
+                real tLevelset = tScaling * (tConstant - 1.0);
+
+                // Ensure that level set value is not approx. zero at evaluation point
+                if (std::abs(tLevelset) < tShift)
+                {
+                    tLevelset += tLevelset < 0.0 ? -tShift : tShift;
+                }
+
+                tValues[iNode] = tLevelset;
+            }
+        }
+
+        //--------------------------------------------------------------------------------------------------------------
+
+        void Superellipse::get_dfields_dadvs(
+                const Matrix<IndexMat>& aNodeIndices,
+                const Matrix<DDRMat>&   aCoordinates,
+                Matrix<DDRMat>&         aSensitivities)
+        {
+            // Get variables
+            const real tXCenter        = *(mFieldVariables(0));
+            const real tYCenter        = *(mFieldVariables(1));
+            const real tXSemidiameter  = *(mFieldVariables(2));
+            const real tYSemidiameter  = *(mFieldVariables(3));
+            const real tExponent       = *(mFieldVariables(4));
+            const real tScaling        = *(mFieldVariables(5));
+            const real tRegularization = *(mFieldVariables(6));
+
+            // Node independent terms
+            const real tRegularizationTerm = pow(tRegularization, tExponent);
+            const real tOuterExponent      = 1.0 / tExponent - 1.0;
+            const real tXSquared           = pow(tXSemidiameter, 2.0);
+            const real tYSquared           = pow(tYSemidiameter, 2.0);
+
+            uint tNumNodes = aCoordinates.n_rows();
+
+            // the reminder sensitivities are typically not used and therefore not calculated
+            aSensitivities.set_size(tNumNodes, 8, MORIS_REAL_MAX);
+
+            // Coordinates and sensitivities are stored column by column
+            const real* tX              = aCoordinates.data();
+            const real* tY              = tX + tNumNodes;
+            real*       tDXCenter       = aSensitivities.data();
+            real*       tDYCenter       = tDXCenter + tNumNodes;
+            real*       tDXSemidiameter = tDYCenter + tNumNodes;
+            real*       tDYSemidiameter = tDXSemidiameter + tNumNodes;
+
+            // Calculate sensitivities
+            for (uint iNode = 0; iNode < tNumNodes; iNode++)
+            {
+                const real tDeltaX = tX[iNode] - tXCenter;
+                const real tDeltaY = tY[iNode] - tYCenter;
+
+                // Constant in all calculations
+                const real tConstant0 = pow(
+                        pow(tDeltaX / tXSemidiameter, tExponent) +
+                        pow(tDeltaY / tYSemidiameter, tExponent) +
+                        tRegularizationTerm, tOuterExponent);
+
+                const real tConstant1 = pow(tDeltaX / tXSemidiameter, tExponent - 1.0);
+                const real tConstant2 = pow(tDeltaY / tYSemidiameter, tExponent - 1.0);
+
+                tDXCenter[iNode] = -tScaling * tConstant1 * tConstant0 / tXSemidiameter;
+                tDYCenter[iNode] = -tScaling * tConstant2 * tConstant0 / tYSemidiameter;
+
+                tDXSemidiameter[iNode] = -tScaling * tDeltaX * tConstant1 * tConstant0 / tXSquared;
+                tDYSemidiameter[iNode] = -tScaling * tDeltaY * tConstant2 * tConstant0 / tYSquared;
+            }
+        }
+
+        //--------------------------------------------------------------------------------------------------------------
+
         void Superellipse::get_dfield_dcoordinates(
                 const Matrix<DDRMat>& aCoordinates,
                 Matrix<DDRMat>&       aSensitivities)
@@ -93,6 +93,30 @@ namespace moris
              */
             const Matrix<DDRMat>& get_dfield_dadvs(const Matrix<DDRMat>& aCoordinates);
 
+            /**
+             * Evaluates the field at many nodes at once.
+             *
+             * @param aNodeIndices Node indices
+             * @param aCoordinates Node coordinates, one row per node
+             * @param aFieldValues Field values, one row per node
+             */
+            void get_field_values(
+                    const Matrix<IndexMat>& aNodeIndices,
+                    const Matrix<DDRMat>&   aCoordinates,
+                    Matrix<DDRMat>&         aFieldValues);
+
+            /**
+             * Evaluates the sensitivities with respect to all geometry variables at many nodes at once.
+             *
+             * @param aNodeIndices Node indices
+             * @param aCoordinates Node coordinates, one row per node
+             * @param aSensitivities Sensitivities, one row per node
+             */
+            void get_dfields_dadvs(
+                    const Matrix<IndexMat>& aNodeIndices,
+                    const Matrix<DDRMat>&   aCoordinates,
+                    Matrix<DDRMat>&         aSensitivities);
+
             /**
              * Given nodal coordinates, returns a vector of the field derivatives with respect to the nodal
              * coordinates.
@@ -100,6 +100,115 @@ namespace moris
 
         //--------------------------------------------------------------------------------------------------------------
 
+        void Superellipsoid::get_field_values(
+                const Matrix<IndexMat>& aNodeIndices,
+                const Matrix<DDRMat>&   aCoordinates,
+                Matrix<DDRMat>&         aFieldValues)
+        {
+            // Get variables
+            const real tXCenter = *(mFieldVariables(0));
+            const real tYCenter = *(mFieldVariables(1));
+            const real tZCenter = *(mFieldVariables(2));
+            const real tXSemidiameter = *(mFieldVariables(3));
+            const real tYSemidiameter = *(mFieldVariables(4));
+            const real tZSemidiameter = *(mFieldVariables(5));
+            const real tExponent = *(mFieldVariables(6));
+
+            const real tInverseExponent = 1.0 / tExponent;
+
+            uint tNumNodes = aCoordinates.n_rows();
+
+            aFieldValues.set_size(tNumNodes, 1);
+
+            // Coordinates are stored column by column
+            const real* tX      = aCoordinates.data();
+            const real* tY      = tX + tNumNodes;
+            const real* tZ      = tY + tNumNodes;
+            real*       tValues = aFieldValues.data();
+
+            // Evaluate field
+            for (uint iNode = 0; iNode < tNumNodes; iNode++)
+            {
+                tValues[iNode] = pow(pow(std::abs(tX[iNode] - tXCenter) / tXSemidiameter, tExponent)
+                                   + pow(std::abs(tY[iNode] - tYCenter) / tYSemidiameter, tExponent)
+                                   + pow(std::abs(tZ[iNode] - tZCenter) / tZSemidiameter, tExponent), tInverseExponent) - 1.0;
+            }
+        }
+
+        //--------------------------------------------------------------------------------------------------------------
+
+        void Superellipsoid::get_dfields_dadvs(
+                const Matrix<IndexMat>& aNodeIndices,
+                const Matrix<DDRMat>&   aCoordinates,
+                Matrix<DDRMat>&         aSensitivities)
+        {
+            // Get variables
+            const real tXCenter = *(mFieldVariables(0));
+            const real tYCenter = *(mFieldVariables(1));
+            const real tZCenter = *(mFieldVariables(2));
+            const real tXSemidiameter = *(mFieldVariables(3));
+            const real tYSemidiameter = *(mFieldVariables(4));
+            const real tZSemidiameter = *(mFieldVariables(5));
+            const real tExponent = *(mFieldVariables(6));
+
+            // Node independent terms
+            const real tOuterExponent = -1.0 + (1.0 / tExponent);
+            const real tXCenterFactor = pow(1.0 / tXSemidiameter, tExponent);
+            const real tYCenterFactor = pow(1.0 / tYSemidiameter, tExponent);
+            const real tZCenterFactor = pow(1.0 / tZSemidiameter, tExponent);
+            const real tXSemidiameterFactor = pow(1.0 / tXSemidiameter, tExponent + 1.0);
+            const real tYSemidiameterFactor = pow(1.0 / tYSemidiameter, tExponent + 1.0);
+            const real tZSemidiameterFactor = pow(1.0 / tZSemidiameter, tExponent + 1.0);
+
+            uint tNumNodes = aCoordinates.n_rows();
+
+            aSensitivities.set_size(tNumNodes, 7);
+
+            // Coordinates and sensitivities are stored column by column
+            const real* tX = aCoordinates.data();
+            const real* tY = tX + tNumNodes;
+            const real* tZ = tY + tNumNodes;
+
+            real* tSensitivities = aSensitivities.data();
+
+            // Calculate sensitivities
+            for (uint iNode = 0; iNode < tNumNodes; iNode++)
+            {
+                const real tDeltaX = tX[iNode] - tXCenter;
+                const real tDeltaY = tY[iNode] - tYCenter;
+                const real tDeltaZ = tZ[iNode] - tZCenter;
+
+                const real tAbsX = std::abs(tDeltaX);
+                const real tAbsY = std::abs(tDeltaY);
+                const real tAbsZ = std::abs(tDeltaZ);
+
+                // Constant in all calculations
+                real tConstant = pow(tAbsX / tXSemidiameter, tExponent)
+                               + pow(tAbsY / tYSemidiameter, tExponent)
+                               + pow(tAbsZ / tZSemidiameter, tExponent);
+                tConstant = tConstant ? pow(tConstant, tOuterExponent) : 0.0;
+
+                tSensitivities[iNode]                 = -tConstant * tXCenterFactor * tDeltaX * pow(tAbsX, tExponent - 2.0);
+                tSensitivities[iNode + tNumNodes]     = -tConstant * tYCenterFactor * tDeltaY * pow(tAbsY, tExponent - 2.0);
+                tSensitivities[iNode + 2 * tNumNodes] = -tConstant * tZCenterFactor * tDeltaZ * pow(tAbsZ, tExponent - 2.0);
+                tSensitivities[iNode + 3 * tNumNodes] = -tConstant * tXSemidiameterFactor * pow(tAbsX, tExponent);
+                tSensitivities[iNode + 4 * tNumNodes] = -tConstant * tYSemidiameterFactor * pow(tAbsY, tExponent);
+                tSensitivities[iNode + 5 * tNumNodes] = -tConstant * tZSemidiameterFactor * pow(tAbsZ, tExponent);
+
+                // TODO? this uses FD only because the analytical function is super complicated for the exponent derivative
+                tSensitivities[iNode + 6 * tNumNodes] =
+                        (pow(pow(tAbsX / tXSemidiameter, tExponent + mEpsilon)
+                           + pow(tAbsY / tYSemidiameter, tExponent + mEpsilon)
+                           + pow(tAbsZ / tZSemidiameter, tExponent + mEpsilon), 1.0 / (tExponent + mEpsilon))
+                       - pow(pow(tAbsX / tXSemidiameter, tExponent - mEpsilon)
+                           + pow(tAbsY / tYSemidiameter, tExponent - mEpsilon)
+                           + pow(tAbsZ / tZSemidiameter, tExponent - mEpsilon), 1.0 / (tExponent - mEpsilon)))
+                      / (2.0 * mEpsilon);
+            }
+        }
+
+        //--------------------------------------------------------------------------------------------------------------
+
         void Superellipsoid::get_dfield_dcoordinates(
                 const Matrix<DDRMat>& aCoordinates,
                 Matrix<DDRMat>&       aSensitivities)
@@ -281,12 +281,16 @@ namespace moris
                 std::string      tObjectPath   = aGeometryParameterList.get< std::string >( "sdf_object_path" );
                 Matrix< DDRMat > tObjectOffset = string_to_mat< DDRMat >( aGeometryParameterList.get< std::string >( "sdf_object_offset" ) );
                 real             tSDFShift     = aGeometryParameterList.get< real >( "sdf_shift" );
+                sint             tNumThreads   = aGeometryParameterList.get< sint >( "sdf_num_threads" );
+
+                MORIS_ERROR( tNumThreads > 0, "create_geometry() - sdf_num_threads needs to be positive." );
 
                 return std::make_shared< ge::Geometry_SDF >(
                         tObjectPath,
                         tObjectOffset,
                         tSDFShift,
-                        tParameters );
+                        tParameters,
+                        static_cast< uint >( tNumThreads ) );
             }
             else if ( tGeometryType == "image_sdf" )
             {
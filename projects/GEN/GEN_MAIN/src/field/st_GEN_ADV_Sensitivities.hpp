@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * st_GEN_ADV_Sensitivities.hpp
+ *
+ */
+
+#ifndef MORIS_ST_GEN_ADV_SENSITIVITIES_HPP
+#define MORIS_ST_GEN_ADV_SENSITIVITIES_HPP
+
+#include "cl_Matrix.hpp"
+
+namespace moris
+{
+    namespace ge
+    {
+        /**
+         * Sparse sensitivities of a field value with respect to the ADVs it depends on. Values and ADV IDs are
+         * pointers to data owned by the field or by the mesh (e.g. the T-matrix of a node), so filling this struct
+         * does not allocate. The pointers are only valid until the next evaluation of the same field.
+         *
+         * Fields which cannot point to existing data copy their sensitivities into the storage matrices of this
+         * struct; these are reused when the same struct is filled repeatedly.
+         */
+        struct ADV_Sensitivities
+        {
+            const real* mValues = nullptr;    //! d(field value)/d(ADV_j)
+            const sint* mADVIds = nullptr;    //! IDs of the ADVs, negative IDs are to be skipped
+            uint        mSize   = 0;          //! Number of entries
+
+            Matrix< DDRMat > mValueStorage;     //! Storage for values not owned by a field or mesh
+            Matrix< DDSMat > mADVIdStorage;     //! Storage for ADV IDs not owned by a field or mesh
+
+            /**
+             * Points the values and ADV IDs to the storage matrices.
+             */
+            void
+            point_to_storage()
+            {
+                MORIS_ASSERT( mValueStorage.numel() == mADVIdStorage.numel(),
+                        "ADV_Sensitivities - Number of sensitivities (%zu) and ADV IDs (%zu) do not match.",
+                        mValueStorage.numel(),
+                        mADVIdStorage.numel() );
+
+                mValues = mValueStorage.data();
+                mADVIds = mADVIdStorage.data();
+                mSize   = mADVIdStorage.numel();
+            }
+
+            /**
+             * Sets this struct to not depend on any ADVs.
+             */
+            void
+            clear()
+            {
+                mValues = nullptr;
+                mADVIds = nullptr;
+                mSize   = 0;
+            }
+        };
+    }    // namespace ge
+}    // namespace moris
+
+#endif    // MORIS_ST_GEN_ADV_SENSITIVITIES_HPP
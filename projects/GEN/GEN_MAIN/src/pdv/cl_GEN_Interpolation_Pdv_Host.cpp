@@ -12,6 +12,7 @@
 #include "cl_GEN_Pdv_Value.hpp"
 #include "cl_GEN_Pdv_Property.hpp"
 #include "cl_GEN_Pdv_Host_Manager.hpp"
+#include "cl_GEN_Field_Analytic.hpp"
 
 #include "fn_stringify_matrix.hpp"
 
@@ -343,6 +344,42 @@ namespace moris
 
         //--------------------------------------------------------------------------------------------------------------
 
+        void
+        Interpolation_Pdv_Host::get_sparse_sensitivities(
+                uint               aPDVIndex,
+                ADV_Sensitivities& aSensitivities )
+        {
+            // If PDV exists and is active, ask it for sensitivities; otherwise, no ADV dependence
+            if ( mPDVs( aPDVIndex ) and mPDVs( aPDVIndex )->mIsActive )
+            {
+                mPDVs( aPDVIndex )->get_sparse_sensitivities( mNodeIndex, mCoordinates, aSensitivities );
+            }
+            else
+            {
+                aSensitivities.clear();
+            }
+        }
+
+        //--------------------------------------------------------------------------------------------------------------
+
+        std::shared_ptr< Property >
+        Interpolation_Pdv_Host::get_analytic_property( uint aPDVIndex )
+        {
+            if ( mPDVs( aPDVIndex ) and mPDVs( aPDVIndex )->mIsActive )
+            {
+                Pdv_Property* tPdvProperty = dynamic_cast< Pdv_Property* >( mPDVs( aPDVIndex ).get() );
+
+                if ( tPdvProperty and dynamic_cast< Field_Analytic* >( tPdvProperty->get_property().get() ) )
+                {
+                    return tPdvProperty->get_property();
+                }
+            }
+
+            return nullptr;
+        }
+
+        //--------------------------------------------------------------------------------------------------------------
+
         void
         Interpolation_Pdv_Host::print_state()
         {
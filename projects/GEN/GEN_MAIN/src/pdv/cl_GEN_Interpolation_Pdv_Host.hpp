@@ -188,6 +188,37 @@ namespace moris
              */
             Matrix< DDSMat > get_determining_adv_ids( uint aPDVIndex );
 
+            /**
+             * Gets the sparse sensitivities of the given PDV with respect to the ADVs it depends on.
+             *
+             * @param aPDVIndex PDV index
+             * @param aSensitivities Sparse sensitivities to be filled
+             */
+            void get_sparse_sensitivities(
+                    uint               aPDVIndex,
+                    ADV_Sensitivities& aSensitivities );
+
+            /**
+             * Gets the property of the given PDV if the PDV is active and the property is analytic. Analytic
+             * properties depend on the same ADVs at every node, so their sensitivities can be evaluated for many
+             * nodes at once.
+             *
+             * @param aPDVIndex PDV index
+             * @return Analytic property, nullptr otherwise
+             */
+            std::shared_ptr< Property > get_analytic_property( uint aPDVIndex );
+
+            /**
+             * Gets the index of the node of this host.
+             *
+             * @return Node index
+             */
+            moris_index
+            get_index()
+            {
+                return mNodeIndex;
+            }
+
             /**
              * Gets coordinates stored with host.
              * @return coordinates
@@ -29,6 +29,19 @@ namespace moris
 
         //--------------------------------------------------------------------------------------------------------------
 
+        void
+        Pdv::get_sparse_sensitivities(
+                uint                    aNodeIndex,
+                const Matrix< DDRMat >& aCoordinates,
+                ADV_Sensitivities&      aSensitivities )
+        {
+            aSensitivities.mADVIdStorage = this->get_determining_adv_ids( aNodeIndex, aCoordinates );
+            aSensitivities.mValueStorage = this->get_sensitivities( aNodeIndex, aCoordinates );
+            aSensitivities.point_to_storage();
+        }
+
+        //--------------------------------------------------------------------------------------------------------------
+
     }
 }
 
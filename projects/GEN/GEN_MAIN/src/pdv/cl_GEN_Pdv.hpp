@@ -12,6 +12,7 @@
 #define MORIS_CL_GEN_PDV_HPP_
 
 #include "cl_Matrix.hpp"
+#include "st_GEN_ADV_Sensitivities.hpp"
 
 namespace moris
 {
@@ -83,6 +84,19 @@ namespace moris
              * @return ADV IDs
              */
             virtual Matrix< DDSMat > get_determining_adv_ids( uint aNodeIndex, const Matrix< DDRMat >& aCoordinates ) = 0;
+
+            /**
+             * Gets the sparse PDV sensitivities with respect to the ADVs this PDV depends on. The default
+             * implementation copies the results of get_determining_adv_ids() and get_sensitivities().
+             *
+             * @param aNodeIndex Node index
+             * @param aCoordinates Coordinate values
+             * @param aSensitivities Sparse sensitivities to be filled
+             */
+            virtual void get_sparse_sensitivities(
+                    uint                    aNodeIndex,
+                    const Matrix< DDRMat >& aCoordinates,
+                    ADV_Sensitivities&      aSensitivities );
         };
     }    // namespace ge
 }    // namespace moris
@@ -9,6 +9,7 @@
  */
 
 #include "cl_GEN_Pdv_Host_Manager.hpp"
+#include "cl_GEN_Property.hpp"
 #include "cl_SOL_Matrix_Vector_Factory.hpp"
 #include "cl_Communication_Tools.hpp"
 #include "fn_trans.hpp"
@@ -737,6 +738,122 @@ namespace moris
             // Initialize derivatives of IQIs wrt Advs to zero
             tdIQIdADV->vec_put_scalar( 0.0 );
 
+            // Sparse sensitivities and assembly buffers, reused for all interpolation PDVs
+            ADV_Sensitivities tSparseSensitivities;
+            Matrix< DDSMat >  tUsedADVIds;
+            Matrix< DDRMat >  tUsedADVSensitivities;
+            Matrix< DDRMat >  tSparseIQISensitivity;
+
+            // Interpolation PDVs defined by analytic properties, grouped by property
+            Cell< std::shared_ptr< Property > > tAnalyticProperties;
+            Cell< Cell< uint > >                tAnalyticHostIndices;
+            Cell< Cell< uint > >                tAnalyticPDVIndices;
+
+            for ( uint tPDVHostIndex = 0; tPDVHostIndex < mIpPdvHosts.size(); tPDVHostIndex++ )
+            {
+                if ( mIpPdvHosts( tPDVHostIndex ) and mIpPdvHosts( tPDVHostIndex )->get_pdv_owning_processor() == par_rank() )
+                {
+                    for ( uint tPDVIndex = 0; tPDVIndex < mIpPdvHosts( tPDVHostIndex )->get_num_pdvs(); tPDVIndex++ )
+                    {
+                        std::shared_ptr< Property > tProperty = mIpPdvHosts( tPDVHostIndex )->get_analytic_property( tPDVIndex );
+
+                        if ( tProperty == nullptr or mIpPdvHosts( tPDVHostIndex )->get_pdv_id( tPDVIndex ) == -1 )
+                        {
+                            continue;
+                        }
+
+                        // find group of this property, properties are few
+                        uint tGroupIndex = 0;
+                        while ( tGroupIndex < tAnalyticProperties.size() and tAnalyticProperties( tGroupIndex ) != tProperty )
+                        {
+                            tGroupIndex++;
+                        }
+
+                        if ( tGroupIndex == tAnalyticProperties.size() )
+                        {
+                            tAnalyticProperties.push_back( tProperty );
+                            tAnalyticHostIndices.push_back( Cell< uint >() );
+                            tAnalyticPDVIndices.push_back( Cell< uint >() );
+                        }
+
+                        tAnalyticHostIndices( tGroupIndex ).push_back( tPDVHostIndex );
+                        tAnalyticPDVIndices( tGroupIndex ).push_back( tPDVIndex );
+                    }
+                }
+            }
+
+            // Evaluate the sensitivities of each analytic property at all of its nodes at once
+            for ( uint tGroupIndex = 0; tGroupIndex < tAnalyticProperties.size(); tGroupIndex++ )
+            {
+                const Cell< uint >& tHostIndices = tAnalyticHostIndices( tGroupIndex );
+
+                uint tNumNodes      = tHostIndices.size();
+                uint tNumDimensions = mIpPdvHosts( tHostIndices( 0 ) )->get_coords().numel();
+
+                Matrix< IndexMat > tNodeIndices( tNumNodes, 1 );
+                Matrix< DDRMat >   tNodeCoordinates( tNumNodes, tNumDimensions );
+
+                for ( uint iNode = 0; iNode < tNumNodes; iNode++ )
+                {
+                    const Matrix< DDRMat >& tCoordinates = mIpPdvHosts( tHostIndices( iNode ) )->get_coords();
+
+                    tNodeIndices( iNode ) = mIpPdvHosts( tHostIndices( iNode ) )->get_index();
+
+                    for ( uint iDimension = 0; iDimension < tNumDimensions; iDimension++ )
+                    {
+                        tNodeCoordinates( iNode, iDimension ) = tCoordinates( iDimension );
+                    }
+                }
+
+                Matrix< DDRMat > tSensitivities;
+                tAnalyticProperties( tGroupIndex )->get_dfields_dadvs( tNodeIndices, tNodeCoordinates, tSensitivities );
+
+                // ADV IDs are the same at all nodes of an analytic property
+                Matrix< DDSMat > tADVIds = tAnalyticProperties( tGroupIndex )->get_determining_adv_ids( tNodeIndices( 0 ), tNodeCoordinates.get_row( 0 ) );
+
+                // keep sensitivities wrt used variables only
+                Cell< uint > tUsedColumns;
+                for ( uint iADV = 0; iADV < tADVIds.numel(); iADV++ )
+                {
+                    if ( tADVIds( iADV ) >= 0 )
+                    {
+                        tUsedColumns.push_back( iADV );
+                    }
+                }
+
+                if ( tUsedColumns.size() == 0 )
+                {
+                    continue;
+                }
+
+                tUsedADVIds.set_size( 1, tUsedColumns.size() );
+                tSparseIQISensitivity.set_size( 1, tUsedColumns.size() );
+
+                for ( uint tEntry = 0; tEntry < tUsedColumns.size(); tEntry++ )
+                {
+                    tUsedADVIds( tEntry ) = tADVIds( tUsedColumns( tEntry ) );
+                }
+
+                for ( uint iNode = 0; iNode < tNumNodes; iNode++ )
+                {
+                    moris_id tPDVID = mIpPdvHosts( tHostIndices( iNode ) )->get_pdv_id( tAnalyticPDVIndices( tGroupIndex )( iNode ) );
+
+                    // loop over all IQIs
+                    for ( uint tVectorIndex = 0; tVectorIndex < (uint)tNumIQIs; tVectorIndex++ )
+                    {
+                        real tdIQIdPDVValue = ( *tdIQIdPDV )( tPDVID, tVectorIndex );
+
+                        for ( uint tEntry = 0; tEntry < tUsedColumns.size(); tEntry++ )
+                        {
+                            tSparseIQISensitivity( tEntry ) = tdIQIdPDVValue * tSensitivities( iNode, tUsedColumns( tEntry ) );
+                        }
+
+                        // Fill matrix
+                        tdIQIdADV->sum_into_global_values( tUsedADVIds, tSparseIQISensitivity, tVectorIndex );
+                    }
+                }
+            }
+
             // Loop of interpolation PDV hosts
             for ( uint tPDVHostIndex = 0; tPDVHostIndex < mIpPdvHosts.size(); tPDVHostIndex++ )
             {
@@ -756,27 +873,55 @@ namespace moris
                             moris_id tPDVID = mIpPdvHosts( tPDVHostIndex )->get_pdv_id( tPDVIndex );
 
                             // FIXME checking if the pdv is defined
-                            if ( tPDVID != -1 )
+                            // PDVs of analytic properties have been assembled above
+                            if ( tPDVID != -1 and mIpPdvHosts( tPDVHostIndex )->get_analytic_property( tPDVIndex ) == nullptr )
                             {
-                                // Get sensitivities
-                                Matrix< DDRMat > tHostADVSensitivities =
-                                        mIpPdvHosts( tPDVHostIndex )->get_sensitivities( tPDVIndex );
+                                // Get sparse sensitivities, pointing to field or mesh data where possible
+                                mIpPdvHosts( tPDVHostIndex )->get_sparse_sensitivities( tPDVIndex, tSparseSensitivities );
+
+                                // count sensitivities wrt used variables
+                                uint tNumUsedADVs = 0;
+                                for ( uint tEntry = 0; tEntry < tSparseSensitivities.mSize; tEntry++ )
+                                {
+                                    if ( tSparseSensitivities.mADVIds[ tEntry ] >= 0 )
+                                    {
+                                        tNumUsedADVs++;
+                                    }
+                                }
+
+                                if ( tNumUsedADVs == 0 )
+                                {
+                                    continue;
+                                }
 
-                                // Get ADV IDs
-                                Matrix< DDSMat > tADVIds =
-                                        mIpPdvHosts( tPDVHostIndex )->get_determining_adv_ids( tPDVIndex );
+                                // gather sensitivities wrt used variables into reused buffers
+                                tUsedADVIds.set_size( 1, tNumUsedADVs );
+                                tUsedADVSensitivities.set_size( 1, tNumUsedADVs );
+                                tSparseIQISensitivity.set_size( 1, tNumUsedADVs );
 
-                                // remove sensitivities wrt unused variables
-                                this->remove_sensitivities_of_unused_variables( tADVIds, tHostADVSensitivities );
+                                uint tCounter = 0;
+                                for ( uint tEntry = 0; tEntry < tSparseSensitivities.mSize; tEntry++ )
+                                {
+                                    if ( tSparseSensitivities.mADVIds[ tEntry ] >= 0 )
+                                    {
+                                        tUsedADVIds( tCounter )           = tSparseSensitivities.mADVIds[ tEntry ];
+                                        tUsedADVSensitivities( tCounter ) = tSparseSensitivities.mValues[ tEntry ];
+                                        tCounter++;
+                                    }
+                                }
 
                                 // loop over all IQIs
                                 for ( uint tVectorIndex = 0; tVectorIndex < (uint)tNumIQIs; tVectorIndex++ )
                                 {
-                                    Matrix< DDRMat > tIndividualSensitivity =
-                                            ( *tdIQIdPDV )( tPDVID, tVectorIndex ) * tHostADVSensitivities;
+                                    real tdIQIdPDVValue = ( *tdIQIdPDV )( tPDVID, tVectorIndex );
+
+                                    for ( uint tEntry = 0; tEntry < tNumUsedADVs; tEntry++ )
+                                    {
+                                        tSparseIQISensitivity( tEntry ) = tdIQIdPDVValue * tUsedADVSensitivities( tEntry );
+                                    }
 
                                     // Fill matrix
-                                    tdIQIdADV->sum_into_global_values( tADVIds, tIndividualSensitivity, tVectorIndex );
+                                    tdIQIdADV->sum_into_global_values( tUsedADVIds, tSparseIQISensitivity, tVectorIndex );
                                 }
                             }
                         }
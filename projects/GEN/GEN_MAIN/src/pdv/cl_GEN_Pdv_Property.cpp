@@ -59,5 +59,16 @@ namespace moris
 
         //--------------------------------------------------------------------------------------------------------------
 
+        void
+        Pdv_Property::get_sparse_sensitivities(
+                uint                    aNodeIndex,
+                const Matrix< DDRMat >& aCoordinates,
+                ADV_Sensitivities&      aSensitivities )
+        {
+            mProperty->get_dfield_dadvs_sparse( aNodeIndex, aCoordinates, aSensitivities );
+        }
+
+        //--------------------------------------------------------------------------------------------------------------
+
     }    // namespace ge
 }    // namespace moris
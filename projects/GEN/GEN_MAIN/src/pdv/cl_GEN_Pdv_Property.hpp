@@ -68,6 +68,29 @@ namespace moris
             Matrix< DDSMat > get_determining_adv_ids(
                     uint                    aNodeIndex,
                     const Matrix< DDRMat >& aCoordinates );
+
+            /**
+             * Gets the sparse PDV sensitivities directly from the property.
+             *
+             * @param aNodeIndex Node index
+             * @param aCoordinates Coordinate values
+             * @param aSensitivities Sparse sensitivities to be filled
+             */
+            void get_sparse_sensitivities(
+                    uint                    aNodeIndex,
+                    const Matrix< DDRMat >& aCoordinates,
+                    ADV_Sensitivities&      aSensitivities );
+
+            /**
+             * Gets the property defining this PDV.
+             *
+             * @return Property
+             */
+            std::shared_ptr< Property >
+            get_property()
+            {
+                return mProperty;
+            }
         };
     }    // namespace ge
 }    // namespace moris
@@ -36,6 +36,7 @@ namespace moris
              * @var mGeometryFieldFile File name for writing geometry field values
              * @var mOutputMeshFile File name for writing an exodus mesh
              * @var mTimeOffset Time offset for writing sequential meshes
+             * @var mNumThreads Number of threads for classifying background cells
              */
             Matrix<DDRMat>                  mADVs = {{}};
             Cell<std::shared_ptr<Geometry>> mGeometries = {};
@@ -49,6 +50,7 @@ namespace moris
             std::string                     mGeometryFieldFile = "";
             std::string                     mOutputMeshFile = "";
             real                            mTimeOffset = 0.0;
+            uint                            mNumThreads = 1;
         };
     }
 }
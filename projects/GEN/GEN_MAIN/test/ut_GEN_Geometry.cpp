@@ -601,6 +601,16 @@ namespace moris
                                                               + tOffset;
                                         check_equal( tBSplineGeometry->get_dfield_dadvs( tNodeIndex, { {} } ), tMatrix );
                                         check_equal( tBSplineGeometry->get_determining_adv_ids( tNodeIndex, { {} } ), tIDs );
+
+                                        // Sparse sensitivities must match the dense ones
+                                        ADV_Sensitivities tSparseSensitivities;
+                                        tBSplineGeometry->get_dfield_dadvs_sparse( tNodeIndex, { {} }, tSparseSensitivities );
+                                        REQUIRE( tSparseSensitivities.mSize == tIDs.numel() );
+                                        for ( uint tEntry = 0; tEntry < tSparseSensitivities.mSize; tEntry++ )
+                                        {
+                                            CHECK( tSparseSensitivities.mValues[ tEntry ] == Approx( tMatrix( tEntry ) ) );
+                                            CHECK( tSparseSensitivities.mADVIds[ tEntry ] == tIDs( tEntry ) );
+                                        }
                                     }
                                 }
 
@@ -627,6 +637,27 @@ namespace moris
                                 // Reset ADVs for next geometry
                                 tADVs = tADVs - ( tRadii( tGeometryIndex ) / 2.0 );
                                 tGeometryEngine.set_advs( tADVs );
+
+                                // Sparse sensitivities must still match the dense ones after the nodal data is reset
+                                tGeometryEngine.reset_mesh_information( tMesh );
+                                for ( uint tNodeIndex = 0; tNodeIndex < tMesh->get_num_nodes(); tNodeIndex++ )
+                                {
+                                    if ( (uint)par_rank() == tMesh->get_entity_owner( tNodeIndex, EntityRank::NODE, 0 ) )
+                                    {
+                                        Matrix< DDRMat > tMatrix = trans( tMesh->get_t_matrix_of_node_loc_ind( tNodeIndex, 0 ) );
+                                        Matrix< DDSMat > tIDs    = trans( tMesh->get_coefficient_IDs_of_node( tNodeIndex, 0 ) )
+                                                              + tOffset;
+
+                                        ADV_Sensitivities tSparseSensitivities;
+                                        tBSplineGeometry->get_dfield_dadvs_sparse( tNodeIndex, { {} }, tSparseSensitivities );
+                                        REQUIRE( tSparseSensitivities.mSize == tIDs.numel() );
+                                        for ( uint tEntry = 0; tEntry < tSparseSensitivities.mSize; tEntry++ )
+                                        {
+                                            CHECK( tSparseSensitivities.mValues[ tEntry ] == Approx( tMatrix( tEntry ) ) );
+                                            CHECK( tSparseSensitivities.mADVIds[ tEntry ] == tIDs( tEntry ) );
+                                        }
+                                    }
+                                }
                             }
 
                             // Delete mesh pointer
@@ -781,6 +812,134 @@ namespace moris
 
         //--------------------------------------------------------------------------------------------------------------
 
+        TEST_CASE( "Batch Evaluation", "[gen], [geometry], [batch evaluation]" )
+        {
+            // Compares batch evaluation against node by node evaluation
+            auto tCheckBatchEvaluation = []( std::shared_ptr< Geometry > aGeometry, uint aNumDimensions )
+            {
+                // Nodes on a regular grid, shifted to not hit any centers exactly
+                uint               tNumNodesPerDimension = aNumDimensions == 2 ? 11 : 5;
+                uint               tNumNodes             = std::pow( tNumNodesPerDimension, aNumDimensions );
+                Matrix< IndexMat > tNodeIndices( tNumNodes, 1 );
+                Matrix< DDRMat >   tCoordinates( tNumNodes, aNumDimensions );
+
+                for ( uint iNode = 0; iNode < tNumNodes; iNode++ )
+                {
+                    tNodeIndices( iNode ) = iNode;
+
+                    uint tRemainder = iNode;
+                    for ( uint iDimension = 0; iDimension < aNumDimensions; iDimension++ )
+                    {
+                        tCoordinates( iNode, iDimension ) = 0.7 * ( tRemainder % tNumNodesPerDimension ) + 0.13 * iDimension;
+                        tRemainder /= tNumNodesPerDimension;
+                    }
+                }
+
+                // Batch evaluation
+                Matrix< DDRMat > tFieldValues;
+                Matrix< DDRMat > tSensitivities;
+                aGeometry->get_field_values( tNodeIndices, tCoordinates, tFieldValues );
+                aGeometry->get_dfields_dadvs( tNodeIndices, tCoordinates, tSensitivities );
+
+                REQUIRE( tFieldValues.numel() == tNumNodes );
+                REQUIRE( tSensitivities.n_rows() == tNumNodes );
+
+                // Node by node evaluation
+                for ( uint iNode = 0; iNode < tNumNodes; iNode++ )
+                {
+                    Matrix< DDRMat > tNodeCoordinates = tCoordinates.get_row( iNode );
+
+                    CHECK( tFieldValues( iNode ) == Approx( aGeometry->get_field_value( iNode, tNodeCoordinates ) ).margin( 1e-12 ) );
+
+                    Matrix< DDRMat > tBatchSensitivities = tSensitivities.get_row( iNode );
+                    Matrix< DDRMat > tNodeSensitivities  = aGeometry->get_dfield_dadvs( iNode, tNodeCoordinates );
+                    check_equal( tBatchSensitivities, tNodeSensitivities, 1e-12 );
+                }
+            };
+
+            SECTION( "Circle" )
+            {
+                ParameterList tParameterList = prm::create_geometry_parameter_list();
+                tParameterList.set( "type", "circle" );
+                tParameterList.set( "field_variable_indices", "all" );
+                tParameterList.set( "adv_indices", "all" );
+
+                Matrix< DDRMat > tADVs = { { 3.1, 2.4, 1.5 } };
+                tCheckBatchEvaluation( create_geometry( tParameterList, tADVs ), 2 );
+            }
+
+            SECTION( "Sphere" )
+            {
+                ParameterList tParameterList = prm::create_geometry_parameter_list();
+                tParameterList.set( "type", "sphere" );
+                tParameterList.set( "field_variable_indices", "all" );
+                tParameterList.set( "adv_indices", "all" );
+
+                Matrix< DDRMat > tADVs = { { 1.1, 1.6, 1.2, 1.5 } };
+                tCheckBatchEvaluation( create_geometry( tParameterList, tADVs ), 3 );
+            }
+
+            SECTION( "Plane" )
+            {
+                ParameterList tParameterList = prm::create_geometry_parameter_list();
+                tParameterList.set( "type", "plane" );
+                tParameterList.set( "field_variable_indices", "all" );
+                tParameterList.set( "adv_indices", "all" );
+
+                Matrix< DDRMat > t2DADVs = { { 1.0, 2.0, 0.6, 0.8 } };
+                tCheckBatchEvaluation( create_geometry( tParameterList, t2DADVs ), 2 );
+
+                Matrix< DDRMat > t3DADVs = { { 1.0, 2.0, 1.5, 0.0, 0.6, 0.8 } };
+                tCheckBatchEvaluation( create_geometry( tParameterList, t3DADVs ), 3 );
+            }
+
+            SECTION( "Superellipse" )
+            {
+                ParameterList tParameterList = prm::create_geometry_parameter_list();
+                tParameterList.set( "type", "superellipse" );
+                tParameterList.set( "field_variable_indices", "all" );
+                tParameterList.set( "adv_indices", "all" );
+
+                Matrix< DDRMat > tADVs = { { 3.0, 4.0, 1.0, 2.0, 4.0, 1.0, 0.1, 0.01 } };
+                tCheckBatchEvaluation( create_geometry( tParameterList, tADVs ), 2 );
+            }
+
+            SECTION( "Superellipsoid" )
+            {
+                ParameterList tParameterList = prm::create_geometry_parameter_list();
+                tParameterList.set( "type", "superellipsoid" );
+                tParameterList.set( "field_variable_indices", "all" );
+                tParameterList.set( "adv_indices", "all" );
+
+                Matrix< DDRMat > tADVs = { { 1.2, 1.6, 1.4, 1.0, 2.0, 1.5, 3.0 } };
+                tCheckBatchEvaluation( create_geometry( tParameterList, tADVs ), 3 );
+            }
+
+            SECTION( "Multigeometry" )
+            {
+                Cell< ParameterList > tParameterLists( 2 );
+                tParameterLists( 0 ) = prm::create_geometry_parameter_list();
+                tParameterLists( 0 ).set( "type", "circle" );
+                tParameterLists( 0 ).set( "field_variable_indices", "all" );
+                tParameterLists( 0 ).set( "adv_indices", "0, 1, 3" );
+                tParameterLists( 0 ).set( "name", "circles" );
+
+                tParameterLists( 1 ) = prm::create_geometry_parameter_list();
+                tParameterLists( 1 ).set( "type", "circle" );
+                tParameterLists( 1 ).set( "field_variable_indices", "all" );
+                tParameterLists( 1 ).set( "adv_indices", "0, 2, 4" );
+                tParameterLists( 1 ).set( "name", "circles" );
+
+                Matrix< DDRMat >                    tADVs       = { { 2.1, 1.3, 5.2, 1.0, 2.0 } };
+                Cell< std::shared_ptr< Geometry > > tGeometries = create_geometries( tParameterLists, tADVs );
+
+                REQUIRE( tGeometries.size() == 1 );
+                tCheckBatchEvaluation( tGeometries( 0 ), 2 );
+            }
+        }
+
+        //--------------------------------------------------------------------------------------------------------------
+
         TEST_CASE( "Swiss Cheese Slice", "[gen], [geometry], [swiss cheese slice]" )
         {
             // Set up geometry
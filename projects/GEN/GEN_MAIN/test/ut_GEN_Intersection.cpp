@@ -83,6 +83,59 @@ namespace moris
                     { false, true, false, true }
                 };
 
+                // Check bulk classification of all elements, followed by triangles made of the first three nodes of
+                // each element to cover cells with different numbers of vertices
+                Matrix< DDUMat >   tCellVertexOffsets( 9, 1, 0 );
+                Matrix< IndexMat > tCellVertexIndices( 28, 1 );
+                for ( uint tCellIndex = 0; tCellIndex < 8; tCellIndex++ )
+                {
+                    Matrix< IndexMat > tNodeIndices = tMesh->get_nodes_connected_to_element_loc_inds( tCellIndex % 4 );
+                    uint               tNumCellNodes = tCellIndex < 4 ? 4 : 3;
+
+                    tCellVertexOffsets( tCellIndex + 1 ) = tCellVertexOffsets( tCellIndex ) + tNumCellNodes;
+                    for ( uint tNodeNumber = 0; tNodeNumber < tNumCellNodes; tNodeNumber++ )
+                    {
+                        tCellVertexIndices( tCellVertexOffsets( tCellIndex ) + tNodeNumber ) = tNodeIndices( tNodeNumber );
+                    }
+                }
+
+                Matrix< DDRMat > tVertexCoordinates( tMesh->get_num_nodes(), 2 );
+                for ( uint tNodeIndex = 0; tNodeIndex < tMesh->get_num_nodes(); tNodeIndex++ )
+                {
+                    tVertexCoordinates.set_row( tNodeIndex, tMesh->get_node_coordinate( tNodeIndex ) );
+                }
+
+                for ( uint tGeometryIndex = 0; tGeometryIndex < 3; tGeometryIndex++ )
+                {
+                    Matrix< DDBMat > tIsIntersected;
+                    tGeometryEngine.determine_intersected_cells(
+                            tGeometryIndex, tCellVertexOffsets, tCellVertexIndices, tVertexCoordinates, tIsIntersected );
+
+                    REQUIRE( tIsIntersected.numel() == 8 );
+                    for ( uint tElementIndex = 0; tElementIndex < 4; tElementIndex++ )
+                    {
+                        CHECK( (bool)tIsIntersected( tElementIndex ) == tIsElementIntersected( tGeometryIndex )( tElementIndex ) );
+                    }
+
+                    // Triangles are intersected if their nodal values change sign
+                    std::shared_ptr< Geometry > tGeometry = tGeometryEngine.get_geometry( tGeometryIndex );
+                    for ( uint tCellIndex = 4; tCellIndex < 8; tCellIndex++ )
+                    {
+                        real tMin = MORIS_REAL_MAX;
+                        real tMax = -MORIS_REAL_MAX;
+                        for ( uint tEntry = tCellVertexOffsets( tCellIndex ); tEntry < tCellVertexOffsets( tCellIndex + 1 ); tEntry++ )
+                        {
+                            uint tNodeIndex = tCellVertexIndices( tEntry );
+                            real tValue     = tGeometry->get_field_value( tNodeIndex, tMesh->get_node_coordinate( tNodeIndex ) );
+
+                            tMin = std::min( tMin, tValue );
+                            tMax = std::max( tMax, tValue );
+                        }
+
+                        CHECK( (bool)tIsIntersected( tCellIndex ) == ( tMin <= 0.0 and tMax >= 0.0 ) );
+                    }
+                }
+
                 // Per geometry, per element, per edge
                 Cell< Cell< Cell< bool > > > tIsEdgeIntersected = {
                     { { false, true, true, false },          // Geometry 0, Element 0
@@ -923,5 +976,86 @@ namespace moris
 
         //--------------------------------------------------------------------------------------------------------------
 
+        TEST_CASE( "Level Set Intersection of Discrete Geometry", "[gen], [intersection], [discrete intersection]" )
+        {
+            if ( par_size() == 1 )
+            {
+                // Two quads next to each other, only the last node has a negative level set value
+                uint             tNumDim = 2;
+                Matrix< DDRMat > tCoords = {
+                    { 0.0, 0.0 },
+                    { 1.0, 0.0 },
+                    { 2.0, 0.0 },
+                    { 0.0, 1.0 },
+                    { 1.0, 1.0 },
+                    { 2.0, 1.0 }
+                };
+
+                Matrix< IdMat > tElemConn = {
+                    { 1, 2, 5, 4 },
+                    { 2, 3, 6, 5 }
+                };
+
+                Matrix< IdMat > tElemLocaltoGlobal = { { 1 }, { 2 } };
+
+                // Create MORIS mesh using MTK database
+                moris::mtk::MtkMeshData tMeshData;
+                tMeshData.CreateAllEdgesAndFaces    = true;
+                tMeshData.SpatialDim                = &tNumDim;
+                tMeshData.ElemConn( 0 )             = &tElemConn;
+                tMeshData.NodeCoords                = &tCoords;
+                tMeshData.LocaltoGlobalElemMap( 0 ) = &tElemLocaltoGlobal;
+
+                moris::mtk::Scalar_Field_Info< DDRMat > tLSF;
+                std::string                             tLSFName = "lsf1";
+                tLSF.set_field_name( tLSFName );
+                tLSF.set_field_entity_rank( moris::EntityRank::NODE );
+
+                // Add to mesh input field container
+                moris::mtk::MtkFieldsInfo tFieldsInfo;
+                add_field_for_mesh_input( &tLSF, tFieldsInfo );
+                tMeshData.FieldsInfo = &tFieldsInfo;
+
+                moris::mtk::Interpolation_Mesh* tMesh = moris::mtk::create_interpolation_mesh( MeshType::STK, tMeshData );
+
+                uint             tNumNodes = tMesh->get_num_entities( moris::EntityRank::NODE );
+                Matrix< DDRMat > tLevelsetValues( tNumNodes, 1, 1.0 );
+
+                tLevelsetValues( tMesh->get_loc_entity_ind_from_entity_glb_id( 6, EntityRank::NODE ) ) = -1.0;
+
+                tMesh->add_mesh_field_real_scalar_data_loc_inds( tLSFName, moris::EntityRank::NODE, tLevelsetValues );
+
+                Cell< std::shared_ptr< ge::Geometry > > tGeometry( 1 );
+                tGeometry( 0 ) = std::make_shared< moris::ge::Mesh_Field_Geometry >( tMesh, tLSFName );
+
+                moris::ge::Geometry_Engine_Parameters tGeometryEngineParameters;
+                tGeometryEngineParameters.mGeometries = tGeometry;
+
+                moris::ge::Geometry_Engine tGeometryEngine( tMesh, tGeometryEngineParameters );
+
+                // Only the cell with the negative node is intersected. The geometry has to be evaluated at the mesh
+                // indices of the cell nodes, the first nodes of the mesh all have positive values.
+                for ( uint tCellIndex = 0; tCellIndex < 2; tCellIndex++ )
+                {
+                    moris::mtk::Cell& tCell = tMesh->get_mtk_cell( tCellIndex );
+
+                    Matrix< IndexMat > tVertexIndices = tCell.get_vertex_inds();
+
+                    bool tHasNegativeNode = false;
+                    for ( uint iVertex = 0; iVertex < tVertexIndices.numel(); iVertex++ )
+                    {
+                        tHasNegativeNode = tHasNegativeNode or tLevelsetValues( tVertexIndices( iVertex ) ) < 0.0;
+                    }
+
+                    CHECK( tGeometryEngine.is_intersected( tVertexIndices, tCell.get_vertex_coords() ) == tHasNegativeNode );
+                }
+
+                // Clean up
+                delete tMesh;
+            }
+        }
+
+        //--------------------------------------------------------------------------------------------------------------
+
     }    // namespace ge
 }    // namespace moris
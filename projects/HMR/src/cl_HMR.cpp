@@ -8,6 +8,7 @@
  *
  */
 
+#include <algorithm>
 #include <memory>
 #include <mutex>
 
@@ -163,6 +164,12 @@ namespace moris::hmr
     void
     HMR::perform()
     {
+        // redistribute coarsest elements if refinement left procs imbalanced
+        if ( mParameters->get_load_balancing() and par_size() > 1 )
+        {
+            this->perform_load_balancing();
+        }
+
         this->finalize();
 
         // write refinement pattern file
@@ -307,6 +314,149 @@ namespace moris::hmr
 
     // -----------------------------------------------------------------------------
 
+    bool
+    HMR::perform_load_balancing( const Cell< real >& aElementCosts )
+    {
+        Background_Mesh_Base* tBackgroundMesh = mDatabase->get_background_mesh();
+
+        // compute balanced proc domains
+        Cell< Matrix< DDLUMat > > tSplits;
+
+        real tImbalance = tBackgroundMesh->compute_load_balanced_splits( aElementCosts, tSplits );
+
+        MORIS_LOG_SPEC( "HMR load imbalance", tImbalance );
+
+        if ( tImbalance <= mParameters->get_load_balancing_tolerance() )
+        {
+            return false;
+        }
+
+        // keep proc domains if they do not move or the work would not be balanced better
+        if ( tBackgroundMesh->is_current_decomposition( tSplits ) )
+        {
+            return false;
+        }
+
+        real tPredictedImbalance = tBackgroundMesh->compute_load_imbalance( aElementCosts, tSplits );
+
+        MORIS_LOG_SPEC( "HMR predicted load imbalance", tPredictedImbalance );
+
+        if ( tPredictedImbalance >= tImbalance )
+        {
+            return false;
+        }
+
+        MORIS_ERROR( mFields.size() == 0,
+                "HMR::perform_load_balancing(), fields are not transferred to the redistributed mesh." );
+
+        uint tActivePattern = tBackgroundMesh->get_activation_pattern();
+
+        // collect refined elements of all patterns on all procs. IDs do not depend on the decomposition
+        Cell< Matrix< DDLUMat > > tRefinedElements( gNumberOfPatterns );
+
+        Cell< Background_Element_Base* > tElements;
+
+        for ( uint tPattern = 0; tPattern < gNumberOfPatterns; ++tPattern )
+        {
+            luint tCount = 0;
+
+            for ( uint l = 0; l < tBackgroundMesh->get_max_level(); ++l )
+            {
+                tBackgroundMesh->collect_elements_on_level_within_proc_domain( l, tElements );
+
+                for ( Background_Element_Base* tElement : tElements )
+                {
+                    tCount += tElement->is_refined( tPattern );
+                }
+            }
+
+            Matrix< DDLUMat > tMyRefinedElements( tCount, 1 );
+
+            tCount = 0;
+
+            for ( uint l = 0; l < tBackgroundMesh->get_max_level(); ++l )
+            {
+                tBackgroundMesh->collect_elements_on_level_within_proc_domain( l, tElements );
+
+                for ( Background_Element_Base* tElement : tElements )
+                {
+                    if ( tElement->is_refined( tPattern ) )
+                    {
+                        tMyRefinedElements( tCount++ ) = tElement->get_hmr_id();
+                    }
+                }
+            }
+
+            all_gather_and_concatenate( tMyRefinedElements, tRefinedElements( tPattern ) );
+
+            std::sort( tRefinedElements( tPattern ).data(), tRefinedElements( tPattern ).data() + tRefinedElements( tPattern ).numel() );
+        }
+
+        uint tMaxLevel = max_all( tBackgroundMesh->get_max_level() );
+
+        // rebuild database on new proc domains, parameters must survive the old database
+        bool tOwnsParameters = mDatabase->get_parameter_owning_flag();
+
+        mDatabase->unset_parameter_owning_flag();
+
+        mMeshes.clear();
+
+        mParameters->set_processor_splits( tSplits );
+
+        mDatabase = std::make_shared< Database >( mParameters );
+
+        if ( tOwnsParameters )
+        {
+            mDatabase->set_parameter_owning_flag();
+        }
+
+        tBackgroundMesh = mDatabase->get_background_mesh();
+
+        // replay refinement level by level
+        for ( uint tPattern = 0; tPattern < gNumberOfPatterns; ++tPattern )
+        {
+            const Matrix< DDLUMat >& tPatternElements = tRefinedElements( tPattern );
+
+            if ( tPatternElements.numel() == 0 )
+            {
+                continue;
+            }
+
+            tBackgroundMesh->set_activation_pattern( tPattern );
+
+            for ( uint l = 0; l < tMaxLevel; ++l )
+            {
+                tBackgroundMesh->collect_elements_on_level_within_proc_domain( l, tElements );
+
+                for ( Background_Element_Base* tElement : tElements )
+                {
+                    if ( std::binary_search( tPatternElements.data(), tPatternElements.data() + tPatternElements.numel(), tElement->get_hmr_id() ) )
+                    {
+                        tElement->put_on_refinement_queue();
+                    }
+                }
+
+                tBackgroundMesh->perform_refinement( tPattern );
+            }
+        }
+
+        mDatabase->update_bspline_meshes();
+        mDatabase->update_lagrange_meshes();
+
+        mDatabase->set_activation_pattern( tActivePattern );
+
+        this->create_input_and_output_meshes();
+
+        mDatabase->calculate_t_matrices_for_input();
+
+        MORIS_LOG_SPEC( "HMR load imbalance after redistribution",
+                tBackgroundMesh->compute_load_imbalance( {} ) );
+
+        return true;
+    }
+
+    // -----------------------------------------------------------------------------
+
     bool
     HMR::get_mesh_name_exists( const std::string& aName ) const
     {
@@ -501,6 +501,22 @@ namespace moris::hmr
 
             // -----------------------------------------------------------------------------
 
+            /**
+             * redistributes the coarsest elements among the procs if the work of the
+             * active elements is imbalanced by more than the load balancing tolerance.
+             * The proc domains are moved along each direction, the database is rebuilt
+             * and the refinement of all patterns is replayed. Must be called before
+             * finalize(). Fields created on the old database are not transferred.
+             *
+             * @param[in] aElementCosts  cost of each active element on proc, one
+             *                           per element if empty
+             *
+             * @return bool   true if the mesh has been redistributed
+             */
+            bool perform_load_balancing( const Cell< real >& aElementCosts = {} );
+
+            // -----------------------------------------------------------------------------
+
             void output_mesh_refinement_data();
 
             // -----------------------------------------------------------------------------
@@ -331,10 +331,14 @@ namespace moris::hmr
         // ask background mesh for number of levels
         luint tNumberOfLevels = mBackgroundMesh->get_max_level();
 
-        for( uint l = 0; l <= tNumberOfLevels; ++l )
+        // sort all elements by level in one pass instead of traversing the tree once per level
+        Cell< Cell< Element* > > tElementsPerLevel;
+        this->collect_elements_per_level( tElementsPerLevel );
+
+        for( uint l = 0; l <= tNumberOfLevels && l < tElementsPerLevel.size(); ++l )
         {
             // refinement of basis on this level if the corresponding element is refined.
-            this->process_level( l );
+            this->process_level( l, tElementsPerLevel( l ) );
         }
 
         this->collect_basis();
@@ -387,10 +391,21 @@ namespace moris::hmr
 
 //------------------------------------------------------------------------------
 
-    void BSpline_Mesh_Base::process_level( uint aLevel )
+    void BSpline_Mesh_Base::process_level(
+            uint                    aLevel,
+            const Cell< Element* >& aElementsOnLevel )
     {
+        // select active and refined elements
         Cell< Element* > tElementsOnThisLevel;
-        this->collect_active_and_refined_elements_from_level( aLevel, tElementsOnThisLevel );
+        tElementsOnThisLevel.reserve( aElementsOnLevel.size() );
+
+        for( Element* tElement : aElementsOnLevel )
+        {
+            if( ! tElement->get_background_element()->is_deactive( mActivationPattern ) )
+            {
+                tElementsOnThisLevel.push_back( tElement );
+            }
+        }
 
         Cell< Basis* > tBasisOnThisLevel;
 
@@ -824,9 +839,16 @@ namespace moris::hmr
 
     void BSpline_Mesh_Base::determine_basis_state( Cell< Basis* > & aBasis )
     {
-        // loop over all basis
-        for( Basis * tBasis : aBasis )
+        luint tNumberOfBasis = aBasis.size();
+
+        // each basis only reads its elements and sets its own flags
+#ifdef MORIS_USE_OPENMP
+#pragma omp parallel for schedule( dynamic, 256 )
+#endif
+        for( luint b = 0; b < tNumberOfBasis; ++b )
         {
+            Basis * tBasis = aBasis( b );
+
             // only process basis that are used by this proc
             if ( tBasis->is_used() )
             {
@@ -329,7 +329,16 @@ namespace moris::hmr
 
         // ----------------------------------------------------------------------------
 
-        void process_level( uint aLevel );
+        /**
+         * determines the state of the basis on a level and refines the B-spline
+         * elements of this level
+         *
+         * @param[ in ]  aLevel             level to be processed
+         * @param[ in ]  aElementsOnLevel   all elements on this level including aura
+         */
+        void process_level(
+                uint                    aLevel,
+                const Cell< Element* >& aElementsOnLevel );
 
         // ----------------------------------------------------------------------------
 
@@ -774,6 +774,35 @@ namespace moris::hmr
                         ( tNumberOfElementsPerDimension( k ) - ( tNumberOfElementsPerDimension( k ) % mProcDims( k ) ) ) / mProcDims( k ) + tRemainder( k );
             }
 
+            // user defined or load balanced proc domains replace the uniform split
+            const Cell< Matrix< DDLUMat > >& tProcessorSplits = mParameters->get_processor_splits();
+
+            if ( tProcessorSplits.size() > 0 )
+            {
+                MORIS_ERROR( tProcessorSplits.size() == N,
+                        "decompose_mesh(): processor splits must be defined for each direction." );
+
+                for ( uint k = 0; k < N; ++k )
+                {
+                    MORIS_ERROR( tProcessorSplits( k ).numel() == mProcDims( k ) + 1,
+                            "decompose_mesh(): processor splits in direction %u do not match processor dimensions.",
+                            k );
+
+                    MORIS_ERROR( tProcessorSplits( k )( mProcDims( k ) ) == tNumberOfElementsPerDimension( k ),
+                            "decompose_mesh(): processor splits in direction %u do not match number of elements.",
+                            k );
+
+                    luint tFirst = tProcessorSplits( k )( mMyProcCoords( k ) );
+                    luint tLast  = tProcessorSplits( k )( mMyProcCoords( k ) + 1 );
+
+                    MORIS_ERROR( tLast > tFirst,
+                            "decompose_mesh(): empty proc domain in direction %u.",
+                            k );
+
+                    tNumberOfElementsPerDimensionOnProc( k ) = tLast - tFirst;
+                }
+            }
+
             // calculate decomposition domain
             // set owned and shared limits
             Matrix< DDLUMat > tDomainIJK( 2, N );
@@ -783,10 +812,17 @@ namespace moris::hmr
 
             for ( uint k = 0; k < N; ++k )
             {
-                // calculates domain start taking into account remainder elements
-                tDomainIJK( 0, k ) =
-                        mPaddingSize + tNumberOfElementsPerDimensionOnProc( k ) * mMyProcCoords( k ) +    //
-                        ( 1 - tRemainder( k ) ) * ( tNumberOfElementsPerDimension( k ) % mProcDims( k ) );
+                if ( tProcessorSplits.size() > 0 )
+                {
+                    tDomainIJK( 0, k ) = mPaddingSize + tProcessorSplits( k )( mMyProcCoords( k ) );
+                }
+                else
+                {
+                    // calculates domain start taking into account remainder elements
+                    tDomainIJK( 0, k ) =
+                            mPaddingSize + tNumberOfElementsPerDimensionOnProc( k ) * mMyProcCoords( k ) +    //
+                            ( 1 - tRemainder( k ) ) * ( tNumberOfElementsPerDimension( k ) % mProcDims( k ) );
+                }
 
                 tDomainIJK( 1, k ) = tDomainIJK( 0, k ) + tNumberOfElementsPerDimensionOnProc( k ) - 1;
 
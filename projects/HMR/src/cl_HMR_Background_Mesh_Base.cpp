@@ -11,6 +11,7 @@
 #include "cl_HMR_Background_Mesh_Base.hpp" //HMR/src
 
 #include <fstream>
+#include <algorithm>
 
 #include "cl_HMR_Background_Facet.hpp"
 #include "HMR_Globals.hpp" //HMR/src
@@ -2284,6 +2285,231 @@ namespace moris::hmr
 
     // -----------------------------------------------------------------------------
 
+    real Background_Mesh_Base::compute_load_imbalance( const Cell< real >& aElementCosts )
+    {
+        luint tNumberOfElements = mActiveElements.size();
+
+        MORIS_ERROR( aElementCosts.size() == 0 || aElementCosts.size() == tNumberOfElements,
+                "Background_Mesh_Base::compute_load_imbalance(), number of costs does not match number of active elements." );
+
+        real tMyWork = 0.0;
+
+        for ( luint e = 0; e < tNumberOfElements; ++e )
+        {
+            tMyWork += aElementCosts.size() == 0 ? 1.0 : aElementCosts( e );
+        }
+
+        real tMeanWork = sum_all( tMyWork ) / par_size();
+
+        return tMeanWork > 0.0 ? max_all( tMyWork ) / tMeanWork : 1.0;
+    }
+
+    // -----------------------------------------------------------------------------
+
+    real Background_Mesh_Base::compute_load_imbalance(
+            const Cell< real >&              aElementCosts,
+            const Cell< Matrix< DDLUMat > >& aSplits )
+    {
+        luint tNumberOfElements = mActiveElements.size();
+
+        MORIS_ERROR( aElementCosts.size() == 0 || aElementCosts.size() == tNumberOfElements,
+                "Background_Mesh_Base::compute_load_imbalance(), number of costs does not match number of active elements." );
+
+        MORIS_ERROR( aSplits.size() == mNumberOfDimensions,
+                "Background_Mesh_Base::compute_load_imbalance(), splits must be defined for each direction." );
+
+        // number of procs of the proc grid
+        luint tNumberOfProcs = 1;
+
+        for ( uint k = 0; k < mNumberOfDimensions; ++k )
+        {
+            tNumberOfProcs *= aSplits( k ).numel() - 1;
+        }
+
+        // global ijk of first element on proc including aura
+        Matrix< DDLUMat > tOffset = this->get_subdomain_offset_of_proc();
+
+        // work of each proc of the proc grid after moving the proc domains
+        Matrix< DDRMat > tProcWork( tNumberOfProcs, 1, 0.0 );
+
+        for ( luint e = 0; e < tNumberOfElements; ++e )
+        {
+            Background_Element_Base* tElement = mActiveElements( e );
+
+            // get coarsest ancestor
+            while ( tElement->get_level() > 0 )
+            {
+                tElement = tElement->get_parent();
+            }
+
+            const luint* tIJK = tElement->get_ijk();
+
+            // position of the proc owning the coarsest ancestor in the proc grid
+            luint tProc   = 0;
+            luint tStride = 1;
+
+            for ( uint k = 0; k < mNumberOfDimensions; ++k )
+            {
+                luint tSlab = tIJK[ k ] + tOffset( k, 0 ) - mPaddingSize;
+
+                const Matrix< DDLUMat >& tSplits = aSplits( k );
+
+                luint tProcCoord = std::upper_bound( tSplits.data(), tSplits.data() + tSplits.numel(), tSlab ) - tSplits.data() - 1;
+
+                tProc += tStride * tProcCoord;
+                tStride *= tSplits.numel() - 1;
+            }
+
+            tProcWork( tProc ) += aElementCosts.size() == 0 ? 1.0 : aElementCosts( e );
+        }
+
+        Matrix< DDRMat > tWork = sum_all_matrix( tProcWork );
+
+        real tMaxWork   = 0.0;
+        real tTotalWork = 0.0;
+
+        for ( luint p = 0; p < tNumberOfProcs; ++p )
+        {
+            tMaxWork = std::max( tMaxWork, tWork( p ) );
+            tTotalWork += tWork( p );
+        }
+
+        return tTotalWork > 0.0 ? tMaxWork * tNumberOfProcs / tTotalWork : 1.0;
+    }
+
+    // -----------------------------------------------------------------------------
+
+    bool Background_Mesh_Base::is_current_decomposition( const Cell< Matrix< DDLUMat > >& aSplits )
+    {
+        const Cell< Matrix< DDLUMat > >& tCurrentSplits = mParameters->get_processor_splits();
+
+        for ( uint k = 0; k < aSplits.size(); ++k )
+        {
+            luint tNumberOfProcs = aSplits( k ).numel() - 1;
+            luint tNumberOfSlabs = aSplits( k )( tNumberOfProcs );
+
+            for ( luint p = 0; p <= tNumberOfProcs; ++p )
+            {
+                // user defined or load balanced splits, uniform split otherwise
+                luint tCurrentSplit = tCurrentSplits.size() > 0
+                                            ? tCurrentSplits( k )( p )
+                                            : p * ( tNumberOfSlabs / tNumberOfProcs ) + std::min( p, tNumberOfSlabs % tNumberOfProcs );
+
+                if ( aSplits( k )( p ) != tCurrentSplit )
+                {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    // -----------------------------------------------------------------------------
+
+    real Background_Mesh_Base::compute_load_balanced_splits(
+            const Cell< real >&        aElementCosts,
+            Cell< Matrix< DDLUMat > >& aSplits )
+    {
+        luint tNumberOfElements = mActiveElements.size();
+
+        MORIS_ERROR( aElementCosts.size() == 0 || aElementCosts.size() == tNumberOfElements,
+                "Background_Mesh_Base::compute_load_balanced_splits(), number of costs does not match number of active elements." );
+
+        Matrix< DDLUMat > tNumberOfCoarsestElements = mParameters->get_number_of_elements_per_dimension();
+
+        // global ijk of first element on proc including aura
+        Matrix< DDLUMat > tOffset = this->get_subdomain_offset_of_proc();
+
+        // work per slab of coarsest elements in each direction
+        Cell< Matrix< DDRMat > > tSlabWork( mNumberOfDimensions );
+
+        for ( uint k = 0; k < mNumberOfDimensions; ++k )
+        {
+            tSlabWork( k ).set_size( tNumberOfCoarsestElements( k ), 1, 0.0 );
+        }
+
+        for ( luint e = 0; e < tNumberOfElements; ++e )
+        {
+            Background_Element_Base* tElement = mActiveElements( e );
+
+            // get coarsest ancestor
+            while ( tElement->get_level() > 0 )
+            {
+                tElement = tElement->get_parent();
+            }
+
+            const luint* tIJK = tElement->get_ijk();
+
+            real tCost = aElementCosts.size() == 0 ? 1.0 : aElementCosts( e );
+
+            for ( uint k = 0; k < mNumberOfDimensions; ++k )
+            {
+                tSlabWork( k )( tIJK[ k ] + tOffset( k, 0 ) - mPaddingSize ) += tCost;
+            }
+        }
+
+        // procs need to see at least their aura in the neighbor domains
+        luint tMinWidth = 2 * mPaddingSize + 1;
+
+        aSplits.resize( mNumberOfDimensions );
+
+        for ( uint k = 0; k < mNumberOfDimensions; ++k )
+        {
+            Matrix< DDRMat > tWork = sum_all_matrix( tSlabWork( k ) );
+
+            luint tNumberOfSlabs = tNumberOfCoarsestElements( k );
+            luint tNumberOfProcs = mProcDims( k );
+
+            aSplits( k ).set_size( tNumberOfProcs + 1, 1, 0 );
+            aSplits( k )( tNumberOfProcs ) = tNumberOfSlabs;
+
+            // keep uniform split if the domain is too small to be moved
+            if ( tNumberOfProcs * tMinWidth > tNumberOfSlabs )
+            {
+                for ( luint p = 1; p < tNumberOfProcs; ++p )
+                {
+                    luint tRemainder = tNumberOfSlabs % tNumberOfProcs;
+
+                    aSplits( k )( p ) = p * ( tNumberOfSlabs / tNumberOfProcs ) + std::min( p, tRemainder );
+                }
+
+                continue;
+            }
+
+            real tTotalWork = 0.0;
+
+            for ( luint i = 0; i < tNumberOfSlabs; ++i )
+            {
+                tTotalWork += tWork( i );
+            }
+
+            // walk along prefix sum and cut where the work of the next proc is reached
+            luint tSlab       = 0;
+            real  tPrefixWork = 0.0;
+
+            for ( luint p = 1; p < tNumberOfProcs; ++p )
+            {
+                real tTargetWork = p * tTotalWork / tNumberOfProcs;
+
+                while ( tSlab < tNumberOfSlabs && tPrefixWork + 0.5 * tWork( tSlab ) < tTargetWork )
+                {
+                    tPrefixWork += tWork( tSlab++ );
+                }
+
+                // each proc needs tMinWidth slabs
+                luint tLower = aSplits( k )( p - 1 ) + tMinWidth;
+                luint tUpper = tNumberOfSlabs - ( tNumberOfProcs - p ) * tMinWidth;
+
+                aSplits( k )( p ) = std::min( std::max( tSlab, tLower ), tUpper );
+            }
+        }
+
+        return this->compute_load_imbalance( aElementCosts );
+    }
+
+    // -----------------------------------------------------------------------------
+
     /**
      * Collect background elements on side set.
      * Side set numbers see Exodus II : A Finite Element Data Model, p. 13
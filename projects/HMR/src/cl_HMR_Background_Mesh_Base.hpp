@@ -957,6 +957,62 @@ namespace moris::hmr
          */
         void update_database();
 
+        // -----------------------------------------------------------------------------
+
+        /**
+         * computes proc domains that balance the work of the active elements.
+         * The work of each active element on the proc is added to its coarsest
+         * ancestor and summed along each direction. The proc grid is kept and
+         * the offsets of the proc domains are moved along each direction such
+         * that every slab of procs gets the same share of work.
+         *
+         * @param[in]  aElementCosts  cost of each active element on proc,
+         *                            one per element if empty
+         * @param[out] aSplits        offsets of the proc domains, see
+         *                            Parameters::set_processor_splits()
+         *
+         * @return real   current imbalance, i.e. max over mean work of procs
+         */
+        real compute_load_balanced_splits(
+                const Cell< real >&        aElementCosts,
+                Cell< Matrix< DDLUMat > >& aSplits );
+
+        // -----------------------------------------------------------------------------
+
+        /**
+         * returns the max over mean work of the active elements on procs
+         *
+         * @param[in]  aElementCosts  cost of each active element on proc,
+         *                            one per element if empty
+         */
+        real compute_load_imbalance( const Cell< real >& aElementCosts );
+
+        // -----------------------------------------------------------------------------
+
+        /**
+         * predicts the max over mean work of the active elements on procs
+         * if the proc domains were moved to the given splits
+         *
+         * @param[in]  aElementCosts  cost of each active element on proc,
+         *                            one per element if empty
+         * @param[in]  aSplits        offsets of the proc domains, see
+         *                            compute_load_balanced_splits()
+         */
+        real compute_load_imbalance(
+                const Cell< real >&              aElementCosts,
+                const Cell< Matrix< DDLUMat > >& aSplits );
+
+        // -----------------------------------------------------------------------------
+
+        /**
+         * checks whether the given splits describe the current proc domains,
+         * i.e. the user defined splits or the uniform split if none are set
+         *
+         * @param[in]  aSplits        offsets of the proc domains, see
+         *                            compute_load_balanced_splits()
+         */
+        bool is_current_decomposition( const Cell< Matrix< DDLUMat > >& aSplits );
+
         //------------------------------------------------------------------------------
 
         /**
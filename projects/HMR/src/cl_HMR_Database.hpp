@@ -134,6 +134,17 @@ namespace moris::hmr
 
             // -----------------------------------------------------------------------------
 
+            /**
+             * tells if the parameter object is deleted by the destructor
+             */
+            bool
+            get_parameter_owning_flag() const
+            {
+                return mDeleteParametersOnDestruction;
+            }
+
+            // -----------------------------------------------------------------------------
+
             /**
              * creates a union of two patterns
              */
@@ -162,23 +162,56 @@ namespace moris::hmr
         // get max level of mest
         uint tMaxLevel = mBackgroundMesh->get_max_level();
 
+        // sort all elements by level in one pass instead of traversing the tree once per level
+        Cell< Cell< Element* > > tElementsPerLevel;
+        this->collect_elements_per_level( tElementsPerLevel );
+
+        // number of colors, i.e. combinations of even and odd ijk positions
+        uint tNumberOfColors = 1 << mNumberOfDimensions;
+
         // loop over all levels
-        for ( uint l=0; l<tMaxLevel; ++l )
+        for ( uint l=0; l<tMaxLevel && l<tElementsPerLevel.size(); ++l )
         {
-            // get all elements from this level
-            Cell< Background_Element_Base* > tElements;
+            // refined elements on this level, sorted by color
+            Cell< Cell< Element* > > tElementsPerColor( tNumberOfColors );
 
-            mBackgroundMesh->collect_elements_on_level_including_aura( l, tElements );
-
-            // loop over all elements on this level
-            for( auto tElement : tElements )
+            for( Element* tElement : tElementsPerLevel( l ) )
             {
+                Background_Element_Base* tBackElement = tElement->get_background_element();
+
                 // test if this element has children and is not padding and is refined
-                if ( tElement->has_children() and ! tElement->is_padding() && tElement->is_refined( mActivationPattern ) )
+                if ( tBackElement->has_children() and ! tBackElement->is_padding() && tBackElement->is_refined( mActivationPattern ) )
+                {
+                    const luint* tIJK = tBackElement->get_ijk();
+
+                    uint tColor = 0;
+
+                    for( uint k=0; k<mNumberOfDimensions; ++k )
+                    {
+                        tColor += ( tIJK[ k ] % 2 ) << k;
+                    }
+
+                    tElementsPerColor( tColor ).push_back( tElement );
+                }
+            }
+
+            // elements of the same color are no neighbors, so each of them only reads
+            // nodes of neighbors processed in an earlier color and writes its own children
+            for( Cell< Element* >& tElements : tElementsPerColor )
+            {
+                luint tNumberOfElements = tElements.size();
+                luint tNumberOfNewNodes = 0;
+
+#ifdef MORIS_USE_OPENMP
+#pragma omp parallel for reduction( + : tNumberOfNewNodes ) schedule( dynamic, 64 )
+#endif
+                for( luint e = 0; e < tNumberOfElements; ++e )
                 {
                     // calculate nodes of children
-                    mNumberOfAllBasis += mAllElementsOnProc( tElement->get_memory_index() )->create_basis_for_children( mAllElementsOnProc );
+                    tNumberOfNewNodes += tElements( e )->create_basis_for_children( mAllElementsOnProc );
                 }
+
+                mNumberOfAllBasis += tNumberOfNewNodes;
             }
         }
     }
@@ -92,6 +92,41 @@ namespace moris::hmr
 
     // -----------------------------------------------------------------------------
 
+    void Mesh_Base::collect_elements_per_level( Cell< Cell< Element* > >& aElementsPerLevel )
+    {
+        // count elements per level
+        Cell< luint > tNumberOfElementsPerLevel( mBackgroundMesh->get_max_level() + 1, 0 );
+
+        for ( Element* tElement : mAllElementsOnProc )
+        {
+            uint tLevel = tElement->get_level();
+
+            if ( tLevel >= tNumberOfElementsPerLevel.size() )
+            {
+                tNumberOfElementsPerLevel.resize( tLevel + 1, 0 );
+            }
+
+            tNumberOfElementsPerLevel( tLevel )++;
+        }
+
+        // assign memory
+        aElementsPerLevel.clear();
+        aElementsPerLevel.resize( tNumberOfElementsPerLevel.size() );
+
+        for ( uint l = 0; l < tNumberOfElementsPerLevel.size(); ++l )
+        {
+            aElementsPerLevel( l ).reserve( tNumberOfElementsPerLevel( l ) );
+        }
+
+        // elements are stored depth first, which keeps the order within each level
+        for ( Element* tElement : mAllElementsOnProc )
+        {
+            aElementsPerLevel( tElement->get_level() ).push_back( tElement );
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+
     /**
      * collects all coarsest elements on proc including aura
      * Memory index of background elements and all B-spline elements is the same.
@@ -440,6 +440,17 @@ namespace moris::hmr
 
         // ----------------------------------------------------------------------------
 
+        /**
+         * sorts all elements on proc including aura by level in a single pass.
+         * Within each level, the elements have the same order as in
+         * Background_Mesh_Base::collect_elements_on_level_including_aura().
+         *
+         * @param[out] aElementsPerLevel   one cell of elements per level
+         */
+        void collect_elements_per_level( Cell< Cell< Element* > >& aElementsPerLevel );
+
+        // ----------------------------------------------------------------------------
+
         /**
          * Determines which nodes are connected to which element.
          * Writes value in mesh data struct
@@ -268,6 +268,10 @@ namespace moris::hmr
 
         this->set_restart_refinement_pattern_file( aParameterList.get< std::string >( "restart_refinement_pattern_file" ) );
 
+        this->set_load_balancing( aParameterList.get< bool >( "load_balancing" ) );
+
+        this->set_load_balancing_tolerance( aParameterList.get< real >( "load_balancing_tolerance" ) );
+
         this->set_basis_fuction_vtk_file_name( aParameterList.get< std::string >( "basis_function_vtk_file" ) );
 
         // get user-defined refinement functions
@@ -176,6 +176,16 @@ namespace moris::hmr
 
         std::string mRestartfromRefinedPattern = "";
 
+        //! flag telling if the coarsest elements are redistributed after refinement
+        bool mLoadBalancing = false;
+
+        //! max/mean ratio of the proc work above which the mesh is redistributed
+        real mLoadBalancingTolerance = 1.2;
+
+        //! offsets of the proc domains in coarsest elements per direction.
+        //! Uniform decomposition if empty
+        Cell< Matrix< DDLUMat > > mProcessorSplits;
+
         //! maximum level for refinement. Default value is specified
         //! by global constant
         uint mMaxRefinementLevel = gMaxNumberOfLevels - 1;
@@ -1291,6 +1301,63 @@ namespace moris::hmr
 
         //-------------------------------------------------------------------------------
 
+        void
+        set_load_balancing( bool aLoadBalancing )
+        {
+            mLoadBalancing = aLoadBalancing;
+        }
+
+        //-------------------------------------------------------------------------------
+
+        bool
+        get_load_balancing() const
+        {
+            return mLoadBalancing;
+        }
+
+        //-------------------------------------------------------------------------------
+
+        void
+        set_load_balancing_tolerance( real aTolerance )
+        {
+            mLoadBalancingTolerance = aTolerance;
+        }
+
+        //-------------------------------------------------------------------------------
+
+        real
+        get_load_balancing_tolerance() const
+        {
+            return mLoadBalancingTolerance;
+        }
+
+        //-------------------------------------------------------------------------------
+
+        /**
+         * sets the offsets of the proc domains along each direction. Entry p of
+         * direction k is the first coarsest element owned by procs with proc
+         * coordinate p, the last entry is the number of elements. Unlike the
+         * other decomposition settings this is not locked, since it is changed
+         * when the database is rebuilt for load balancing.
+         *
+         * @param[in] aProcessorSplits   one vector of length proc dims + 1 per direction
+         */
+        void
+        set_processor_splits( const Cell< Matrix< DDLUMat > >& aProcessorSplits )
+        {
+            mProcessorSplits = aProcessorSplits;
+        }
+
+        //-------------------------------------------------------------------------------
+
+        const Cell< Matrix< DDLUMat > >&
+        get_processor_splits() const
+        {
+            return mProcessorSplits;
+        }
+
+        //-------------------------------------------------------------------------------
+
         uint
         get_max_refinement_level() const
         {
@@ -84,76 +84,38 @@ namespace moris::hmr
             uint tCoarseOrder = this->mLagrangeMeshCoarse->get_order();
 
             // number of nodes per element
-            uint tNumberOfNodesPerElement = this->mLagrangeMesh->get_number_of_basis_per_element();
             uint tNumberOfCoarseNodesPerElement = this->mLagrangeMeshCoarse->get_number_of_basis_per_element();
 
-            // unity matrix
-            Matrix< DDRMat > tEye;
-            eye( tNumberOfNodesPerElement, tNumberOfNodesPerElement, tEye );
+            // refined Lagrange T-matrices and T-matrices of the B-spline elements
+            Cell< const Matrix< DDRMat >* > tLagrangeMatrices;
+            Cell< uint >                    tBSplineElementIndices;
+            Cell< Matrix< DDRMat > >        tBSplineTMatrices;
+            Cell< Cell< Basis* > >          tBSplineDOFs;
 
-            // calculate transposed Lagrange T-Matrix
-            Matrix< DDRMat > tL( this->get_lagrange_matrix() );
+            this->calculate_bspline_t_matrices(
+                    tBSplinePattern,
+                    tLagrangeMatrices,
+                    tBSplineElementIndices,
+                    tBSplineTMatrices,
+                    tBSplineDOFs );
+
+            // get change order matrix
+            const Matrix< DDRMat > & tC = this->get_change_order_matrix( tCoarseOrder );
 
             // loop over all elements
             for( luint e = 0; e < tNumberOfElements; ++e )
             {
                 // get pointer to element
-                auto tLagrangeElement       = this->mLagrangeMesh->get_element( e );
                 auto tLagrangeElementCoarse = this->mLagrangeMeshCoarse->get_element( e );
 
                 // FIXME : activate this flag
                 //if ( tLagrangeElement->get_t_matrix_flag() )
                 {
-                    // get pointer to background element
-                    auto tBackgroundElement = tLagrangeElement->get_background_element();
-
-                    // initialize refinement Matrix
-                    Matrix< DDRMat > tR;
-
-                    bool tLagrangeEqualBspline = false;
-                    bool tFirstLagrangeRefinement = true;
-
-                    while( ! tBackgroundElement->is_active( tBSplinePattern ) )
-                    {
-                        if( tFirstLagrangeRefinement )
-                        {
-                            // right multiply refinement matrix
-                            tR = this->get_refinement_matrix( tBackgroundElement->get_child_index() );
-                            tFirstLagrangeRefinement = false;
-                            tLagrangeEqualBspline = true;
-                        }
-                        else
-                        {
-                            tR = tR* this->get_refinement_matrix( tBackgroundElement->get_child_index() );
-                        }
-
-                        // jump to parent
-                        tBackgroundElement = tBackgroundElement->get_parent();
-                    }
-
-                    // calculate the B-Spline T-Matrix
-                    Matrix< DDRMat > tB;
-                    Cell< Basis* > tDOFs;
-
-                    this->calculate_t_matrix(
-                            tBackgroundElement->get_memory_index(),
-                            tB,
-                            tDOFs );
+                    // DOFs of the B-spline element
+                    const Cell< Basis* > & tDOFs = tBSplineDOFs( tBSplineElementIndices( e ) );
 
-                    // get change order matrix
-                    const Matrix< DDRMat > & tC = this->get_change_order_matrix( tCoarseOrder );
-
-                    Matrix< DDRMat > tT;
-
-                    if(tLagrangeEqualBspline)
-                    {
-                        // transposed T-Matrix
-                        tT = tC * tR * tL * tB;
-                    }
-                    else
-                    {
-                        tT = tC * tL * tB;
-                    }
+                    // transposed T-Matrix
+                    Matrix< DDRMat > tT = tC * ( *tLagrangeMatrices( e ) ) * tBSplineTMatrices( tBSplineElementIndices( e ) );
 
                     // number of columns in T-Matrix
                     uint tNCols = tT.n_cols();
@@ -59,6 +59,112 @@ namespace moris::hmr
 
     //-------------------------------------------------------------------------------
 
+    const Matrix< DDRMat >& T_Matrix_Base::get_refined_lagrange_matrix(
+            Background_Element_Base*& aBackgroundElement,
+            uint                      aBSplinePattern )
+    {
+        // key: leading one followed by three bits per child index along the path
+        luint tKey = 1;
+
+        Background_Element_Base* tBSplineElement = aBackgroundElement;
+
+        while ( !tBSplineElement->is_active( aBSplinePattern ) )
+        {
+            tKey = ( tKey << 3 ) | tBSplineElement->get_child_index();
+
+            // jump to parent
+            tBSplineElement = tBSplineElement->get_parent();
+        }
+
+        auto tIterator = mRefinedLagrangeMatrices.find( tKey );
+
+        if ( tIterator == mRefinedLagrangeMatrices.end() )
+        {
+            // collect child indices along the path
+            Cell< uint > tChildIndices;
+
+            for ( Background_Element_Base* tElement = aBackgroundElement; tElement != tBSplineElement; tElement = tElement->get_parent() )
+            {
+                tChildIndices.push_back( tElement->get_child_index() );
+            }
+
+            // left multiply refinement matrices, starting with the coarsest one
+            Matrix< DDRMat > tRL( this->get_lagrange_matrix() );
+
+            for ( uint iLevel = tChildIndices.size(); iLevel > 0; iLevel-- )
+            {
+                tRL = this->get_refinement_matrix( tChildIndices( iLevel - 1 ) ) * tRL;
+            }
+
+            tIterator = mRefinedLagrangeMatrices.emplace( tKey, std::move( tRL ) ).first;
+        }
+
+        aBackgroundElement = tBSplineElement;
+
+        return tIterator->second;
+    }
+
+    //-------------------------------------------------------------------------------
+
+    void T_Matrix_Base::calculate_bspline_t_matrices(
+            uint                             aBSplinePattern,
+            Cell< const Matrix< DDRMat >* >& aLagrangeMatrices,
+            Cell< uint >&                    aBSplineElementIndices,
+            Cell< Matrix< DDRMat > >&        aTMatrices,
+            Cell< Cell< Basis* > >&          aDOFs )
+    {
+        // get number of elements on this Lagrange mesh
+        luint tNumberOfElements = mLagrangeMesh->get_number_of_elements();
+
+        aLagrangeMatrices.resize( tNumberOfElements, nullptr );
+        aBSplineElementIndices.resize( tNumberOfElements, 0 );
+
+        // position of each B-spline element in the output
+        std::unordered_map< luint, uint > tBSplineElementMap;
+
+        // memory indices of the B-spline elements
+        Cell< luint > tMemoryIndices;
+
+        for ( luint iElementIndex = 0; iElementIndex < tNumberOfElements; iElementIndex++ )
+        {
+            // get pointer to background element
+            Background_Element_Base* tBackgroundElement = mLagrangeMesh->get_element( iElementIndex )->get_background_element();
+
+            // refined Lagrange T-matrix, moves background element to the active B-spline element
+            aLagrangeMatrices( iElementIndex ) = &this->get_refined_lagrange_matrix( tBackgroundElement, aBSplinePattern );
+
+            luint tMemoryIndex = tBackgroundElement->get_memory_index();
+
+            auto tInsert = tBSplineElementMap.emplace( tMemoryIndex, tMemoryIndices.size() );
+
+            if ( tInsert.second )
+            {
+                tMemoryIndices.push_back( tMemoryIndex );
+            }
+
+            aBSplineElementIndices( iElementIndex ) = tInsert.first->second;
+        }
+
+        luint tNumberOfBSplineElements = tMemoryIndices.size();
+
+        aTMatrices.resize( tNumberOfBSplineElements );
+        aDOFs.resize( tNumberOfBSplineElements );
+
+        // B-spline T-matrices only read the mesh, so they can be computed concurrently
+#ifdef MORIS_USE_OPENMP
+#pragma omp parallel for schedule( dynamic, 64 )
+#endif
+        for ( luint iBSplineElement = 0; iBSplineElement < tNumberOfBSplineElements; iBSplineElement++ )
+        {
+            this->calculate_t_matrix(
+                    tMemoryIndices( iBSplineElement ),
+                    aTMatrices( iBSplineElement ),
+                    aDOFs( iBSplineElement ) );
+        }
+    }
+
+    //-------------------------------------------------------------------------------
+
     void T_Matrix_Base::calculate_untruncated_t_matrix(
             luint      aMemoryIndex,
             Matrix< DDRMat >& aTMatrixTransposed,
@@ -353,12 +459,18 @@ namespace moris::hmr
         // number of nodes per element
         uint tNumberOfNodesPerElement = mLagrangeMesh->get_number_of_basis_per_element();
 
-        // unity matrix
-        Matrix< DDRMat > tEye;
-        eye( tNumberOfNodesPerElement, tNumberOfNodesPerElement, tEye );
+        // refined Lagrange T-matrices and T-matrices of the B-spline elements
+        Cell< const Matrix< DDRMat >* > tLagrangeMatrices;
+        Cell< uint >                    tBSplineElementIndices;
+        Cell< Matrix< DDRMat > >        tBSplineTMatrices;
+        Cell< Cell< Basis* > >          tBSplineDOFs;
 
-        // calculate transposed Lagrange T-Matrix
-        Matrix< DDRMat > tL( this->get_lagrange_matrix() );
+        this->calculate_bspline_t_matrices(
+                tBSplinePattern,
+                tLagrangeMatrices,
+                tBSplineElementIndices,
+                tBSplineTMatrices,
+                tBSplineDOFs );
 
         // loop over all elements
         for ( luint iElementIndex = 0; iElementIndex < tNumberOfElements; iElementIndex++ )
@@ -369,53 +481,11 @@ namespace moris::hmr
             // FIXME : activate this flag
             // if ( tLagrangeElement->get_t_matrix_flag() )
             {
-                // get pointer to background element
-                auto tBackgroundElement = tLagrangeElement->get_background_element();
+                // DOFs of the B-spline element
+                const Cell< Basis* >& tDOFs = tBSplineDOFs( tBSplineElementIndices( iElementIndex ) );
 
-                // initialize refinement Matrix
-                Matrix< DDRMat > tR;
-
-                bool tLagrangeEqualBspline    = false;
-                bool tFirstLagrangeRefinement = true;
-
-                while ( !tBackgroundElement->is_active( tBSplinePattern ) )
-                {
-                    if ( tFirstLagrangeRefinement )
-                    {
-                        // right multiply refinement matrix
-                        tR                       = this->get_refinement_matrix( tBackgroundElement->get_child_index() );
-                        tFirstLagrangeRefinement = false;
-                        tLagrangeEqualBspline    = true;
-                    }
-                    else
-                    {
-                        tR = tR * this->get_refinement_matrix( tBackgroundElement->get_child_index() );
-                    }
-
-                    // jump to parent
-                    tBackgroundElement = tBackgroundElement->get_parent();
-                }
-
-                // calculate the B-Spline T-Matrix
-                Matrix< DDRMat > tB;
-                Cell< Basis* >   tDOFs;
-
-                this->calculate_t_matrix(
-                        tBackgroundElement->get_memory_index(),
-                        tB,
-                        tDOFs );
-
-                Matrix< DDRMat > tT;
-
-                if ( tLagrangeEqualBspline )
-                {
-                    // transposed T-Matrix
-                    tT = tR * tL * tB;
-                }
-                else
-                {
-                    tT = tL * tB;
-                }
+                // transposed T-Matrix
+                Matrix< DDRMat > tT = ( *tLagrangeMatrices( iElementIndex ) ) * tBSplineTMatrices( tBSplineElementIndices( iElementIndex ) );
 
                 // number of columns in T-Matrix
                 uint tNCols = tT.n_cols();
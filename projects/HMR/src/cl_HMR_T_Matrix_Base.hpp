@@ -11,6 +11,8 @@
 #ifndef SRC_HMR_CL_HMR_T_MATRIX_BASE_HPP_
 #define SRC_HMR_CL_HMR_T_MATRIX_BASE_HPP_
 
+#include <unordered_map>
+
 #include "cl_HMR_BSpline_Mesh_Base.hpp" //HMR/src
 #include "cl_HMR_Lagrange_Mesh_Base.hpp" //HMR/src
 #include "cl_HMR_Parameters.hpp" //HMR/src
@@ -81,6 +83,9 @@ namespace moris::hmr
         //! matrices for changing the order of a Lagrange mesh
         Cell< Matrix< DDRMat > > mLagrangeChangeOrderMatrix;
 
+        //! refinement matrices multiplied with the Lagrange T-matrix, keyed by the child index path
+        std::unordered_map< luint, Matrix< DDRMat > > mRefinedLagrangeMatrices;
+
         //! pointer to T-Matrix calculation function
         //! points to either calculate_untruncated_t_matrix
         //! or calculate_truncated_t_matrix
@@ -128,6 +133,50 @@ namespace moris::hmr
 
         //-------------------------------------------------------------------------------
 
+        /**
+         * Walks from a Lagrange background element up to the active element of the B-spline pattern
+         * and returns the product of the refinement matrices along this path with the Lagrange T-matrix.
+         * The product only depends on the child indices along the path and is computed once per path.
+         *
+         * @param[in,out] aBackgroundElement Lagrange background element, on return the active B-spline element
+         * @param[in]     aBSplinePattern    activation pattern of the B-spline mesh
+         */
+        const Matrix< DDRMat >& get_refined_lagrange_matrix(
+                Background_Element_Base*& aBackgroundElement,
+                uint                      aBSplinePattern );
+
+        //-------------------------------------------------------------------------------
+
+        /**
+         * returns the number of refinement paths for which the refined Lagrange T-matrix is stored
+         */
+        luint
+        get_number_of_refinement_configurations() const
+        {
+            return mRefinedLagrangeMatrices.size();
+        }
+
+        //-------------------------------------------------------------------------------
+
+        /**
+         * Computes the B-spline T-matrices needed by the elements of the Lagrange mesh. Each B-spline
+         * element is evaluated once, in parallel if OpenMP is used.
+         *
+         * @param[in]  aBSplinePattern        activation pattern of the B-spline mesh
+         * @param[out] aLagrangeMatrices      refined Lagrange T-matrix of each Lagrange element
+         * @param[out] aBSplineElementIndices position of the B-spline T-matrix of each Lagrange element
+         * @param[out] aTMatrices             transposed T-matrices of the B-spline elements
+         * @param[out] aDOFs                  DOFs of the B-spline elements
+         */
+        void calculate_bspline_t_matrices(
+                uint                             aBSplinePattern,
+                Cell< const Matrix< DDRMat >* >& aLagrangeMatrices,
+                Cell< uint >&                    aBSplineElementIndices,
+                Cell< Matrix< DDRMat > >&        aTMatrices,
+                Cell< Cell< Basis* > >&          aDOFs );
+
+        //-------------------------------------------------------------------------------
+
         void calculate_t_matrix(
                 luint             aMemoryIndex,
                 Matrix< DDRMat >& aTMatrixTransposed,
@@ -882,6 +882,139 @@ TEST_CASE("HMR_Background_Mesh_refine", "[moris],[mesh],[hmr],[Background_Mesh_r
     }
 }
 
+TEST_CASE("HMR_Background_Mesh_Load_Balancing", "[moris],[mesh],[hmr],[Background_Mesh_Load_Balancing],[Background_Mesh]")
+{
+    if( moris::par_size() == 1 || moris::par_size() == 2 )
+    {
+        // create parameter object
+        moris::hmr::Parameters tParameters;
+
+        tParameters.set_processor_decomp_method(1);
+
+        tParameters.set_number_of_elements_per_dimension( { { 12 }, { 12 } } );
+        tParameters.set_severity_level( 0 );
+        tParameters.set_bspline_truncation( true );
+
+        tParameters.set_lagrange_orders  ( { {1} });
+        tParameters.set_lagrange_patterns({ {0} });
+
+        tParameters.set_bspline_orders   ( { {1} } );
+        tParameters.set_bspline_patterns ( { {0} } );
+
+        moris::Cell< moris::Matrix< moris::DDSMat > > tLagrangeToBSplineMesh( 1 );
+        tLagrangeToBSplineMesh( 0 ) = { {0} };
+
+        tParameters.set_lagrange_to_bspline_mesh( tLagrangeToBSplineMesh );
+
+        tParameters.set_load_balancing_tolerance( 1.05 );
+
+        // create HMR object
+        moris::hmr::HMR tHMR( tParameters );
+
+        // refine all elements of first proc twice
+        for( moris::uint Ii = 0; Ii < 2; Ii++ )
+        {
+            if( moris::par_rank() == 0 )
+            {
+                moris::luint tNumActiveElements = tHMR.get_database()->get_background_mesh()->get_number_of_active_elements_on_proc();
+
+                for( moris::luint Ik = 0; Ik < tNumActiveElements; Ik++ )
+                {
+                    tHMR.flag_element( Ik );
+                }
+            }
+
+            tHMR.perform_refinement( 0 );
+            tHMR.update_refinement_pattern( 0 );
+        }
+
+        moris::hmr::Background_Mesh_Base* tBackgroundMesh = tHMR.get_database()->get_background_mesh();
+
+        moris::luint tNumberOfElements = moris::sum_all( tBackgroundMesh->get_number_of_active_elements_on_proc() );
+
+        moris::real tImbalance = tBackgroundMesh->compute_load_imbalance( {} );
+
+        bool tRedistributed = tHMR.perform_load_balancing();
+
+        tBackgroundMesh = tHMR.get_database()->get_background_mesh();
+
+        // refinement is kept
+        REQUIRE( moris::sum_all( tBackgroundMesh->get_number_of_active_elements_on_proc() ) == tNumberOfElements );
+
+        if( moris::par_size() == 1 )
+        {
+            // nothing to balance on one proc
+            REQUIRE( tImbalance == Approx( 1.0 ) );
+            REQUIRE( !tRedistributed );
+        }
+        else
+        {
+            REQUIRE( tRedistributed );
+            REQUIRE( tBackgroundMesh->compute_load_imbalance( {} ) < tImbalance );
+        }
+
+        // balanced splits only depend on the refinement, a second call keeps the proc domains
+        REQUIRE( !tHMR.perform_load_balancing() );
+        REQUIRE( tHMR.get_database()->get_background_mesh() == tBackgroundMesh );
+
+        tHMR.finalize();
+    }
+}
+
+TEST_CASE("HMR_Background_Mesh_Load_Balancing_Unchanged", "[moris],[mesh],[hmr],[Background_Mesh_Load_Balancing],[Background_Mesh]")
+{
+    if( moris::par_size() == 2 )
+    {
+        // create parameter object
+        moris::hmr::Parameters tParameters;
+
+        tParameters.set_processor_decomp_method(1);
+
+        tParameters.set_number_of_elements_per_dimension( { { 12 }, { 12 } } );
+        tParameters.set_severity_level( 0 );
+        tParameters.set_bspline_truncation( true );
+
+        tParameters.set_lagrange_orders  ( { {1} });
+        tParameters.set_lagrange_patterns({ {0} });
+
+        tParameters.set_bspline_orders   ( { {1} } );
+        tParameters.set_bspline_patterns ( { {0} } );
+
+        moris::Cell< moris::Matrix< moris::DDSMat > > tLagrangeToBSplineMesh( 1 );
+        tLagrangeToBSplineMesh( 0 ) = { {0} };
+
+        tParameters.set_lagrange_to_bspline_mesh( tLagrangeToBSplineMesh );
+
+        // tolerance below any imbalance, only the split decides
+        tParameters.set_load_balancing_tolerance( 0.5 );
+
+        // create HMR object
+        moris::hmr::HMR tHMR( tParameters );
+
+        // refine all elements on both procs, the work stays evenly distributed
+        moris::luint tNumActiveElements = tHMR.get_database()->get_background_mesh()->get_number_of_active_elements_on_proc();
+
+        for( moris::luint Ik = 0; Ik < tNumActiveElements; Ik++ )
+        {
+            tHMR.flag_element( Ik );
+        }
+
+        tHMR.perform_refinement( 0 );
+        tHMR.update_refinement_pattern( 0 );
+
+        moris::hmr::Background_Mesh_Base* tBackgroundMesh = tHMR.get_database()->get_background_mesh();
+
+        REQUIRE( tBackgroundMesh->compute_load_imbalance( {} ) == Approx( 1.0 ) );
+
+        // balanced splits equal the uniform split, the database is not rebuilt
+        REQUIRE( !tHMR.perform_load_balancing() );
+        REQUIRE( tHMR.get_database()->get_background_mesh() == tBackgroundMesh );
+        REQUIRE( tParameters.get_processor_splits().size() == 0 );
+
+        tHMR.finalize();
+    }
+}
+
 TEST_CASE("HMR_Background_Mesh_refinement_buffer", "[moris],[mesh],[hmr],[Background_Mesh_refinement_buffer],[Background_Mesh]")
 {
     if( moris::par_size() == 2 )
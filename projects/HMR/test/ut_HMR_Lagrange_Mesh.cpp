@@ -31,9 +31,35 @@
 
 #include "fn_PRM_HMR_Parameters.hpp"
 
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
+#ifdef MORIS_USE_OPENMP
+#include <omp.h>
+#endif
+
 using namespace moris;
 using namespace hmr;
 
+// level, HMR ID, ID and owner of all basis of a mesh on this proc, sorted by level and HMR ID
+static std::vector< std::tuple< uint, luint, moris_id, moris_id > >
+collect_basis_signature( Mesh_Base* aMesh )
+{
+    std::vector< std::tuple< uint, luint, moris_id, moris_id > > tSignature;
+
+    for( luint Ik = 0; Ik < aMesh->get_number_of_all_basis_on_proc(); Ik++ )
+    {
+        Basis* tBasis = aMesh->get_basis_by_memory_index( Ik );
+
+        tSignature.emplace_back( tBasis->get_level(), tBasis->get_hmr_id(), tBasis->get_id(), tBasis->get_owner() );
+    }
+
+    std::sort( tSignature.begin(), tSignature.end() );
+
+    return tSignature;
+}
+
 TEST_CASE("HMR_Lagrange_Mesh", "[moris],[mesh],[hmr],[hmr_lagrange_mesh],[lagrange_mesh]")
 {
     //-------------------------------------------------------------------------------
@@ -1595,3 +1621,89 @@ TEST_CASE("Lagrange_Mesh_BSpline_Element_and_side_ordinal","[moris],[hmr],[Eleme
     }
 }
 
+TEST_CASE("Lagrange_Mesh_Threaded_Node_Creation","[moris],[hmr],[Lagrange_Mesh_Threaded_Node_Creation],[lagrange_mesh]")
+{
+    if( par_size() == 1 or par_size() == 2 )
+    {
+        for( uint tDimension = 2; tDimension <= 3; tDimension++ )
+        {
+            // Lagrange and B-spline basis of a serial and a threaded run
+            Cell< std::vector< std::tuple< uint, luint, moris_id, moris_id > > > tLagrangeSignatures( 2 );
+            Cell< std::vector< std::tuple< uint, luint, moris_id, moris_id > > > tBSplineSignatures( 2 );
+
+            for( uint tRun = 0; tRun < 2; tRun++ )
+            {
+#ifdef MORIS_USE_OPENMP
+                // first run is serial, second run uses several threads
+                int tNumThreads = omp_get_max_threads();
+                omp_set_num_threads( tRun == 0 ? 1 : 4 );
+#endif
+
+                // create settings object
+                moris::hmr::Parameters tParameters;
+
+                if( tDimension == 2 )
+                {
+                    tParameters.set_number_of_elements_per_dimension( { {6}, {6} } );
+                    tParameters.set_domain_dimensions( 3, 3 );
+                    tParameters.set_domain_offset( 0.0, 0.0 );
+                }
+                else
+                {
+                    tParameters.set_number_of_elements_per_dimension( { {4}, {4}, {4} } );
+                    tParameters.set_domain_dimensions( 2, 2, 2 );
+                    tParameters.set_domain_offset( 0.0, 0.0, 0.0 );
+                }
+
+                tParameters.set_bspline_truncation( true );
+
+                tParameters.set_lagrange_orders  ( { {2} });
+                tParameters.set_lagrange_patterns( { {0} });
+
+                tParameters.set_bspline_orders   ( { {2} } );
+                tParameters.set_bspline_patterns ( { {0} } );
+
+                tParameters.set_staircase_buffer( 1 );
+
+                Cell< Matrix< DDSMat > > tLagrangeToBSplineMesh( 1 );
+                tLagrangeToBSplineMesh( 0 ) = { {0} };
+
+                tParameters.set_lagrange_to_bspline_mesh( tLagrangeToBSplineMesh );
+
+                // create the HMR object by passing the settings to the constructor
+                moris::hmr::HMR tHMR( tParameters );
+
+                // refine every second active element twice to get hanging nodes on several levels
+                for( uint Ii = 0; Ii < 2; Ii++ )
+                {
+                    luint tNumActiveElements = tHMR.get_database()->get_background_mesh()->get_number_of_active_elements_on_proc();
+
+                    for( luint Ik = 0; Ik < tNumActiveElements; Ik += 2 )
+                    {
+                        tHMR.flag_element( Ik );
+                    }
+
+                    tHMR.perform_refinement( 0 );
+                    tHMR.update_refinement_pattern( 0 );
+                }
+
+                tHMR.finalize();
+
+                tLagrangeSignatures( tRun ) = collect_basis_signature( tHMR.get_database()->get_lagrange_mesh_by_index( 0 ) );
+                tBSplineSignatures( tRun )  = collect_basis_signature( tHMR.get_database()->get_bspline_mesh_by_index( 0 ) );
+
+#ifdef MORIS_USE_OPENMP
+                omp_set_num_threads( tNumThreads );
+#endif
+            }
+
+            // node and basis counts, IDs and ownership do not depend on the number of threads
+            REQUIRE( tLagrangeSignatures( 0 ).size() > 0 );
+            REQUIRE( tLagrangeSignatures( 0 ).size() == tLagrangeSignatures( 1 ).size() );
+            REQUIRE( tBSplineSignatures( 0 ).size() == tBSplineSignatures( 1 ).size() );
+
+            CHECK( tLagrangeSignatures( 0 ) == tLagrangeSignatures( 1 ) );
+            CHECK( tBSplineSignatures( 0 ) == tBSplineSignatures( 1 ) );
+        }
+    }
+}
@@ -25,6 +25,7 @@
 #include "cl_Matrix.hpp" //LINALG/src
 #include "op_times.hpp" //LINALG/src
 #include "fn_norm.hpp"
+#include "fn_sum.hpp"
 
 namespace moris::hmr
 {
@@ -332,4 +333,78 @@ namespace moris::hmr
             } // end section
         } // end par rank
     } // end test case
+    // -----------------------------------------------------------------------------------------------------------------
+
+    TEST_CASE( "HMR_T_Matrix_Refinement_Configurations", "[moris],[mesh],[hmr],[hmr_t_matrix]" )
+    {
+        if( moris::par_size() == 1 )
+        {
+            // create settings object
+            auto tParameters = new moris::hmr::Parameters;
+
+            tParameters->set_number_of_elements_per_dimension( { {4}, {4} } );
+            tParameters->set_refinement_buffer( 1 );
+            tParameters->set_staircase_buffer( 1 );
+            tParameters->set_bspline_truncation( true );
+
+            // create factory
+            moris::hmr::Factory tFactory( tParameters );
+
+            // create background mesh object
+            moris::hmr::Background_Mesh_Base* tBackgroundMesh = tFactory.create_background_mesh();
+
+            // refine the Lagrange pattern twice, the B-spline pattern stays coarse
+            tBackgroundMesh->set_activation_pattern( 0 );
+
+            tBackgroundMesh->get_element( 0 )->put_on_refinement_queue();
+            tBackgroundMesh->perform_refinement( 0 );
+
+            tBackgroundMesh->get_element( 0 )->put_on_refinement_queue();
+            tBackgroundMesh->perform_refinement( 0 );
+
+            // create B-Spline Mesh
+            moris::hmr::BSpline_Mesh_Base * tBSplineMesh = tFactory.create_bspline_mesh( tBackgroundMesh, 1, 1 );
+
+            moris::Cell< moris::hmr::BSpline_Mesh_Base* > tBSplineMeshes( 1, tBSplineMesh );
+
+            // create Lagrange Mesh
+            moris::hmr::Lagrange_Mesh_Base * tLagrangeMesh = tFactory.create_lagrange_mesh(
+                    tBackgroundMesh,
+                    tBSplineMeshes,
+                    0,
+                    1 );
+
+            // create T-Matrix object and evaluate it twice
+            auto tTMatrix = new T_Matrix< 2 >( tLagrangeMesh, tBSplineMesh );
+
+            tTMatrix->evaluate( 0 );
+
+            luint tNumberOfConfigurations = tTMatrix->get_number_of_refinement_configurations();
+
+            tTMatrix->evaluate( 0 );
+
+            // refinement paths have at most two levels, so there are at most 1 + 4 + 16 configurations
+            CHECK( tNumberOfConfigurations > 1 );
+            CHECK( tNumberOfConfigurations <= 21 );
+            CHECK( tNumberOfConfigurations < tLagrangeMesh->get_number_of_elements() );
+
+            // configurations are reused by the second evaluation
+            CHECK( tTMatrix->get_number_of_refinement_configurations() == tNumberOfConfigurations );
+
+            // weights of each node must form a partition of unity
+            for( uint k = 0; k < tLagrangeMesh->get_number_of_nodes_on_proc(); ++k )
+            {
+                const Matrix< DDRMat > & tWeights = *tLagrangeMesh->get_node_by_index( k )->get_interpolation( 0 )->get_weights();
+
+                CHECK( std::abs( sum( tWeights ) - 1.0 ) < 1e-12 );
+            }
+
+            // tidy up memory
+            delete tTMatrix;
+            delete tBSplineMesh;
+            delete tLagrangeMesh;
+            delete tBackgroundMesh;
+            delete tParameters;
+        }
+    }
 }
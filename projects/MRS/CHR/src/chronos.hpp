@@ -13,6 +13,7 @@
 
 // chronos header files.
 #include "cl_Stopwatch.hpp" // CHR/src
+#include "cl_Allocation_Counter.hpp" // CHR/src
 #include "cl_Waitbar.hpp" // CHR/src
 
 #endif /* MORIS_CHRONOS_HPP_ */
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_Allocation_Counter.hpp
+ *
+ */
+
+#ifndef MORIS_CHRONOS_CL_ALLOCATION_COUNTER_HPP_
+#define MORIS_CHRONOS_CL_ALLOCATION_COUNTER_HPP_
+
+// C++ header files.
+#include <atomic>
+#include <cstddef>
+
+// MORIS header files.
+#include "typedefs.hpp" // COR/src
+
+namespace moris
+{
+    namespace chronos
+    {
+        /**
+         * Number of heap allocations and allocated bytes.
+         */
+        struct Allocation_Count
+        {
+            luint mNumAllocations = 0;
+            luint mNumBytes       = 0;
+        };
+
+        /**
+         * Process-wide allocation counters. They are incremented by the replacement
+         * operator new, which is only compiled with MORIS_USE_ALLOCATION_COUNTING
+         * (see cl_GlobalClock.cpp). Without this flag the counters stay zero.
+         */
+        inline std::atomic< luint >&
+        allocation_counter()
+        {
+            static std::atomic< luint > sNumAllocations( 0 );
+            return sNumAllocations;
+        }
+
+        inline std::atomic< luint >&
+        allocated_bytes_counter()
+        {
+            static std::atomic< luint > sNumBytes( 0 );
+            return sNumBytes;
+        }
+
+        /**
+         * Returns whether allocations are counted in this build.
+         */
+        inline constexpr bool
+        allocation_counting_enabled()
+        {
+#ifdef MORIS_USE_ALLOCATION_COUNTING
+            return true;
+#else
+            return false;
+#endif
+        }
+
+        /**
+         * Records one heap allocation of aNumBytes bytes.
+         * Must not allocate itself as it is called from operator new.
+         */
+        inline void
+        record_allocation( std::size_t aNumBytes ) noexcept
+        {
+            allocation_counter().fetch_add( 1, std::memory_order_relaxed );
+            allocated_bytes_counter().fetch_add( aNumBytes, std::memory_order_relaxed );
+        }
+
+        /**
+         * Returns the number of allocations and bytes since program start.
+         */
+        inline Allocation_Count
+        get_allocation_count() noexcept
+        {
+            Allocation_Count tCount;
+            tCount.mNumAllocations = allocation_counter().load( std::memory_order_relaxed );
+            tCount.mNumBytes       = allocated_bytes_counter().load( std::memory_order_relaxed );
+            return tCount;
+        }
+
+        /**
+         * Counts the heap allocations within a scope, analogous to the
+         * moris::chronos::Stopwatch for time.
+         *
+         *   Allocation_Counter tCounter;
+         *
+         *   < code to be profiled >
+         *
+         *   Allocation_Count tCount = tCounter.count();
+         */
+        class Allocation_Counter
+        {
+            // counts when the counter was created or reset
+            Allocation_Count mStart;
+
+        public:
+
+            /**
+             * moris::chronos::Allocation_Counter constructor.
+             */
+            Allocation_Counter() noexcept
+            : mStart( get_allocation_count() )
+              {
+              }
+
+            /**
+             * Restart counting from the current state.
+             */
+            void
+            reset() noexcept
+            {
+                mStart = get_allocation_count();
+            }
+
+            /**
+             * Number of allocations and bytes since construction or the last reset.
+             */
+            Allocation_Count
+            count() const noexcept
+            {
+                Allocation_Count tCount = get_allocation_count();
+
+                tCount.mNumAllocations -= mStart.mNumAllocations;
+                tCount.mNumBytes       -= mStart.mNumBytes;
+
+                return tCount;
+            }
+        };
+
+    }// namespace chronos
+}// namespace moris
+
+#endif /* MORIS_CHRONOS_CL_ALLOCATION_COUNTER_HPP_ */
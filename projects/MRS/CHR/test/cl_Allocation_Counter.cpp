@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_Allocation_Counter.cpp
+ *
+ */
+
+// Third-party header files.
+#include <catch.hpp>
+
+// MORIS header files.
+#include "chronos.hpp"
+
+// ----------------------------------------------------------------------------
+
+TEST_CASE(
+        "moris::chronos::Allocation_Counter",
+        "[moris],[chronos],[cl_Allocation_Counter],[Allocation_Counter]")
+{
+    moris::chronos::Allocation_Counter tCounter;
+
+    // record two allocations by hand
+    moris::chronos::record_allocation( 100 );
+    moris::chronos::record_allocation( 28 );
+
+    moris::chronos::Allocation_Count tCount = tCounter.count();
+
+    if ( moris::chronos::allocation_counting_enabled() )
+    {
+        // allocations of other code in between are counted as well
+        REQUIRE( tCount.mNumAllocations >= 2 );
+        REQUIRE( tCount.mNumBytes >= 128 );
+
+        // heap allocations are counted by the replacement operator new
+        tCounter.reset();
+        int* tInt = new int( 1 );
+        delete tInt;
+
+        REQUIRE( tCounter.count().mNumAllocations >= 1 );
+    }
+    else
+    {
+        REQUIRE( tCount.mNumAllocations == 2 );
+        REQUIRE( tCount.mNumBytes == 128 );
+    }
+
+    // counting restarts after reset
+    tCounter.reset();
+    moris::chronos::record_allocation( 8 );
+
+    REQUIRE( tCounter.count().mNumAllocations >= 1 );
+    REQUIRE( tCounter.count().mNumBytes >= 8 );
+}
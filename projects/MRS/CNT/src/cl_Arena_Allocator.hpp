@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_Arena_Allocator.hpp
+ *
+ */
+
+#ifndef SRC_CONTAINERS_CL_ARENA_ALLOCATOR_HPP_
+#define SRC_CONTAINERS_CL_ARENA_ALLOCATOR_HPP_
+
+// C++ header files.
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include <algorithm>
+// MORIS library header files.
+#include "typedefs.hpp" // COR/src
+
+namespace moris
+{
+    /**
+     * Monotonic arena for short-lived temporaries.
+     *
+     * Memory is handed out by bumping an offset into a block and is only
+     * released all at once by reset(). If a pass needed more than one block,
+     * reset() merges them into a single block of the total size, so that after
+     * the first pass repeated passes of the same size do not allocate.
+     *
+     * Pointers obtained from allocate() are invalidated by reset().
+     */
+    class Arena_Allocator
+    {
+    private:
+
+        // memory blocks and their sizes in bytes
+        std::vector< std::unique_ptr< char[] > > mBlocks;
+        std::vector< std::size_t >               mBlockSizes;
+
+        // offset of the first free byte in the last block
+        std::size_t mOffset = 0;
+
+        // size of the first block in bytes
+        std::size_t mInitialSize;
+
+    public:
+
+        /**
+         * moris::Arena_Allocator constructor
+         *
+         * @param[ in ] aInitialSize size of the first block in bytes, allocated on first use
+         */
+        Arena_Allocator( std::size_t aInitialSize = 64 * 1024 )
+        : mInitialSize( aInitialSize )
+          {
+          }
+
+        /**
+         * moris::Arena_Allocator destructor
+         */
+        ~Arena_Allocator() = default;
+
+        // the arena hands out raw pointers into its blocks, it must not be copied
+        Arena_Allocator( const Arena_Allocator& ) = delete;
+        Arena_Allocator& operator=( const Arena_Allocator& ) = delete;
+
+        //------------------------------------------------------------------------------
+
+        /**
+         * Returns uninitialized memory for aNumEntries entries of type T.
+         *
+         * @param[ in ] aNumEntries number of entries
+         */
+        template< typename T >
+        T*
+        allocate( std::size_t aNumEntries )
+        {
+            std::size_t tNumBytes = std::max( aNumEntries * sizeof( T ), std::size_t( 1 ) );
+
+            // align offset in current block
+            std::size_t tOffset = ( mOffset + alignof( T ) - 1 ) / alignof( T ) * alignof( T );
+
+            // add new block if the current one is full
+            if ( mBlocks.empty() || tOffset + tNumBytes > mBlockSizes.back() )
+            {
+                std::size_t tBlockSize = mBlocks.empty() ? mInitialSize : 2 * mBlockSizes.back();
+
+                this->add_block( std::max( tBlockSize, tNumBytes ) );
+
+                tOffset = 0;
+            }
+
+            mOffset = tOffset + tNumBytes;
+
+            return reinterpret_cast< T* >( mBlocks.back().get() + tOffset );
+        }
+
+        //------------------------------------------------------------------------------
+
+        /**
+         * Releases all memory handed out by the arena.
+         */
+        void
+        reset()
+        {
+            // merge blocks into one block of the total size
+            if ( mBlocks.size() > 1 )
+            {
+                std::size_t tTotalSize = 0;
+                for ( std::size_t tBlockSize : mBlockSizes )
+                {
+                    tTotalSize += tBlockSize;
+                }
+
+                mBlocks.clear();
+                mBlockSizes.clear();
+
+                this->add_block( tTotalSize );
+            }
+
+            mOffset = 0;
+        }
+
+        //------------------------------------------------------------------------------
+
+        /**
+         * Returns the number of bytes reserved by the arena.
+         */
+        std::size_t
+        capacity() const
+        {
+            std::size_t tTotalSize = 0;
+            for ( std::size_t tBlockSize : mBlockSizes )
+            {
+                tTotalSize += tBlockSize;
+            }
+
+            return tTotalSize;
+        }
+
+        //------------------------------------------------------------------------------
+
+    private:
+
+        /**
+         * Adds a block of aNumBytes bytes.
+         */
+        void
+        add_block( std::size_t aNumBytes )
+        {
+            mBlocks.emplace_back( new char[ aNumBytes ] );
+            mBlockSizes.push_back( aNumBytes );
+        }
+
+    }; // class Arena_Allocator
+} // namespace moris
+
+#endif /* SRC_CONTAINERS_CL_ARENA_ALLOCATOR_HPP_ */
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_Arena_Allocator.cpp
+ *
+ */
+
+#include <cstdint>
+
+// Third-party header files.
+#include <catch.hpp>
+
+// MORIS project header files.
+#include "typedefs.hpp"
+#include "cl_Arena_Allocator.hpp" // CON/src
+
+// ----------------------------------------------------------------------------
+
+TEST_CASE(
+        "moris::Arena_Allocator",
+        "[moris],[containers],[Arena_Allocator]" )
+{
+    moris::Arena_Allocator tArena( 64 );
+
+    SECTION( "alignment and distinct memory" )
+    {
+        char*         tChar = tArena.allocate< char >( 3 );
+        moris::real*  tReal = tArena.allocate< moris::real >( 4 );
+        moris::luint* tLint = tArena.allocate< moris::luint >( 2 );
+
+        REQUIRE( reinterpret_cast< std::uintptr_t >( tReal ) % alignof( moris::real ) == 0 );
+        REQUIRE( reinterpret_cast< std::uintptr_t >( tLint ) % alignof( moris::luint ) == 0 );
+
+        // write all entries and read them back
+        tChar[ 2 ] = 'a';
+        for ( moris::uint i = 0; i < 4; i++ )
+        {
+            tReal[ i ] = 1.5 * i;
+        }
+        tLint[ 0 ] = 7;
+        tLint[ 1 ] = 8;
+
+        REQUIRE( tChar[ 2 ] == 'a' );
+        REQUIRE( tReal[ 3 ] == 4.5 );
+        REQUIRE( tLint[ 1 ] == 8 );
+    }
+
+    SECTION( "blocks are merged on reset" )
+    {
+        // exceed the first block
+        for ( moris::uint i = 0; i < 10; i++ )
+        {
+            tArena.allocate< moris::real >( 10 );
+        }
+
+        std::size_t tCapacity = tArena.capacity();
+        REQUIRE( tCapacity >= 10 * 10 * sizeof( moris::real ) );
+
+        // after reset the same requests fit into the merged block
+        tArena.reset();
+        REQUIRE( tArena.capacity() == tCapacity );
+
+        moris::real* tFirst = tArena.allocate< moris::real >( 10 );
+        for ( moris::uint i = 1; i < 10; i++ )
+        {
+            tArena.allocate< moris::real >( 10 );
+        }
+
+        REQUIRE( tArena.capacity() == tCapacity );
+
+        // memory is reused after reset
+        tArena.reset();
+        REQUIRE( tArena.allocate< moris::real >( 10 ) == tFirst );
+    }
+}
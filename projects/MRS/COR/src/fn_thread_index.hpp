@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * fn_thread_index.hpp
+ *
+ */
+
+#ifndef MORIS_GENERAL_FN_THREAD_INDEX_HPP_
+#define MORIS_GENERAL_FN_THREAD_INDEX_HPP_
+
+#include "typedefs.hpp"
+
+#ifdef MORIS_USE_OPENMP
+#include <omp.h>
+#endif
+
+namespace moris
+{
+    /**
+     * returns the index of the calling thread within the current parallel region,
+     * 0 outside of parallel regions or if OpenMP is not available
+     */
+    inline uint
+    get_thread_index()
+    {
+#ifdef MORIS_USE_OPENMP
+        return omp_get_thread_num();
+#else
+        return 0;
+#endif
+    }
+}    // namespace moris
+
+#endif /* MORIS_GENERAL_FN_THREAD_INDEX_HPP_ */
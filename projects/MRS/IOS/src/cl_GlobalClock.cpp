@@ -22,6 +22,62 @@
 // Define uint, real, etc.
 #include "typedefs.hpp"
 
+#ifdef MORIS_USE_ALLOCATION_COUNTING
+#include <cstdlib>
+#include <new>
+
+// --------------------------------------------------------------------------------
+// Replacement of the global allocation functions to count heap allocations per
+// Tracer scope. They are defined here as this translation unit is linked into
+// every executable using the logger. The nothrow versions forward to these,
+// over-aligned allocations are not counted.
+
+void*
+operator new( std::size_t aNumBytes )
+{
+    moris::chronos::record_allocation( aNumBytes );
+
+    void* tPointer = std::malloc( aNumBytes == 0 ? 1 : aNumBytes );
+
+    if ( tPointer == nullptr )
+    {
+        throw std::bad_alloc();
+    }
+
+    return tPointer;
+}
+
+void*
+operator new[]( std::size_t aNumBytes )
+{
+    return operator new( aNumBytes );
+}
+
+void
+operator delete( void* aPointer ) noexcept
+{
+    std::free( aPointer );
+}
+
+void
+operator delete[]( void* aPointer ) noexcept
+{
+    std::free( aPointer );
+}
+
+void
+operator delete( void* aPointer, std::size_t ) noexcept
+{
+    std::free( aPointer );
+}
+
+void
+operator delete[]( void* aPointer, std::size_t ) noexcept
+{
+    std::free( aPointer );
+}
+#endif
+
 namespace moris
 {
 
@@ -56,6 +112,10 @@ namespace moris
         // record starting wall clock time
         if ( PRINT_WALL_TIME )
             mWallTimeStamps.resize( 1, std::chrono::system_clock::now() );
+
+        // record allocation count at start
+        if ( chronos::allocation_counting_enabled() )
+            mAllocationStamps.resize( 1, chronos::get_allocation_count() );
     }
 
     // --------------------------------------------------------------------------------
@@ -100,6 +160,10 @@ namespace moris
         if ( PRINT_WALL_TIME )
             mWallTimeStamps.push_back( std::chrono::system_clock::now() );
 
+        // create allocation count stamp for new entity
+        if ( chronos::allocation_counting_enabled() )
+            mAllocationStamps.push_back( chronos::get_allocation_count() );
+
 #ifdef MORIS_HAVE_DEBUG
         // check that indentation level and array size match
         if ( mIndentationLevel != mCurrentFunctionID.size() - 1 )
@@ -146,6 +210,10 @@ namespace moris
         if ( PRINT_WALL_TIME )
             mWallTimeStamps.pop_back();
 
+        // remove allocation count stamp from list of active entities
+        if ( chronos::allocation_counting_enabled() )
+            mAllocationStamps.pop_back();
+
 #ifdef MORIS_HAVE_DEBUG
         // check that indentation level and array size match
         if ( mIndentationLevel != mCurrentFunctionID.size() - 1 )
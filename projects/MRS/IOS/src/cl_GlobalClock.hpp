@@ -23,6 +23,9 @@
 // Define uint, real, etc.
 #include "typedefs.hpp"
 
+// heap allocation counts
+#include "cl_Allocation_Counter.hpp"
+
 namespace moris
 {
 
@@ -67,6 +70,9 @@ namespace moris
         // wall clock timer for debugging purposes
         std::vector< std::chrono::_V2::system_clock::time_point > mWallTimeStamps;
 
+        // list of allocation counts at start of each active entity (only filled with MORIS_USE_ALLOCATION_COUNTING)
+        std::vector< chronos::Allocation_Count > mAllocationStamps;
+
         //------------------------------------ PUBLIC -------------------------------------
 
       public:
@@ -246,9 +246,31 @@ namespace moris
             tElapsedWallTimeMin = logger_min_all( tElapsedWallTime );
         }
 
+        // heap allocations within this entity, summed over all processors
+        real tNumAllocations = 0.0;
+        real tAllocatedMB    = 0.0;
+        if ( chronos::allocation_counting_enabled() )
+        {
+            const chronos::Allocation_Count& tStart = mGlobalClock.mAllocationStamps[ mGlobalClock.mIndentationLevel ];
+            chronos::Allocation_Count        tEnd   = chronos::get_allocation_count();
+
+            real tLocalNumAllocations = (real)( tEnd.mNumAllocations - tStart.mNumAllocations );
+            real tLocalAllocatedMB    = (real)( tEnd.mNumBytes - tStart.mNumBytes ) / 1048576.0;
+
+            tNumAllocations = logger_sum_all( tLocalNumAllocations );
+            tAllocatedMB    = logger_sum_all( tLocalAllocatedMB );
+        }
+
         // log to file
         if ( mWriteToAscii )
         {
+            // log allocations within this entity
+            if ( chronos::allocation_counting_enabled() )
+            {
+                this->log_to_file( "Allocations", tNumAllocations );
+                this->log_to_file( "AllocatedMB", tAllocatedMB );
+            }
+
             // print timing for previous iteration if previous iterations are present
             if ( mGlobalClock.mCurrentIteration[ mGlobalClock.mIndentationLevel ] > 0 )
             {
@@ -303,6 +325,11 @@ namespace moris
                                   << "ElapsedWallTime (max/min) = " << tElapsedWallTimeMax << " / " << tElapsedWallTimeMin << " \n"
                                   << std::flush;
 
+                    if ( chronos::allocation_counting_enabled() )
+                        std::cout << print_empty_line( mGlobalClock.mIndentationLevel ) << "_"
+                                  << "Allocations (sum) = " << tNumAllocations << " / " << tAllocatedMB << " MB \n"
+                                  << std::flush;
+
                     if ( mMemoryOutput )
                     {
                         std::cout << print_empty_line( mGlobalClock.mIndentationLevel ) << "_"
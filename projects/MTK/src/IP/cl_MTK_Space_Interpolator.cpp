@@ -17,6 +17,7 @@
 #include "fn_linsolve.hpp"
 
 #include "cl_MTK_Space_Interpolator.hpp"
+#include "fn_MTK_Fixed_Size_Kernels.hpp"
 
 namespace moris
 {
@@ -412,12 +413,58 @@ namespace moris
             MORIS_ASSERT( mXHat.numel() > 0,
                     "Space_Interpolator::space_jacobian - mXHat is not set." );
 
+            // linear and quadratic quad and hex elements use the fixed size kernels
+            if ( mNumSpaceParamDim == mNumSpaceDim && mXHat.n_cols() == mNumSpaceDim )
+            {
+                if ( mNumSpaceDim == 3 && mNumSpaceBases == 8 )
+                {
+                    this->eval_space_jacobian_fixed< 3, 8 >();
+                    return;
+                }
+
+                if ( mNumSpaceDim == 3 && mNumSpaceBases == 27 )
+                {
+                    this->eval_space_jacobian_fixed< 3, 27 >();
+                    return;
+                }
+
+                if ( mNumSpaceDim == 2 && mNumSpaceBases == 4 )
+                {
+                    this->eval_space_jacobian_fixed< 2, 4 >();
+                    return;
+                }
+
+                if ( mNumSpaceDim == 2 && mNumSpaceBases == 9 )
+                {
+                    this->eval_space_jacobian_fixed< 2, 9 >();
+                    return;
+                }
+            }
+
             // compute the Jacobian
             mSpaceJac = this->dNdXi() * mXHat;
         }
 
         //------------------------------------------------------------------------------
 
+        template< uint D, uint N >
+        void
+        Space_Interpolator::eval_space_jacobian_fixed()
+        {
+            // copy shape function derivatives and coefficients into fixed size storage
+            Fixed_Matrix< D, N > tdNdXi;
+            Fixed_Matrix< N, D > tXHat;
+            copy_to_fixed( this->dNdXi(), tdNdXi );
+            copy_to_fixed( mXHat, tXHat );
+
+            // compute the Jacobian and store it without reallocation
+            Fixed_Matrix< D, D > tSpaceJac;
+            mtk::eval_space_jacobian( tdNdXi, tXHat, tSpaceJac );
+            copy_from_fixed( tSpaceJac, mSpaceJac );
+        }
+
+        //------------------------------------------------------------------------------
+
         const Matrix< DDRMat >&
         Space_Interpolator::space_jacobian_deriv(
                 const uint& aLocalVertexID,
@@ -646,6 +646,14 @@ namespace moris
              */
             void set_function_pointers();
 
+            //------------------------------------------------------------------------------
+            /**
+             * evaluates the geometry Jacobian in space with the fixed size kernels
+             * for elements with D space dimensions and N bases
+             */
+            template< uint D, uint N >
+            void eval_space_jacobian_fixed();
+
             //------------------------------------------------------------------------------
             /**
              * evaluate space detJ.
@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * fn_MTK_Fixed_Size_Kernels.hpp
+ *
+ */
+
+#ifndef SRC_MTK_FN_MTK_FIXED_SIZE_KERNELS_HPP_
+#define SRC_MTK_FN_MTK_FIXED_SIZE_KERNELS_HPP_
+
+#include <array>
+
+#include "typedefs.hpp"
+#include "assert.hpp"
+#include "cl_Matrix.hpp"
+#include "linalg_typedefs.hpp"
+
+namespace moris
+{
+    namespace mtk
+    {
+        //------------------------------------------------------------------------------
+        /*
+         * Kernels for the space Jacobian, its inverse and the shape function derivatives
+         * wrt x, specialized at compile time on the number of space dimensions D and the
+         * number of bases N. They work on stack allocated arrays and do not allocate.
+         *
+         * Matrix layouts follow the ones of the Space_Interpolator:
+         * dNdXi and dNdx are ( D x N ), xHat is ( N x D ).
+         */
+        //------------------------------------------------------------------------------
+
+        // fixed size, stack allocated, row major matrix
+        template< uint R, uint C >
+        using Fixed_Matrix = std::array< std::array< real, C >, R >;
+
+        //------------------------------------------------------------------------------
+        /**
+         * copy a dynamic matrix into a fixed size matrix
+         * @param[ in ]  aMatrix      dynamic matrix ( R x C )
+         * @param[ out ] aFixedMatrix fixed size matrix ( R x C )
+         */
+        template< uint R, uint C >
+        inline void
+        copy_to_fixed(
+                const Matrix< DDRMat >& aMatrix,
+                Fixed_Matrix< R, C >&   aFixedMatrix )
+        {
+            MORIS_ASSERT( aMatrix.n_rows() == R && aMatrix.n_cols() == C,
+                    "copy_to_fixed - size mismatch." );
+
+            for ( uint iRow = 0; iRow < R; iRow++ )
+            {
+                for ( uint iCol = 0; iCol < C; iCol++ )
+                {
+                    aFixedMatrix[ iRow ][ iCol ] = aMatrix( iRow, iCol );
+                }
+            }
+        }
+
+        //------------------------------------------------------------------------------
+        /**
+         * evaluate the space Jacobian J = dNdXi * xHat
+         * @param[ in ]  adNdXi shape function derivatives wrt xi ( D x N )
+         * @param[ in ]  aXHat  space coefficients ( N x D )
+         * @param[ out ] aJ     space Jacobian ( D x D )
+         */
+        template< uint D, uint N >
+        inline void
+        eval_space_jacobian(
+                const Fixed_Matrix< D, N >& adNdXi,
+                const Fixed_Matrix< N, D >& aXHat,
+                Fixed_Matrix< D, D >&       aJ )
+        {
+            for ( uint iRow = 0; iRow < D; iRow++ )
+            {
+                for ( uint iCol = 0; iCol < D; iCol++ )
+                {
+                    real tSum = 0.0;
+                    for ( uint iBase = 0; iBase < N; iBase++ )
+                    {
+                        tSum += adNdXi[ iRow ][ iBase ] * aXHat[ iBase ][ iCol ];
+                    }
+                    aJ[ iRow ][ iCol ] = tSum;
+                }
+            }
+        }
+
+        //------------------------------------------------------------------------------
+        /**
+         * evaluate the inverse and the determinant of the space Jacobian
+         * @param[ in ]  aJ    space Jacobian ( D x D )
+         * @param[ out ] aInvJ inverse space Jacobian ( D x D )
+         * @return determinant of the space Jacobian
+         */
+        template< uint D >
+        real eval_inverse_space_jacobian(
+                const Fixed_Matrix< D, D >& aJ,
+                Fixed_Matrix< D, D >&       aInvJ );
+
+        template<>
+        inline real
+        eval_inverse_space_jacobian< 1 >(
+                const Fixed_Matrix< 1, 1 >& aJ,
+                Fixed_Matrix< 1, 1 >&       aInvJ )
+        {
+            real tDetJ = aJ[ 0 ][ 0 ];
+
+            MORIS_ASSERT( tDetJ > 0.0,
+                    "eval_inverse_space_jacobian - space determinant (1D) close to zero or negative: %e",
+                    tDetJ );
+
+            aInvJ[ 0 ][ 0 ] = 1.0 / tDetJ;
+
+            return tDetJ;
+        }
+
+        template<>
+        inline real
+        eval_inverse_space_jacobian< 2 >(
+                const Fixed_Matrix< 2, 2 >& aJ,
+                Fixed_Matrix< 2, 2 >&       aInvJ )
+        {
+            real tDetJ = aJ[ 0 ][ 0 ] * aJ[ 1 ][ 1 ] - aJ[ 0 ][ 1 ] * aJ[ 1 ][ 0 ];
+
+            MORIS_ASSERT( tDetJ > 0.0,
+                    "eval_inverse_space_jacobian - space determinant (2D) close to zero or negative: %e",
+                    tDetJ );
+
+            real tInvDet = 1.0 / tDetJ;
+
+            aInvJ[ 0 ][ 0 ] = aJ[ 1 ][ 1 ] * tInvDet;
+            aInvJ[ 0 ][ 1 ] = -aJ[ 0 ][ 1 ] * tInvDet;
+            aInvJ[ 1 ][ 0 ] = -aJ[ 1 ][ 0 ] * tInvDet;
+            aInvJ[ 1 ][ 1 ] = aJ[ 0 ][ 0 ] * tInvDet;
+
+            return tDetJ;
+        }
+
+        template<>
+        inline real
+        eval_inverse_space_jacobian< 3 >(
+                const Fixed_Matrix< 3, 3 >& aJ,
+                Fixed_Matrix< 3, 3 >&       aInvJ )
+        {
+            // cofactors of the first row
+            real tC00 = aJ[ 1 ][ 1 ] * aJ[ 2 ][ 2 ] - aJ[ 2 ][ 1 ] * aJ[ 1 ][ 2 ];
+            real tC10 = aJ[ 1 ][ 2 ] * aJ[ 2 ][ 0 ] - aJ[ 1 ][ 0 ] * aJ[ 2 ][ 2 ];
+            real tC20 = aJ[ 1 ][ 0 ] * aJ[ 2 ][ 1 ] - aJ[ 2 ][ 0 ] * aJ[ 1 ][ 1 ];
+
+            real tDetJ = aJ[ 0 ][ 0 ] * tC00 + aJ[ 0 ][ 1 ] * tC10 + aJ[ 0 ][ 2 ] * tC20;
+
+            MORIS_ASSERT( tDetJ > 0.0,
+                    "eval_inverse_space_jacobian - space determinant (3D) close to zero or negative: %e",
+                    tDetJ );
+
+            real tInvDet = 1.0 / tDetJ;
+
+            aInvJ[ 0 ][ 0 ] = tC00 * tInvDet;
+            aInvJ[ 0 ][ 1 ] = ( aJ[ 0 ][ 2 ] * aJ[ 2 ][ 1 ] - aJ[ 0 ][ 1 ] * aJ[ 2 ][ 2 ] ) * tInvDet;
+            aInvJ[ 0 ][ 2 ] = ( aJ[ 0 ][ 1 ] * aJ[ 1 ][ 2 ] - aJ[ 0 ][ 2 ] * aJ[ 1 ][ 1 ] ) * tInvDet;
+            aInvJ[ 1 ][ 0 ] = tC10 * tInvDet;
+            aInvJ[ 1 ][ 1 ] = ( aJ[ 0 ][ 0 ] * aJ[ 2 ][ 2 ] - aJ[ 0 ][ 2 ] * aJ[ 2 ][ 0 ] ) * tInvDet;
+            aInvJ[ 1 ][ 2 ] = ( aJ[ 1 ][ 0 ] * aJ[ 0 ][ 2 ] - aJ[ 0 ][ 0 ] * aJ[ 1 ][ 2 ] ) * tInvDet;
+            aInvJ[ 2 ][ 0 ] = tC20 * tInvDet;
+            aInvJ[ 2 ][ 1 ] = ( aJ[ 2 ][ 0 ] * aJ[ 0 ][ 1 ] - aJ[ 0 ][ 0 ] * aJ[ 2 ][ 1 ] ) * tInvDet;
+            aInvJ[ 2 ][ 2 ] = ( aJ[ 0 ][ 0 ] * aJ[ 1 ][ 1 ] - aJ[ 1 ][ 0 ] * aJ[ 0 ][ 1 ] ) * tInvDet;
+
+            return tDetJ;
+        }
+
+        //------------------------------------------------------------------------------
+        /**
+         * evaluate the shape function derivatives wrt x, dNdx = inv( J ) * dNdXi
+         * @param[ in ]  aInvJ  inverse space Jacobian ( D x D )
+         * @param[ in ]  adNdXi shape function derivatives wrt xi ( D x N )
+         * @param[ out ] adNdx  shape function derivatives wrt x ( D x N )
+         */
+        template< uint D, uint N >
+        inline void
+        eval_dNdx(
+                const Fixed_Matrix< D, D >& aInvJ,
+                const Fixed_Matrix< D, N >& adNdXi,
+                Fixed_Matrix< D, N >&       adNdx )
+        {
+            for ( uint iRow = 0; iRow < D; iRow++ )
+            {
+                for ( uint iBase = 0; iBase < N; iBase++ )
+                {
+                    real tSum = 0.0;
+                    for ( uint iDim = 0; iDim < D; iDim++ )
+                    {
+                        tSum += aInvJ[ iRow ][ iDim ] * adNdXi[ iDim ][ iBase ];
+                    }
+                    adNdx[ iRow ][ iBase ] = tSum;
+                }
+            }
+        }
+
+        //------------------------------------------------------------------------------
+        /**
+         * copy a fixed size matrix into a dynamic matrix, which is only resized if needed
+         * @param[ in ]  aFixedMatrix fixed size matrix ( R x C )
+         * @param[ out ] aMatrix      dynamic matrix ( R x C )
+         */
+        template< uint R, uint C >
+        inline void
+        copy_from_fixed(
+                const Fixed_Matrix< R, C >& aFixedMatrix,
+                Matrix< DDRMat >&           aMatrix )
+        {
+            if ( aMatrix.n_rows() != R || aMatrix.n_cols() != C )
+            {
+                aMatrix.set_size( R, C );
+            }
+
+            for ( uint iRow = 0; iRow < R; iRow++ )
+            {
+                for ( uint iCol = 0; iCol < C; iCol++ )
+                {
+                    aMatrix( iRow, iCol ) = aFixedMatrix[ iRow ][ iCol ];
+                }
+            }
+        }
+
+        //------------------------------------------------------------------------------
+    } /* namespace mtk */
+} /* namespace moris */
+
+#endif /* SRC_MTK_FN_MTK_FIXED_SIZE_KERNELS_HPP_ */
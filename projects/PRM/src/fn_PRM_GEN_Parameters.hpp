@@ -69,6 +69,7 @@ namespace moris
             tParameterList.insert( "output_mesh_file", "" );                 // File name for exodus mesh, if default no mesh is written
             tParameterList.insert( "geometry_field_file", "" );              // Base file name (without extension) for saving geometry fields
             tParameterList.insert( "time_offset", 0.0 );                     // Time offset for writing files in optimization process
+            tParameterList.insert( "num_threads", 1 );                       // Number of threads for classifying background cells (requires OpenMP)
 
             // ADVs/IQIs
             tParameterList.insert( "initial_advs", "" );          // Initial ADVs, string converted into vector
@@ -169,6 +170,7 @@ namespace moris
             tParameterList.insert( "sdf_object_path", "" );      // obj file
             tParameterList.insert( "sdf_object_offset", "" );    // offset of object
             tParameterList.insert( "sdf_shift", 0.0 );           // sdf shift
+            tParameterList.insert( "sdf_num_threads", 1 );       // number of threads for sdf calculation
 
             return tParameterList;
         }
@@ -105,6 +105,12 @@ namespace moris
             // name of restart file - load
             tParameterList.insert( "restart_refinement_pattern_file", "" );
 
+            // redistribute coarsest elements among procs according to the number of active elements after refinement
+            tParameterList.insert( "load_balancing", false );
+
+            // max/mean ratio of active elements per proc above which the mesh is redistributed
+            tParameterList.insert( "load_balancing_tolerance", 1.2 );
+
             // name of vtk file for writing basis function locations
             tParameterList.insert( "basis_function_vtk_file", "" );
 
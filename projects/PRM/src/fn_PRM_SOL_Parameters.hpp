@@ -49,12 +49,32 @@ namespace moris
             // save final adjoint vector to file
             tSolverWarehouseList.insert( "SOL_save_final_adjoint_vec_to_file", std::string( "" ) );
 
+            // append the optimization iteration to the files of the final solution and adjoint vectors,
+            // such that a restarted optimization can use them as initial guess (see TSA_Initialize_Sol_Vec)
+            tSolverWarehouseList.insert( "SOL_checkpoint_per_opt_iteration", false );
+
             // initial SOLUTION (i.e. initial condition / previous time step)
             tSolverWarehouseList.insert( "TSA_Initial_Sol_Vec", "" );
 
             // flag to save solution vectors of various time steps to hdf5 file
             tSolverWarehouseList.insert( "TSA_Save_Sol_Vecs_to_file", "" );
 
+            // number of threads used to compute element contributions during assembly (requires OpenMP)
+            tSolverWarehouseList.insert( "SOL_assembly_num_threads", 1 );
+
+            // scatter element contributions in serial order such that assembly is bitwise reproducible
+            tSolverWarehouseList.insert( "SOL_deterministic_assembly", true );
+
+            // sum element matrices into the matrix storage using cached offsets (Epetra only)
+            tSolverWarehouseList.insert( "SOL_assembly_use_cache", false );
+
+            // reuse matrix graph and sparsity pattern of linear systems with the same dof types
+            tSolverWarehouseList.insert( "SOL_reuse_matrix_graph", false );
+
+            // apply the Jacobian matrix-free by looping over the equation objects in every matrix-vector product,
+            // only the diagonal is assembled (Epetra only, requires Belos or Aztec with Jacobi or Chebyshev preconditioner)
+            tSolverWarehouseList.insert( "SOL_matrix_free", false );
+
             return tSolverWarehouseList;
         }
 
@@ -70,7 +90,8 @@ namespace moris
             //              https://docs.trilinos.org/dev/packages/ifpack/doc/html/index.html
 
             // set ifpack preconditioner type
-            // options are: point relaxation, block relaxation, ILU, ILUT, IC, ICT, Amesos, SPARSKIT, Krylov
+            // options are: point relaxation, block relaxation, ILU, ILUT, IC, ICT, Amesos, SPARSKIT, Krylov,
+            //              Jacobi, Chebyshev (built from the matrix diagonal only, can be used with matrix-free operators)
             aParameterlist.insert( "ifpack_prec_type", "" );
 
             // overlap between processors
@@ -172,6 +193,31 @@ namespace moris
 
             aParameterlist.insert( "krylov: zero starting solution", 0 );
 
+            // Chebyshev parameters
+
+            // polynomial degree
+            aParameterlist.insert( "chebyshev: degree", 3 );
+
+            // ratio of largest to smallest eigenvalue of the smoothed spectrum
+            aParameterlist.insert( "chebyshev: ratio eigenvalue", 30.0 );
+
+            // largest eigenvalue of the Jacobi scaled operator; estimated by power iterations if negative
+            aParameterlist.insert( "chebyshev: max eigenvalue", -1.0 );
+
+            // number of power iterations to estimate the largest eigenvalue; the estimate
+            // is kept after the first nonlinear iteration if prec_reuse is set
+            aParameterlist.insert( "chebyshev: eigenvalue iterations", 10 );
+
+            // Field split parameters
+
+            // dof types of the blocks of a field-split preconditioner, e.g. "UX,UY;P"; blocks are separated by ';'
+            // the diagonal blocks are preconditioned with ifpack_prec_type (ILU if not set)
+            aParameterlist.insert( "field_split_blocks", "" );
+
+            // options are: additive (block Jacobi), multiplicative (block Gauss-Seidel),
+            //              schur (two blocks, approximate Schur complement A_11 - A_10 diag(A_00)^-1 A_01)
+            aParameterlist.insert( "field_split_type", "multiplicative" );
+
             // Reuse of preconditioner
             aParameterlist.insert( "prec_reuse", false );
         }
@@ -590,6 +636,12 @@ namespace moris
             // blocks in addtive Schwartz algorthim
             tLinAlgorithmParameterList.insert( "ASM_blocks_output_filename", "" );
 
+            // dof types of the blocks for PCType fieldsplit, e.g. "UX,UY;P"; blocks are separated by ';'
+            tLinAlgorithmParameterList.insert( "field_split_blocks", "" );
+
+            // field split type for PCType fieldsplit: additive, multiplicative, schur
+            tLinAlgorithmParameterList.insert( "field_split_type", "multiplicative" );
+
             return tLinAlgorithmParameterList;
         }
 
@@ -731,6 +783,16 @@ namespace moris
             // Determines if jacobian is rebuild for every nonlinear iteration
             tNonLinAlgorithmParameterList.insert( "NLA_rebuild_jacobian", true );
 
+            // Determines if the jacobian and preconditioner are kept across Newton iterations and time steps
+            // as long as the convergence rate is acceptable; overrides NLA_rebuild_jacobian
+            tNonLinAlgorithmParameterList.insert( "NLA_adaptive_jacobian_reuse", false );
+
+            // Maximal ratio of residual norms of two successive iterations for which the jacobian is kept
+            tNonLinAlgorithmParameterList.insert( "NLA_jacobian_reuse_max_rate", 0.5 );
+
+            // Maximal number of linear solves with the same jacobian
+            tNonLinAlgorithmParameterList.insert( "NLA_jacobian_reuse_max_age", 10 );
+
             // Determines if linear solve should restart on fail
             tNonLinAlgorithmParameterList.insert( "NLA_combined_res_jac_assembly", true );
 
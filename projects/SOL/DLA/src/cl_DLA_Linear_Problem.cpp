@@ -109,6 +109,8 @@ namespace moris
             // assemble Jacobian
             mSolverInterface->assemble_jacobian( mMat );
 
+            mIsJacobianAssembled = true;
+
             // get RHS Matrix Type from solver warehouse
             if ( mSolverWarehouse )
             {
@@ -173,6 +175,8 @@ namespace moris
 
             mSolverInterface->fill_matrix_and_RHS( mMat, mPointVectorRHS );
 
+            mIsJacobianAssembled = true;
+
             // additional contributions for adjoint sensitivities
             if ( !mSolverInterface->get_is_forward_analysis() )
             {
@@ -64,6 +64,15 @@ namespace moris
             //! Pointer to RHS Matrix Type
             std::string mRHSMatType;
 
+            //! Flag whether a jacobian has been assembled into the matrix
+            bool mIsJacobianAssembled = false;
+
+            //! Flag whether the matrix is unchanged since the previous solve such that preconditioners can be reused
+            bool mReusePreconditioner = false;
+
+            //! Flag whether preconditioners and factorizations are kept after the solve for later reuse
+            bool mKeepPreconditioner = false;
+
             //------------------------------------------------------------------
 
           public:
@@ -159,6 +168,57 @@ namespace moris
 
             //------------------------------------------------------------------
 
+            bool
+            is_jacobian_assembled() const
+            {
+                return mIsJacobianAssembled;
+            };
+
+            //------------------------------------------------------------------
+
+            /**
+             * set flag whether the linear solvers can reuse the preconditioner or factorization
+             * computed in the previous solve as the matrix has not changed since
+             *
+             * @param[in] aReusePreconditioner Reuse flag
+             */
+            void
+            set_reuse_preconditioner( const bool aReusePreconditioner )
+            {
+                mReusePreconditioner = aReusePreconditioner;
+            };
+
+            //------------------------------------------------------------------
+
+            bool
+            get_reuse_preconditioner() const
+            {
+                return mReusePreconditioner;
+            };
+
+            //------------------------------------------------------------------
+
+            /**
+             * set flag whether the linear solvers keep preconditioners and factorizations after the solve
+             *
+             * @param[in] aKeepPreconditioner Keep flag
+             */
+            void
+            set_keep_preconditioner( const bool aKeepPreconditioner )
+            {
+                mKeepPreconditioner = aKeepPreconditioner;
+            };
+
+            //------------------------------------------------------------------
+
+            bool
+            get_keep_preconditioner() const
+            {
+                return mKeepPreconditioner;
+            };
+
+            //------------------------------------------------------------------
+
             virtual void get_solution( moris::Matrix< DDRMat >& LHSValues ) = 0;
 
             //------------------------------------------------------------------
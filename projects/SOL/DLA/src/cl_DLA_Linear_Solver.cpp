@@ -179,6 +179,9 @@ Linear_Solver::solver_linear_system(
                     tSolVecNorm( 0 ) );
         }
 
+        // do not reuse preconditioners of previous solves after a failed solve
+        aLinearProblem->set_reuse_preconditioner( false );
+
         // Re-solve scaled linear system with current solution as an initial guess
         tErrorStatus = mLinearSolverList( tTryRestartOnFailIt )->solve_linear_system( aLinearProblem, aIter );
 
@@ -126,18 +126,17 @@ Linear_Solver_Amesos::solve_linear_system(
 
     mLinearSystem = aLinearSystem;
 
+    MORIS_ERROR( !aLinearSystem->get_matrix()->is_matrix_free(),
+            "Linear_Solver_Amesos::solve_linear_system - direct solvers require an assembled matrix.\n" );
+
     mEpetraProblem.SetOperator( aLinearSystem->get_matrix()->get_matrix() );
     mEpetraProblem.SetRHS( dynamic_cast< Vector_Epetra* >( aLinearSystem->get_solver_RHS() )->get_epetra_vector() );
     mEpetraProblem.SetLHS( dynamic_cast< Vector_Epetra* >( aLinearSystem->get_free_solver_LHS() )->get_epetra_vector() );
 
-    Amesos tAmesosFactory;
-
     std::string tSolverType = mParameterList.get< std::string >( "Solver_Type" );
 
-    mAmesosSolver = tAmesosFactory.Create( tSolverType, mEpetraProblem );
-
-    MORIS_ERROR( mAmesosSolver,
-            "Linear_Solver_Amesos::solve_linear_system - solver not implemented" );
+    // keep factorization of previous solve if the matrix has not changed since
+    bool tReuseFactorization = aLinearSystem->get_reuse_preconditioner() && mAmesosSolver != nullptr;
 
     sint error = 0;
 
@@ -145,24 +144,41 @@ Linear_Solver_Amesos::solve_linear_system(
     moris::real startSymFactTime = 0.0;
     moris::real startNumFactTime = 0.0;
 
-    // Set all Aztec options
-    this->set_solver_internal_parameters();
-
     // Get timing info
     Teuchos::ParameterList timingsList;
 
-    // Perform symbolic factorization
-    //    if ( !mParameterList.get< bool >( "symbolic_factorization" ) || !mIsPastFirstSolve )
-    //    {
-    // FIXME Symbilic factorization only if matrix graph changes
-    error = mAmesosSolver->SymbolicFactorization();
+    if ( tReuseFactorization )
+    {
+        MORIS_LOG_INFO( "Reusing factorization of previous solve" );
+    }
+    else
+    {
+        // delete solver kept from previous solve
+        delete mAmesosSolver;
 
-    MORIS_ERROR( error == 0, "SYMBOLIC FACTORIZATION in Linear Solver Trilinos Amesos returned an error %i. Exiting linear solve", error );
-    //    }
+        Amesos tAmesosFactory;
 
-    // Perform numeric factorization // FIXME only if values of matrix change
-    error = mAmesosSolver->NumericFactorization();
-    MORIS_ERROR( error == 0, "NUMERIC FACTORIZATION in Linear Solver Trilinos Amesos returned an error %i. Exiting linear solve", error );
+        mAmesosSolver = tAmesosFactory.Create( tSolverType, mEpetraProblem );
+
+        MORIS_ERROR( mAmesosSolver,
+                "Linear_Solver_Amesos::solve_linear_system - solver not implemented" );
+
+        // Set all Aztec options
+        this->set_solver_internal_parameters();
+
+        // Perform symbolic factorization
+        //    if ( !mParameterList.get< bool >( "symbolic_factorization" ) || !mIsPastFirstSolve )
+        //    {
+        // FIXME Symbilic factorization only if matrix graph changes
+        error = mAmesosSolver->SymbolicFactorization();
+
+        MORIS_ERROR( error == 0, "SYMBOLIC FACTORIZATION in Linear Solver Trilinos Amesos returned an error %i. Exiting linear solve", error );
+        //    }
+
+        // Perform numeric factorization
+        error = mAmesosSolver->NumericFactorization();
+        MORIS_ERROR( error == 0, "NUMERIC FACTORIZATION in Linear Solver Trilinos Amesos returned an error %i. Exiting linear solve", error );
+    }
 
     // Solve linear system
     error = mAmesosSolver->Solve();
@@ -202,8 +218,12 @@ Linear_Solver_Amesos::solve_linear_system(
     mSymFactTime = endSymFactTime - startSymFactTime;
     mNumFactTime = endNumFactTime - startNumFactTime;
 
-    delete mAmesosSolver;
-    mAmesosSolver = nullptr;
+    // keep solver and its factorization if it may be reused in the next solve
+    if ( !aLinearSystem->get_keep_preconditioner() )
+    {
+        delete mAmesosSolver;
+        mAmesosSolver = nullptr;
+    }
 
     return error;
 }
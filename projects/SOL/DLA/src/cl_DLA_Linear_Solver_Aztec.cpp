@@ -51,7 +51,7 @@ Linear_Solver_Aztec::Linear_Solver_Aztec( Linear_Problem* aLinearSystem )
     mLinearSystem = aLinearSystem;
 
     // Set matrix. solution vector and RHS
-    mEpetraProblem.SetOperator( mLinearSystem->get_matrix()->get_matrix() );
+    mEpetraProblem.SetOperator( mLinearSystem->get_matrix()->get_operator() );
 
     mEpetraProblem.SetRHS( static_cast< Vector_Epetra* >(
             mLinearSystem->get_solver_RHS() )
@@ -165,7 +165,7 @@ Linear_Solver_Aztec::solve_linear_system(
     mLinearSystem = aLinearSystem;
 
     // Set matrix in linear system
-    mEpetraProblem.SetOperator( mLinearSystem->get_matrix()->get_matrix() );
+    mEpetraProblem.SetOperator( mLinearSystem->get_matrix()->get_operator() );
 
     // Get LHS and RHS vectors
     sol::Dist_Vector* tRHS = mLinearSystem->get_solver_RHS();
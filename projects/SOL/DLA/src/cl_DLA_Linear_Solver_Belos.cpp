@@ -94,19 +94,19 @@ Linear_Solver_Belos::solve_linear_system(
     mLinearSystem = aLinearSystem;
 
     // initialize, build and set preconditioner
-    Preconditioner_Trilinos tPreconditioner( mParameterList, mLinearSystem );
+    mPreconditioner.initialize( mParameterList, mLinearSystem );
 
-    tPreconditioner.build();
+    mPreconditioner.build();
 
-    MORIS_ERROR( tPreconditioner.exists(),
+    MORIS_ERROR( mPreconditioner.exists(),
             "Linear_Solver_Belos::solve_linear_system - No preconditioner has been defined.\n" );
 
     RCP< Belos::EpetraPrecOp > belosPrec =
-            rcp( new Belos::EpetraPrecOp( tPreconditioner.get_operator() ) );
+            rcp( new Belos::EpetraPrecOp( mPreconditioner.get_operator() ) );
 
     // get operator, solution and Rhs vectors
-    RCP< Epetra_CrsMatrix > A =
-            rcp( dynamic_cast< Epetra_CrsMatrix* >( aLinearSystem->get_matrix()->get_matrix() ), false );
+    RCP< Epetra_Operator > A =
+            rcp( aLinearSystem->get_matrix()->get_operator(), false );
     RCP< Epetra_MultiVector > X =
             rcp( dynamic_cast< Vector_Epetra* >( aLinearSystem->get_free_solver_LHS() )->get_epetra_vector(), false );
     RCP< Epetra_MultiVector > B =
@@ -15,6 +15,7 @@
 #include "Epetra_ConfigDefs.h"
 
 #include "cl_DLA_Linear_Solver_Algorithm.hpp"
+#include "cl_DLA_Preconditioner_Trilinos.hpp"
 
 #include "BelosConfigDefs.hpp"
 #include "BelosLinearProblem.hpp"
@@ -35,6 +36,9 @@ private:
 
     Teuchos::RCP< Teuchos::ParameterList > mMyPl;
 
+    // preconditioner, kept between solves such that it can be reused
+    Preconditioner_Trilinos mPreconditioner;
+
 protected:
 public:
     Linear_Solver_Belos();
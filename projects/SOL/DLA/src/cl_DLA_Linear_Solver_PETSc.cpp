@@ -103,6 +103,12 @@ Linear_Solver_PETSc::set_solver_parameters()
 
     // Set multigrid levels
     mParameterList.insert( "ouput_eigenspectrum", (uint)0 );
+
+    // dof types of the blocks for PCType fieldsplit, blocks are separated by ';'
+    mParameterList.insert( "field_split_blocks", "" );
+
+    // field split type for PCType fieldsplit: additive, multiplicative, schur
+    mParameterList.insert( "field_split_type", "multiplicative" );
 }
 
 //----------------------------------------------------------------------------------------
@@ -122,19 +128,31 @@ Linear_Solver_PETSc::solve_linear_system(
 {
     Tracer tTracer( "LinearSolver", "PETSc", "Solve" );
 
-    // Create KSP
-    KSPCreate( PETSC_COMM_WORLD, &mPetscKSPProblem );
-
-    // Set matrices for linear system and for preconditioner
-    KSPSetOperators( mPetscKSPProblem,
-            aLinearSystem->get_matrix()->get_petsc_matrix(),
-            aLinearSystem->get_matrix()->get_petsc_matrix() );
-
     // set solver interface (used by preconditioners)
     mSolverInterface = aLinearSystem->get_solver_input();
 
-    // construct solver and preconditioner
-    this->construct_solver_and_preconditioner( aLinearSystem );
+    // keep solver and preconditioner of previous solve if the matrix has not changed since
+    if ( aLinearSystem->get_reuse_preconditioner() && mIsKSPSetUp )
+    {
+        MORIS_LOG_INFO( "Reusing preconditioner of previous solve" );
+
+        KSPSetReusePreconditioner( mPetscKSPProblem, PETSC_TRUE );
+    }
+    else
+    {
+        // Create KSP
+        KSPCreate( PETSC_COMM_WORLD, &mPetscKSPProblem );
+
+        // Set matrices for linear system and for preconditioner
+        KSPSetOperators( mPetscKSPProblem,
+                aLinearSystem->get_matrix()->get_petsc_matrix(),
+                aLinearSystem->get_matrix()->get_petsc_matrix() );
+
+        // construct solver and preconditioner
+        this->construct_solver_and_preconditioner( aLinearSystem );
+
+        mIsKSPSetUp = true;
+    }
 
     // for debugging: print matrix, rhs, and lhs
     // MatView( aLinearSystem->get_matrix()->get_petsc_matrix(), PETSC_VIEWER_STDOUT_WORLD );
@@ -312,6 +330,10 @@ Linear_Solver_PETSc::construct_solver_and_preconditioner( Linear_Problem *aLinea
                     aLinearSystem->get_matrix()->get_petsc_matrix(),
                     tPreconditioner.get_preconditioner_matrix()->get_petsc_matrix() );
         }
+        else if ( !strcmp( mParameterList.get< std::string >( "PCType" ).c_str(), "fieldsplit" ) )
+        {
+            tPreconditioner.build_field_split_preconditioner( aLinearSystem );
+        }
         else if ( !strcmp( mParameterList.get< std::string >( "PCType" ).c_str(), "none" ) )
         {
             // Set PC type to none
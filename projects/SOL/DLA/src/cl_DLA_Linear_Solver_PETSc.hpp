@@ -34,6 +34,9 @@ namespace moris
 
             PC mpc;
 
+            // flag whether mPetscKSPProblem has been set up in a previous solve
+            bool mIsKSPSetUp = false;
+
             moris::Cell< KSP > tKSPBlock;
 
             friend class Preconditioner_PETSc;
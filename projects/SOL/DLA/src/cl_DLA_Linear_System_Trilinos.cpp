@@ -115,8 +115,15 @@ Linear_System_Trilinos::Linear_System_Trilinos(
 
     aFreeMap->build_dof_translator( aInput->get_my_local_global_overlapping_map(), false );
 
-    // Build matrix
-    mMat = tMatFactory.create_matrix( aInput, aFreeMap, true, true );
+    // Build matrix or matrix-free operator
+    if ( mSolverWarehouse->get_matrix_free() )
+    {
+        mMat = tMatFactory.create_matrix_free_operator( aInput, aFreeMap, true );
+    }
+    else
+    {
+        mMat = tMatFactory.create_matrix( aInput, aFreeMap, true, true );
+    }
 
     if ( !mSolverWarehouse->get_output_to_matlab_string().empty() || !mSolverWarehouse->get_RHS_mat_type().empty() )
     {
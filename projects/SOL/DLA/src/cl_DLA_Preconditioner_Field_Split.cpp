@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_DLA_Preconditioner_Field_Split.cpp
+ *
+ */
+
+#include "cl_DLA_Preconditioner_Field_Split.hpp"
+
+#include "cl_Logger.hpp"
+
+#include "Epetra_MultiVector.h"
+
+#include "Ifpack.h"
+
+using namespace moris;
+using namespace dla;
+
+//-------------------------------------------------------------------------------
+
+Preconditioner_Field_Split::Preconditioner_Field_Split(
+        const Epetra_CrsMatrix*                aMatrix,
+        const moris::Cell< Matrix< DDSMat > >& aBlockRowIds,
+        const std::string&                     aSplitType,
+        const std::string&                     aBlockPrecType,
+        Teuchos::ParameterList&                aBlockPrecParameters,
+        const sint                             aOverlapLevel )
+        : mBlockMatrix( aMatrix, aBlockRowIds )
+        , mSplitType( aSplitType )
+{
+    using Teuchos::rcp;
+
+    uint tNumBlocks = mBlockMatrix.get_num_blocks();
+
+    MORIS_ERROR( tNumBlocks > 1,
+            "Preconditioner_Field_Split::Preconditioner_Field_Split - at least two blocks need to be defined." );
+
+    MORIS_ERROR( mSplitType == "additive" || mSplitType == "multiplicative" || mSplitType == "schur",
+            "Preconditioner_Field_Split::Preconditioner_Field_Split - field split type %s not implemented.",
+            mSplitType.c_str() );
+
+    MORIS_ERROR( mSplitType != "schur" || tNumBlocks == 2,
+            "Preconditioner_Field_Split::Preconditioner_Field_Split - schur field split requires two blocks." );
+
+    // extract diagonal blocks, the Schur complement replaces the second block
+    mDiagonalBlocks.resize( tNumBlocks );
+
+    for ( uint iBlock = 0; iBlock < tNumBlocks; iBlock++ )
+    {
+        if ( mSplitType == "schur" && iBlock == 1 )
+        {
+            mDiagonalBlocks( iBlock ) = rcp( mBlockMatrix.build_approximate_schur_complement() );
+        }
+        else
+        {
+            mDiagonalBlocks( iBlock ) = rcp( mBlockMatrix.extract_block( iBlock, iBlock ) );
+        }
+    }
+
+    // extract off-diagonal blocks used in the split
+    mOffDiagonalBlocks.resize( tNumBlocks, moris::Cell< Teuchos::RCP< Epetra_CrsMatrix > >( tNumBlocks ) );
+
+    if ( mSplitType == "multiplicative" )
+    {
+        for ( uint iRow = 1; iRow < tNumBlocks; iRow++ )
+        {
+            for ( uint iCol = 0; iCol < iRow; iCol++ )
+            {
+                mOffDiagonalBlocks( iRow )( iCol ) = rcp( mBlockMatrix.extract_block( iRow, iCol ) );
+            }
+        }
+    }
+    else if ( mSplitType == "schur" )
+    {
+        mOffDiagonalBlocks( 1 )( 0 ) = rcp( mBlockMatrix.extract_block( 1, 0 ) );
+        mOffDiagonalBlocks( 0 )( 1 ) = rcp( mBlockMatrix.extract_block( 0, 1 ) );
+    }
+
+    // build and compute block preconditioners
+    Ifpack tFactory;
+
+    mBlockPreconditioners.resize( tNumBlocks );
+
+    for ( uint iBlock = 0; iBlock < tNumBlocks; iBlock++ )
+    {
+        mBlockPreconditioners( iBlock ) = rcp( tFactory.Create( aBlockPrecType, mDiagonalBlocks( iBlock ).get(), aOverlapLevel ) );
+
+        MORIS_ERROR( !mBlockPreconditioners( iBlock ).is_null(),
+                "Preconditioner_Field_Split::Preconditioner_Field_Split - Ifpack preconditioner type %s not supported.",
+                aBlockPrecType.c_str() );
+
+        MORIS_ERROR( mBlockPreconditioners( iBlock )->SetParameters( aBlockPrecParameters ) == 0,
+                "Preconditioner_Field_Split::Preconditioner_Field_Split - setting parameters of block %d failed.",
+                iBlock );
+
+        MORIS_ERROR( mBlockPreconditioners( iBlock )->Initialize() == 0,
+                "Preconditioner_Field_Split::Preconditioner_Field_Split - initializing preconditioner of block %d failed.",
+                iBlock );
+
+        MORIS_ERROR( mBlockPreconditioners( iBlock )->Compute() == 0,
+                "Preconditioner_Field_Split::Preconditioner_Field_Split - computing preconditioner of block %d failed.",
+                iBlock );
+    }
+}
+
+//-------------------------------------------------------------------------------
+
+void
+Preconditioner_Field_Split::subtract_off_diagonal_product(
+        const uint                aRowBlock,
+        const uint                aColBlock,
+        const Epetra_MultiVector& aX,
+        Epetra_MultiVector&       aResidual ) const
+{
+    Epetra_MultiVector tProduct( mBlockMatrix.get_block_map( aRowBlock ), aX.NumVectors() );
+
+    mOffDiagonalBlocks( aRowBlock )( aColBlock )->Multiply( false, aX, tProduct );
+
+    aResidual.Update( -1.0, tProduct, 1.0 );
+}
+
+//-------------------------------------------------------------------------------
+
+int
+Preconditioner_Field_Split::ApplyInverse(
+        const Epetra_MultiVector& aX,
+        Epetra_MultiVector&       aY ) const
+{
+    uint tNumBlocks  = mBlockMatrix.get_num_blocks();
+    int  tNumVectors = aX.NumVectors();
+
+    // split input vector into blocks before writing aY as both can be the same vector
+    moris::Cell< Teuchos::RCP< Epetra_MultiVector > > tX( tNumBlocks );
+    moris::Cell< Teuchos::RCP< Epetra_MultiVector > > tY( tNumBlocks );
+
+    for ( uint iBlock = 0; iBlock < tNumBlocks; iBlock++ )
+    {
+        tX( iBlock ) = Teuchos::rcp( new Epetra_MultiVector( mBlockMatrix.get_block_map( iBlock ), tNumVectors ) );
+        tY( iBlock ) = Teuchos::rcp( new Epetra_MultiVector( mBlockMatrix.get_block_map( iBlock ), tNumVectors ) );
+
+        mBlockMatrix.extract_block_vector( aX, iBlock, *tX( iBlock ) );
+    }
+
+    if ( mSplitType == "additive" )
+    {
+        // y_i = P_i^-1 x_i
+        for ( uint iBlock = 0; iBlock < tNumBlocks; iBlock++ )
+        {
+            mBlockPreconditioners( iBlock )->ApplyInverse( *tX( iBlock ), *tY( iBlock ) );
+        }
+    }
+    else if ( mSplitType == "multiplicative" )
+    {
+        // forward substitution y_i = P_i^-1 ( x_i - sum_j<i A_ij y_j )
+        for ( uint iBlock = 0; iBlock < tNumBlocks; iBlock++ )
+        {
+            for ( uint iCol = 0; iCol < iBlock; iCol++ )
+            {
+                this->subtract_off_diagonal_product( iBlock, iCol, *tY( iCol ), *tX( iBlock ) );
+            }
+
+            mBlockPreconditioners( iBlock )->ApplyInverse( *tX( iBlock ), *tY( iBlock ) );
+        }
+    }
+    else
+    {
+        // lower block: y_0 = P_0^-1 x_0, y_1 = S^-1 ( x_1 - A_10 y_0 )
+        Epetra_MultiVector tResidual( *tX( 0 ) );
+
+        mBlockPreconditioners( 0 )->ApplyInverse( *tX( 0 ), *tY( 0 ) );
+
+        this->subtract_off_diagonal_product( 1, 0, *tY( 0 ), *tX( 1 ) );
+
+        mBlockPreconditioners( 1 )->ApplyInverse( *tX( 1 ), *tY( 1 ) );
+
+        // upper block: y_0 = P_0^-1 ( x_0 - A_01 y_1 )
+        this->subtract_off_diagonal_product( 0, 1, *tY( 1 ), tResidual );
+
+        mBlockPreconditioners( 0 )->ApplyInverse( tResidual, *tY( 0 ) );
+    }
+
+    for ( uint iBlock = 0; iBlock < tNumBlocks; iBlock++ )
+    {
+        mBlockMatrix.insert_block_vector( *tY( iBlock ), iBlock, aY );
+    }
+
+    return 0;
+}
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_DLA_Preconditioner_Field_Split.hpp
+ *
+ */
+
+#ifndef SRC_DISTLINALG_CL_DLA_PRECONDITIONER_FIELD_SPLIT_HPP_
+#define SRC_DISTLINALG_CL_DLA_PRECONDITIONER_FIELD_SPLIT_HPP_
+
+#include "cl_Block_Matrix_Epetra.hpp"
+
+// TPL header files
+#include "Epetra_Operator.h"
+
+#include "Teuchos_ParameterList.hpp"
+
+#include "Ifpack_Preconditioner.h"
+
+namespace moris
+{
+    namespace dla
+    {
+        /**
+         * Field-split preconditioner for block structured (multi-physics) matrices. The diagonal blocks
+         * are approximately inverted by Ifpack preconditioners and combined by one of the split types
+         *
+         *   additive:       block Jacobi
+         *   multiplicative: block Gauss-Seidel with the lower triangular block matrix
+         *   schur:          block LDU factorization of a two block matrix using the approximate Schur
+         *                   complement S = A_11 - A_10 diag(A_00)^-1 A_01 for the second block
+         */
+        class Preconditioner_Field_Split : public Epetra_Operator
+        {
+          private:
+            // block view of the monolithic matrix
+            Block_Matrix_Epetra mBlockMatrix;
+
+            // additive, multiplicative or schur
+            std::string mSplitType;
+
+            // diagonal blocks, the last one is replaced by the Schur complement for the schur split type
+            moris::Cell< Teuchos::RCP< Epetra_CrsMatrix > > mDiagonalBlocks;
+
+            // preconditioners of the diagonal blocks
+            moris::Cell< Teuchos::RCP< Ifpack_Preconditioner > > mBlockPreconditioners;
+
+            // off-diagonal blocks A_ij used in the split, null if not needed
+            moris::Cell< moris::Cell< Teuchos::RCP< Epetra_CrsMatrix > > > mOffDiagonalBlocks;
+
+            //-------------------------------------------------------------------------------
+
+            /*
+             * computes Y_i = A_ij X_j and subtracts it from aResidual
+             */
+            void subtract_off_diagonal_product(
+                    const uint                aRowBlock,
+                    const uint                aColBlock,
+                    const Epetra_MultiVector& aX,
+                    Epetra_MultiVector&       aResidual ) const;
+
+            //-------------------------------------------------------------------------------
+
+          public:
+            //-------------------------------------------------------------------------------
+
+            /*
+             * builds and computes the block preconditioners
+             *
+             * @param[in] aMatrix         assembled monolithic matrix
+             * @param[in] aBlockRowIds    global row ids owned by this processor, one list per block
+             * @param[in] aSplitType      additive, multiplicative or schur
+             * @param[in] aBlockPrecType  Ifpack preconditioner type used for the diagonal blocks
+             * @param[in] aBlockPrecParameters  Ifpack parameters of the block preconditioners
+             * @param[in] aOverlapLevel   overlap across processors of the block preconditioners
+             */
+            Preconditioner_Field_Split(
+                    const Epetra_CrsMatrix*                aMatrix,
+                    const moris::Cell< Matrix< DDSMat > >& aBlockRowIds,
+                    const std::string&                     aSplitType,
+                    const std::string&                     aBlockPrecType,
+                    Teuchos::ParameterList&                aBlockPrecParameters,
+                    const sint                             aOverlapLevel );
+
+            //-------------------------------------------------------------------------------
+
+            ~Preconditioner_Field_Split(){};
+
+            //-------------------------------------------------------------------------------
+
+            int
+            SetUseTranspose( bool aUseTranspose )
+            {
+                return aUseTranspose ? -1 : 0;
+            }
+
+            //-------------------------------------------------------------------------------
+
+            int
+            Apply(
+                    const Epetra_MultiVector& aX,
+                    Epetra_MultiVector&       aY ) const
+            {
+                return -1;
+            }
+
+            //-------------------------------------------------------------------------------
+
+            int ApplyInverse(
+                    const Epetra_MultiVector& aX,
+                    Epetra_MultiVector&       aY ) const;
+
+            //-------------------------------------------------------------------------------
+
+            double
+            NormInf() const
+            {
+                return 0.0;
+            }
+
+            //-------------------------------------------------------------------------------
+
+            const char*
+            Label() const
+            {
+                return "Preconditioner_Field_Split";
+            }
+
+            //-------------------------------------------------------------------------------
+
+            bool
+            UseTranspose() const
+            {
+                return false;
+            }
+
+            //-------------------------------------------------------------------------------
+
+            bool
+            HasNormInf() const
+            {
+                return false;
+            }
+
+            //-------------------------------------------------------------------------------
+
+            const Epetra_Comm&
+            Comm() const
+            {
+                return mBlockMatrix.get_matrix().Comm();
+            }
+
+            //-------------------------------------------------------------------------------
+
+            const Epetra_Map&
+            OperatorDomainMap() const
+            {
+                return mBlockMatrix.get_matrix().OperatorDomainMap();
+            }
+
+            //-------------------------------------------------------------------------------
+
+            const Epetra_Map&
+            OperatorRangeMap() const
+            {
+                return mBlockMatrix.get_matrix().OperatorRangeMap();
+            }
+        };
+    }    // namespace dla
+}    // namespace moris
+
+#endif /* SRC_DISTLINALG_CL_DLA_PRECONDITIONER_FIELD_SPLIT_HPP_ */
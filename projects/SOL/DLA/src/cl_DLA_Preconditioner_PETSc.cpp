@@ -11,6 +11,10 @@
 #include "cl_DLA_Preconditioner_PETSc.hpp"
 #include "cl_DLA_Linear_Solver_PETSc.hpp"
 #include "cl_SOL_Matrix_Vector_Factory.hpp"
+#include "cl_DLA_Linear_Problem.hpp"
+#include "cl_DLA_Solver_Interface.hpp"
+#include "cl_MSI_Dof_Type_Enums.hpp"
+#include "fn_Parsing_Tools.hpp"
 
 #include "fn_inv.hpp"
 
@@ -532,3 +536,84 @@ Preconditioner_PETSc::build_schwarz_preconditioner( Linear_Problem *aLinearSyste
 
     mPreconMat->matrix_global_assembly();
 }
+
+//----------------------------------------------------------------------------------------
+
+void
+Preconditioner_PETSc::build_field_split_preconditioner( Linear_Problem *aLinearSystem )
+{
+    // get dof types of blocks
+    moris::Cell< moris::Cell< enum MSI::Dof_Type > > tBlockDofTypes;
+
+    string_to_cell_of_cell(
+            mLinearSolverAlgorithm->mParameterList.get< std::string >( "field_split_blocks" ),
+            tBlockDofTypes,
+            MSI::get_msi_dof_type_map() );
+
+    MORIS_ERROR( tBlockDofTypes.size() > 1,
+            "Preconditioner_PETSc::build_field_split_preconditioner - at least two blocks need to be defined." );
+
+    std::string tSplitType = mLinearSolverAlgorithm->mParameterList.get< std::string >( "field_split_type" );
+
+    // write preconditioner to log file
+    MORIS_LOG_INFO( "KSP Preconditioner: fieldsplit(%s) with %d blocks", tSplitType.c_str(), (sint)tBlockDofTypes.size() );
+
+    // Set PC type
+    PCSetType( mLinearSolverAlgorithm->mpc, PCFIELDSPLIT );
+
+    // Set operators
+    PCSetOperators(
+            mLinearSolverAlgorithm->mpc,
+            aLinearSystem->get_matrix()->get_petsc_matrix(),
+            aLinearSystem->get_matrix()->get_petsc_matrix() );
+
+    // define blocks by index sets of owned petsc row ids
+    for ( moris::uint Ik = 0; Ik < tBlockDofTypes.size(); Ik++ )
+    {
+        Matrix< DDSMat > tDofIds =
+                mLinearSolverAlgorithm->mSolverInterface->get_my_local_global_map( tBlockDofTypes( Ik ) );
+
+        Matrix< DDSMat > tRowIds;
+        aLinearSystem->get_matrix()->translate_ids_to_row_ids( tDofIds, tRowIds );
+
+        IS tBlockIS;
+        ISCreateGeneral( PETSC_COMM_WORLD, tRowIds.numel(), tRowIds.data(), PETSC_COPY_VALUES, &tBlockIS );
+
+        PCFieldSplitSetIS( mLinearSolverAlgorithm->mpc, std::to_string( Ik ).c_str(), tBlockIS );
+
+        ISDestroy( &tBlockIS );
+    }
+
+    // set type of split
+    if ( tSplitType == "additive" )
+    {
+        PCFieldSplitSetType( mLinearSolverAlgorithm->mpc, PC_COMPOSITE_ADDITIVE );
+    }
+    else if ( tSplitType == "multiplicative" )
+    {
+        PCFieldSplitSetType( mLinearSolverAlgorithm->mpc, PC_COMPOSITE_MULTIPLICATIVE );
+    }
+    else if ( tSplitType == "schur" )
+    {
+        MORIS_ERROR( tBlockDofTypes.size() == 2,
+                "Preconditioner_PETSc::build_field_split_preconditioner - schur field split requires two blocks." );
+
+        PCFieldSplitSetType( mLinearSolverAlgorithm->mpc, PC_COMPOSITE_SCHUR );
+
+        // full block factorization, Schur complement preconditioned with A_11 - A_10 diag(A_00)^-1 A_01
+        PCFieldSplitSetSchurFactType( mLinearSolverAlgorithm->mpc, PC_FIELDSPLIT_SCHUR_FACT_FULL );
+        PCFieldSplitSetSchurPre( mLinearSolverAlgorithm->mpc, PC_FIELDSPLIT_SCHUR_PRE_SELFP, NULL );
+    }
+    else
+    {
+        MORIS_ERROR( false,
+                "Preconditioner_PETSc::build_field_split_preconditioner - field split type %s not implemented.",
+                tSplitType.c_str() );
+    }
+
+    // Set preconditioner options from the options database
+    PCSetFromOptions( mLinearSolverAlgorithm->mpc );
+
+    // Finalize setup of preconditioner
+    PCSetUp( mLinearSolverAlgorithm->mpc );
+}
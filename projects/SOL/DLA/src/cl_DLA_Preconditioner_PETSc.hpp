@@ -71,6 +71,12 @@ namespace moris
             void build_schwarz_preconditioner_petsc();
 
             void build_schwarz_preconditioner( Linear_Problem* aLinearSystem );
+
+            /**
+             * builds a PCFIELDSPLIT preconditioner with one block per group of dof types listed in
+             * "field_split_blocks"; the block solvers can be set through the PETSc options database
+             */
+            void build_field_split_preconditioner( Linear_Problem* aLinearSystem );
         };
     }    // namespace dla
 }    // namespace moris
@@ -9,13 +9,22 @@
  */
 
 #include "cl_DLA_Preconditioner_Trilinos.hpp"
+#include "cl_DLA_Preconditioner_Field_Split.hpp"
 #include "cl_DLA_Linear_Problem.hpp"
+#include "cl_DLA_Solver_Interface.hpp"
 #include "cl_SOL_Dist_Vector.hpp"
 #include "cl_SOL_Dist_Matrix.hpp"
+#include "cl_SOL_Matrix_Vector_Factory.hpp"
+#include "cl_Vector_Epetra.hpp"
 
 #include "cl_Stopwatch.hpp"
+#include "fn_Parsing_Tools.hpp"
+#include "cl_MSI_Dof_Type_Enums.hpp"
+
+#include <memory>
 
 #include <Epetra_MultiVector.h>
+#include <Epetra_Vector.h>
 #include <Epetra_Operator.h>
 
 #include "Teuchos_ParameterList.hpp"
@@ -27,12 +36,146 @@
 #include "Ifpack_ILU.h"
 #include "Ifpack_Amesos.h"
 #include "Ifpack_LocalFilter.h"
+#include "Ifpack_Chebyshev.h"
 
 #include "Ifpack_AdditiveSchwarz.h"
 
 using namespace moris;
 using namespace dla;
 
+namespace
+{
+    //-------------------------------------------------------------------------------
+
+    /*
+     * Jacobi preconditioner, ApplyInverse() scales a vector with the inverse diagonal
+     */
+    class Jacobi_Operator : public Epetra_Operator
+    {
+      private:
+        Epetra_Vector mInvDiagonal;
+
+        const Epetra_Operator* mOperator;
+
+      public:
+        Jacobi_Operator(
+                const Epetra_Vector&   aInvDiagonal,
+                const Epetra_Operator* aOperator )
+                : mInvDiagonal( aInvDiagonal )
+                , mOperator( aOperator )
+        {
+        }
+
+        int
+        SetUseTranspose( bool aUseTranspose )
+        {
+            // diagonal operator is symmetric
+            return 0;
+        }
+
+        int
+        Apply(
+                const Epetra_MultiVector& aX,
+                Epetra_MultiVector&       aY ) const
+        {
+            return -1;
+        }
+
+        int
+        ApplyInverse(
+                const Epetra_MultiVector& aX,
+                Epetra_MultiVector&       aY ) const
+        {
+            return aY.Multiply( 1.0, mInvDiagonal, aX, 0.0 );
+        }
+
+        double
+        NormInf() const
+        {
+            return 0.0;
+        }
+
+        const char*
+        Label() const
+        {
+            return "Jacobi_Operator";
+        }
+
+        bool
+        UseTranspose() const
+        {
+            return false;
+        }
+
+        bool
+        HasNormInf() const
+        {
+            return false;
+        }
+
+        const Epetra_Comm&
+        Comm() const
+        {
+            return mInvDiagonal.Comm();
+        }
+
+        const Epetra_Map&
+        OperatorDomainMap() const
+        {
+            return mOperator->OperatorDomainMap();
+        }
+
+        const Epetra_Map&
+        OperatorRangeMap() const
+        {
+            return mOperator->OperatorRangeMap();
+        }
+    };
+
+    //-------------------------------------------------------------------------------
+
+    /*
+     * estimates the largest eigenvalue of the Jacobi scaled operator D^-1 A by power iterations
+     */
+    real
+    estimate_max_eigenvalue(
+            const Epetra_Operator& aOperator,
+            const Epetra_Vector&   aInvDiagonal,
+            const sint             aNumIterations )
+    {
+        Epetra_Vector tX( aOperator.OperatorDomainMap() );
+        Epetra_Vector tY( aOperator.OperatorRangeMap() );
+
+        tX.Random();
+
+        real tLambda = 0.0;
+
+        for ( sint Ik = 0; Ik < aNumIterations; Ik++ )
+        {
+            real tNorm = 0.0;
+            tX.Norm2( &tNorm );
+
+            if ( tNorm == 0.0 )
+            {
+                break;
+            }
+
+            tX.Scale( 1.0 / tNorm );
+
+            aOperator.Apply( tX, tY );
+
+            tY.Multiply( 1.0, aInvDiagonal, tY, 0.0 );
+
+            // Rayleigh quotient of normalized vector
+            tX.Dot( tY, &tLambda );
+
+            tX.Update( 1.0, tY, 0.0 );
+        }
+
+        return tLambda;
+    }
+}    // namespace
+
 //-------------------------------------------------------------------------------
 
 Preconditioner_Trilinos::Preconditioner_Trilinos()
@@ -71,7 +214,10 @@ void Preconditioner_Trilinos::initialize(
     bool tIsIfpack = ! mParameterList.get< std::string >( "ifpack_prec_type" ).empty();
     bool tIsMl     = ! mParameterList.get< std::string >( "ml_prec_type" ).empty();
 
-    if ( !tIsIfpack && !tIsMl )
+    // field split uses the ifpack preconditioner type for its blocks
+    bool tIsFieldSplit = ! mParameterList.get< std::string >( "field_split_blocks" ).empty();
+
+    if ( !tIsIfpack && !tIsMl && !tIsFieldSplit )
     {
         mIsInitialized = false;
         return;
@@ -82,7 +228,7 @@ void Preconditioner_Trilinos::initialize(
     }
 
     // check that only one preconditioner is defined
-    MORIS_ERROR( ( tIsIfpack && !tIsMl ) || ( !tIsIfpack && tIsMl ),
+    MORIS_ERROR( tIsFieldSplit ? !tIsMl : ( tIsIfpack && !tIsMl ) || ( !tIsIfpack && tIsMl ),
             "Preconditioner_Trilinos::initialize - One and only one preconditioner must be specified.\n");
 
     // store linear system
@@ -103,8 +249,28 @@ void Preconditioner_Trilinos::build(const sint & aIter)
     MORIS_ERROR( mLinearSystem,
             "Preconditioner_Trilinos::build - Preconditioner has not been initialized.\n");
 
+    // keep preconditioner of previous solve if the matrix has not changed since
+    if ( mLinearSystem->get_reuse_preconditioner() && this->exists() )
+    {
+        MORIS_LOG_INFO( "Reusing preconditioner of previous solve" );
+
+        return;
+    }
+
+    // build field-split preconditioner, block structure and blocks are rebuilt with the matrix
+    if( ! mParameterList.get< std::string >( "field_split_blocks" ).empty() )
+    {
+        this->build_field_split_preconditioner();
+    }
+    // build preconditioner from matrix diagonal; the diagonal is extracted in every iteration,
+    // the Chebyshev eigenvalue estimate requires operator applications and is kept if reused
+    else if( mParameterList.get< std::string >( "ifpack_prec_type" ) == "Jacobi" ||
+            mParameterList.get< std::string >( "ifpack_prec_type" ) == "Chebyshev" )
+    {
+        this->build_diagonal_preconditioner( aIter > 1 && mParameterList.get< bool >( "prec_reuse" ) );
+    }
     // build Ifpack preconditioner
-    if( ! mParameterList.get< std::string >( "ifpack_prec_type" ).empty() )
+    else if( ! mParameterList.get< std::string >( "ifpack_prec_type" ).empty() )
     {
         // initialize and build, and compute preconditioner in first iteration
         // or if preconditioner should not be reused
@@ -147,7 +313,7 @@ bool Preconditioner_Trilinos::exists()
     }
     else
     {
-        return !mIfPackPrec.is_null() || !mMlPrec.is_null();
+        return !mIfPackPrec.is_null() || !mMlPrec.is_null() || !mDiagonalPrec.is_null() || !mFieldSplitPrec.is_null();
     }
 }
 
@@ -159,7 +325,15 @@ Teuchos::RCP< Epetra_Operator > Preconditioner_Trilinos::get_operator()
             "Preconditioner_Trilinos::get_prec - no preconditioner has been built.\n");
 
     // return pointer to preconditioner
-    if ( !mIfPackPrec.is_null() )
+    if ( !mFieldSplitPrec.is_null() )
+    {
+        return mFieldSplitPrec;
+    }
+    else if ( !mDiagonalPrec.is_null() )
+    {
+        return mDiagonalPrec;
+    }
+    else if ( !mIfPackPrec.is_null() )
     {
         return mIfPackPrec;
     }
@@ -171,6 +345,103 @@ Teuchos::RCP< Epetra_Operator > Preconditioner_Trilinos::get_operator()
 
 //-------------------------------------------------------------------------------
 
+void Preconditioner_Trilinos::set_ifpack_parameters(
+        const std::string      & aPrecType,
+        Teuchos::ParameterList & aIfpackParameterlist )
+{
+    if ( aPrecType == "ILU" )
+    {
+        aIfpackParameterlist.set ( "fact: level-of-fill"     , mParameterList.get< moris::sint >( "fact: level-of-fill" ) );
+        aIfpackParameterlist.set ( "fact: absolute threshold", mParameterList.get< moris::real >( "fact: absolute threshold" ) );
+        aIfpackParameterlist.set ( "fact: relative threshold", mParameterList.get< moris::real >( "fact: relative threshold" ) );
+        aIfpackParameterlist.set ( "fact: relax value"       , mParameterList.get< moris::real >( "fact: relax value" ) );
+    }
+    else if ( aPrecType == "ILUT" )
+    {
+        aIfpackParameterlist.set ( "fact: ilut level-of-fill", mParameterList.get< moris::real >( "fact: ilut level-of-fill" ) );
+        aIfpackParameterlist.set ( "fact: absolute threshold", mParameterList.get< moris::real >( "fact: absolute threshold" ) );
+        aIfpackParameterlist.set ( "fact: relative threshold", mParameterList.get< moris::real >( "fact: relative threshold" ) );
+        aIfpackParameterlist.set ( "fact: drop tolerance"    , mParameterList.get< moris::real >( "fact: drop tolerance" ) );
+        aIfpackParameterlist.set ( "fact: relax value"       , mParameterList.get< moris::real >( "fact: relax value" )   );
+    }
+    else if ( aPrecType == "IC" )
+    {
+        aIfpackParameterlist.set ( "fact: level-of-fill",      mParameterList.get< moris::sint >( "fact: level-of-fill" ) );
+        aIfpackParameterlist.set ( "fact: absolute threshold", mParameterList.get< moris::real >( "fact: absolute threshold" ) );
+        aIfpackParameterlist.set ( "fact: relative threshold", mParameterList.get< moris::real >( "fact: relative threshold" ) );
+        aIfpackParameterlist.set ( "fact: drop tolerance"    , mParameterList.get< moris::real >( "fact: drop tolerance" ) );
+    }
+    else if ( aPrecType == "ICT" )
+    {
+        aIfpackParameterlist.set ( "fact: ict level-of-fill",  mParameterList.get< moris::real >( "fact: ict level-of-fill" ) );
+        aIfpackParameterlist.set ( "fact: absolute threshold", mParameterList.get< moris::real >( "fact: absolute threshold" ) );
+        aIfpackParameterlist.set ( "fact: relative threshold", mParameterList.get< moris::real >( "fact: relative threshold" ) );
+        aIfpackParameterlist.set ( "fact: drop tolerance"    , mParameterList.get< moris::real >( "fact: drop tolerance" ) );
+        aIfpackParameterlist.set ( "fact: relax value"       , mParameterList.get< moris::real >( "fact: relax value" ) );
+    }
+    else if ( aPrecType == "Amesos" )
+    {
+        aIfpackParameterlist.set ( "amesos: solver type", mParameterList.get< std::string > ( "amesos: solver type" ) );
+    }
+    else if ( aPrecType == "point relaxation" )
+    {
+        aIfpackParameterlist.set ( "relaxation: type"                  , mParameterList.get< std::string >( "relaxation: type" ) );
+        aIfpackParameterlist.set ( "relaxation: sweeps"                , mParameterList.get< moris::sint >( "relaxation: sweeps" ) );
+        aIfpackParameterlist.set ( "relaxation: damping factor"        , mParameterList.get< moris::real >( "relaxation: damping factor" ) );
+        aIfpackParameterlist.set ( "relaxation: zero starting solution", mParameterList.get< bool        >( "relaxation: zero starting solution" ) );
+
+        aIfpackParameterlist.set ( "relaxation: min diagonal value"    , mParameterList.get< std::string >( "relaxation: min diagonal value" ) );
+        aIfpackParameterlist.set ( "relaxation: backward mode"         , mParameterList.get< bool        >( "relaxation: backward mode" ) );
+        aIfpackParameterlist.set ( "relaxation: use l1"                , mParameterList.get< bool        >( "relaxation: use l1" ) );
+        aIfpackParameterlist.set ( "relaxation: l1 eta"                , mParameterList.get< moris::real >( "relaxation: l1 eta") );
+    }
+    else if ( aPrecType == "block relaxation" )
+    {
+        aIfpackParameterlist.set ( "relaxation: type"                  , mParameterList.get< std::string >( "relaxation: type" ) );
+        aIfpackParameterlist.set ( "relaxation: sweeps"                , mParameterList.get< moris::sint >( "relaxation: sweeps" ) );
+        aIfpackParameterlist.set ( "relaxation: damping factor"        , mParameterList.get< moris::real >( "relaxation: damping factor" ) );
+        aIfpackParameterlist.set ( "relaxation: zero starting solution", mParameterList.get< bool        >( "relaxation: zero starting solution" ) );
+
+        aIfpackParameterlist.set ( "partitioner: type"                 , mParameterList.get< std::string >( "partitioner: type" ) );
+        aIfpackParameterlist.set ( "partitioner: overlap"              , mParameterList.get< moris::sint >( "partitioner: overlap" ) );
+        aIfpackParameterlist.set ( "partitioner: local parts"          , mParameterList.get< moris::sint >( "partitioner: local parts" ) );
+        aIfpackParameterlist.set ( "partitioner: print level"          , mParameterList.get< moris::sint >( "partitioner: print level" ) );
+        aIfpackParameterlist.set ( "partitioner: use symmetric graph"  , mParameterList.get< bool        >( "partitioner: use symmetric graph" ) );
+    }
+    else if ( aPrecType == "SPARSKIT" )
+    {
+        aIfpackParameterlist.set ( "fact: sparskit: lfil"    , mParameterList.get< moris::sint >( "fact: sparskit: lfil" ) );
+        aIfpackParameterlist.set ( "fact: sparskit: tol"     , mParameterList.get< moris::real >( "fact: sparskit: tol" ) );
+        aIfpackParameterlist.set ( "fact: sparskit: droptol" , mParameterList.get< moris::real >( "fact: sparskit: droptol" ) );
+        aIfpackParameterlist.set ( "fact: sparskit: permtol" , mParameterList.get< moris::real >( "fact: sparskit: permtol" ) );
+        aIfpackParameterlist.set ( "fact: sparskit: alph"    , mParameterList.get< moris::real >( "fact: sparskit: alph" ) );
+        aIfpackParameterlist.set ( "fact: sparskit: mbloc"   , mParameterList.get< moris::sint >( "fact: sparskit: mbloc" ) );
+        aIfpackParameterlist.set ( "fact: sparskit: type"    , mParameterList.get< std::string >( "fact: sparskit: type" ) );
+    }
+    else if ( aPrecType == "Krylov" )
+    {
+        aIfpackParameterlist.set ( "krylov: iterations"             ,  mParameterList.get< moris::real >( "krylov: iterations" ) );
+        aIfpackParameterlist.set ( "krylov: tolerance"              ,  mParameterList.get< std::string >( "krylov: tolerance" ) );
+        aIfpackParameterlist.set ( "krylov: solver"                 ,  mParameterList.get< moris::sint >( "krylov: solver" ) );
+        aIfpackParameterlist.set ( "krylov: preconditioner"         ,  mParameterList.get< moris::sint >( "krylov: preconditioner" ) );
+        aIfpackParameterlist.set ( "krylov: number of sweeps"       ,  mParameterList.get< moris::sint >( "krylov: number of sweeps" ) );
+        aIfpackParameterlist.set ( "krylov: block size"             ,  mParameterList.get< moris::sint >( "krylov: block size" ) );
+        aIfpackParameterlist.set ( "krylov: damping parameter"      ,  mParameterList.get< moris::real >( "krylov: damping parameter" ) );
+        aIfpackParameterlist.set ( "krylov: zero starting solution" ,  mParameterList.get< moris::sint >( "krylov: zero starting solution" ) );
+    }
+    else
+    {
+        MORIS_ERROR( false, "Ifpack preconditioner type %s not implemented", aPrecType.c_str() );
+    }
+
+    aIfpackParameterlist.set ( "schwarz: combine mode"     , mParameterList.get< std::string >( "schwarz: combine mode" ) );
+    aIfpackParameterlist.set ( "schwarz: compute condest"  , mParameterList.get< bool        >( "schwarz: compute condest" ) );
+    aIfpackParameterlist.set ( "schwarz: filter singletons", mParameterList.get< bool        >( "schwarz: filter singletons" ) );
+    aIfpackParameterlist.set ( "schwarz: reordering type"  , mParameterList.get< std::string >( "schwarz: reordering type" ) );
+}
+
+//-------------------------------------------------------------------------------
+
 moris::sint Preconditioner_Trilinos::build_ifpack_preconditioner()
 {
     using Teuchos::RCP;
@@ -189,6 +460,9 @@ moris::sint Preconditioner_Trilinos::build_ifpack_preconditioner()
     MORIS_ERROR(mLinearSystem,
             "Preconditioner_Trilinos::build_ifpack_preconditioner - linear system not set.\n" );
 
+    MORIS_ERROR( !mLinearSystem->get_matrix()->is_matrix_free(),
+            "Preconditioner_Trilinos::build_ifpack_preconditioner - matrix-free operators only support Jacobi and Chebyshev.\n" );
+
     // Get pointer to operator
     Epetra_RowMatrix * tOperator = mLinearSystem->get_matrix()->get_matrix();
 
@@ -202,95 +476,7 @@ moris::sint Preconditioner_Trilinos::build_ifpack_preconditioner()
     mIfPackPrec = rcp ( Factory.Create ( PrecType, tOperator, OverlapLevel ) );
 
     // Specify local solver specific parameters
-    if ( PrecType == "ILU" )
-    {
-        tIfpackParameterlist.set ( "fact: level-of-fill"     , mParameterList.get< moris::sint >( "fact: level-of-fill" ) );
-        tIfpackParameterlist.set ( "fact: absolute threshold", mParameterList.get< moris::real >( "fact: absolute threshold" ) );
-        tIfpackParameterlist.set ( "fact: relative threshold", mParameterList.get< moris::real >( "fact: relative threshold" ) );
-        tIfpackParameterlist.set ( "fact: relax value"       , mParameterList.get< moris::real >( "fact: relax value" ) );
-    }
-    else if ( PrecType == "ILUT" )
-    {
-        tIfpackParameterlist.set ( "fact: ilut level-of-fill", mParameterList.get< moris::real >( "fact: ilut level-of-fill" ) );
-        tIfpackParameterlist.set ( "fact: absolute threshold", mParameterList.get< moris::real >( "fact: absolute threshold" ) );
-        tIfpackParameterlist.set ( "fact: relative threshold", mParameterList.get< moris::real >( "fact: relative threshold" ) );
-        tIfpackParameterlist.set ( "fact: drop tolerance"    , mParameterList.get< moris::real >( "fact: drop tolerance" ) );
-        tIfpackParameterlist.set ( "fact: relax value"       , mParameterList.get< moris::real >( "fact: relax value" )   );
-    }
-    else if ( PrecType == "IC" )
-    {
-        tIfpackParameterlist.set ( "fact: level-of-fill",      mParameterList.get< moris::sint >( "fact: level-of-fill" ) );
-        tIfpackParameterlist.set ( "fact: absolute threshold", mParameterList.get< moris::real >( "fact: absolute threshold" ) );
-        tIfpackParameterlist.set ( "fact: relative threshold", mParameterList.get< moris::real >( "fact: relative threshold" ) );
-        tIfpackParameterlist.set ( "fact: drop tolerance"    , mParameterList.get< moris::real >( "fact: drop tolerance" ) );
-    }
-    else if ( PrecType == "ICT" )
-    {
-        tIfpackParameterlist.set ( "fact: ict level-of-fill",  mParameterList.get< moris::real >( "fact: ict level-of-fill" ) );
-        tIfpackParameterlist.set ( "fact: absolute threshold", mParameterList.get< moris::real >( "fact: absolute threshold" ) );
-        tIfpackParameterlist.set ( "fact: relative threshold", mParameterList.get< moris::real >( "fact: relative threshold" ) );
-        tIfpackParameterlist.set ( "fact: drop tolerance"    , mParameterList.get< moris::real >( "fact: drop tolerance" ) );
-        tIfpackParameterlist.set ( "fact: relax value"       , mParameterList.get< moris::real >( "fact: relax value" ) );
-    }
-    else if ( PrecType == "Amesos" )
-    {
-        tIfpackParameterlist.set ( "amesos: solver type", mParameterList.get< std::string > ( "amesos: solver type" ) );
-    }
-    else if ( PrecType == "point relaxation" )
-    {
-        tIfpackParameterlist.set ( "relaxation: type"                  , mParameterList.get< std::string >( "relaxation: type" ) );
-        tIfpackParameterlist.set ( "relaxation: sweeps"                , mParameterList.get< moris::sint >( "relaxation: sweeps" ) );
-        tIfpackParameterlist.set ( "relaxation: damping factor"        , mParameterList.get< moris::real >( "relaxation: damping factor" ) );
-        tIfpackParameterlist.set ( "relaxation: zero starting solution", mParameterList.get< bool        >( "relaxation: zero starting solution" ) );
-
-        tIfpackParameterlist.set ( "relaxation: min diagonal value"    , mParameterList.get< std::string >( "relaxation: min diagonal value" ) );
-        tIfpackParameterlist.set ( "relaxation: backward mode"         , mParameterList.get< bool        >( "relaxation: backward mode" ) );
-        tIfpackParameterlist.set ( "relaxation: use l1"                , mParameterList.get< bool        >( "relaxation: use l1" ) );
-        tIfpackParameterlist.set ( "relaxation: l1 eta"                , mParameterList.get< moris::real >( "relaxation: l1 eta") );
-    }
-    else if ( PrecType == "block relaxation" )
-    {
-        tIfpackParameterlist.set ( "relaxation: type"                  , mParameterList.get< std::string >( "relaxation: type" ) );
-        tIfpackParameterlist.set ( "relaxation: sweeps"                , mParameterList.get< moris::sint >( "relaxation: sweeps" ) );
-        tIfpackParameterlist.set ( "relaxation: damping factor"        , mParameterList.get< moris::real >( "relaxation: damping factor" ) );
-        tIfpackParameterlist.set ( "relaxation: zero starting solution", mParameterList.get< bool        >( "relaxation: zero starting solution" ) );
-
-        tIfpackParameterlist.set ( "partitioner: type"                 , mParameterList.get< std::string >( "partitioner: type" ) );
-        tIfpackParameterlist.set ( "partitioner: overlap"              , mParameterList.get< moris::sint >( "partitioner: overlap" ) );
-        tIfpackParameterlist.set ( "partitioner: local parts"          , mParameterList.get< moris::sint >( "partitioner: local parts" ) );
-        tIfpackParameterlist.set ( "partitioner: print level"          , mParameterList.get< moris::sint >( "partitioner: print level" ) );
-        tIfpackParameterlist.set ( "partitioner: use symmetric graph"  , mParameterList.get< bool        >( "partitioner: use symmetric graph" ) );
-    }
-    else if ( PrecType == "SPARSKIT" )
-    {
-        tIfpackParameterlist.set ( "fact: sparskit: lfil"    , mParameterList.get< moris::sint >( "fact: sparskit: lfil" ) );
-        tIfpackParameterlist.set ( "fact: sparskit: tol"     , mParameterList.get< moris::real >( "fact: sparskit: tol" ) );
-        tIfpackParameterlist.set ( "fact: sparskit: droptol" , mParameterList.get< moris::real >( "fact: sparskit: droptol" ) );
-        tIfpackParameterlist.set ( "fact: sparskit: permtol" , mParameterList.get< moris::real >( "fact: sparskit: permtol" ) );
-        tIfpackParameterlist.set ( "fact: sparskit: alph"    , mParameterList.get< moris::real >( "fact: sparskit: alph" ) );
-        tIfpackParameterlist.set ( "fact: sparskit: mbloc"   , mParameterList.get< moris::sint >( "fact: sparskit: mbloc" ) );
-        tIfpackParameterlist.set ( "fact: sparskit: type"    , mParameterList.get< std::string >( "fact: sparskit: type" ) );
-    }
-    else if ( PrecType == "Krylov" )
-    {
-        tIfpackParameterlist.set ( "krylov: iterations"             ,  mParameterList.get< moris::real >( "krylov: iterations" ) );
-        tIfpackParameterlist.set ( "krylov: tolerance"              ,  mParameterList.get< std::string >( "krylov: tolerance" ) );
-        tIfpackParameterlist.set ( "krylov: solver"                 ,  mParameterList.get< moris::sint >( "krylov: solver" ) );
-        tIfpackParameterlist.set ( "krylov: preconditioner"         ,  mParameterList.get< moris::sint >( "krylov: preconditioner" ) );
-        tIfpackParameterlist.set ( "krylov: number of sweeps"       ,  mParameterList.get< moris::sint >( "krylov: number of sweeps" ) );
-        tIfpackParameterlist.set ( "krylov: block size"             ,  mParameterList.get< moris::sint >( "krylov: block size" ) );
-        tIfpackParameterlist.set ( "krylov: damping parameter"      ,  mParameterList.get< moris::real >( "krylov: damping parameter" ) );
-        tIfpackParameterlist.set ( "krylov: zero starting solution" ,  mParameterList.get< moris::sint >( "krylov: zero starting solution" ) );
-    }
-    else
-    {
-        MORIS_ERROR( false, "Ifpack preconditioner type %s not implemented", PrecType.c_str() );
-    }
-
-    tIfpackParameterlist.set ( "schwarz: combine mode"     , mParameterList.get< std::string >( "schwarz: combine mode" ) );
-    tIfpackParameterlist.set ( "schwarz: compute condest"  , mParameterList.get< bool        >( "schwarz: compute condest" ) );
-    tIfpackParameterlist.set ( "schwarz: filter singletons", mParameterList.get< bool        >( "schwarz: filter singletons" ) );
-    tIfpackParameterlist.set ( "schwarz: reordering type"  , mParameterList.get< std::string >( "schwarz: reordering type" ) );
+    this->set_ifpack_parameters( PrecType, tIfpackParameterlist );
 
     // start timer
     tic tTimer;
@@ -339,6 +525,100 @@ moris::sint Preconditioner_Trilinos::compute_ifpack_preconditioner( bool tRecomp
 
 //-------------------------------------------------------------------------------
 
+moris::sint Preconditioner_Trilinos::build_diagonal_preconditioner( bool aReuseEigenvalue )
+{
+    using Teuchos::rcp;
+
+    // check that linear system is set
+    MORIS_ERROR(mLinearSystem,
+            "Preconditioner_Trilinos::build_diagonal_preconditioner - linear system not set.\n" );
+
+    // start timer
+    tic tTimer;
+
+    sol::Dist_Matrix* tMatrix   = mLinearSystem->get_matrix();
+    Epetra_Operator*  tOperator = tMatrix->get_operator();
+
+    // extract diagonal, the matrix of the linear system is built on the point map
+    sol::Matrix_Vector_Factory tMatFactory( sol::MapType::Epetra );
+
+    std::unique_ptr< sol::Dist_Vector > tDiagonal(
+            tMatFactory.create_vector( mLinearSystem->get_solver_input(), tMatrix->get_map(), 1, true ) );
+
+    tMatrix->get_diagonal( *tDiagonal );
+
+    // invert diagonal, zero entries are not scaled
+    Epetra_Vector tInvDiagonal( *( *static_cast< Vector_Epetra* >( tDiagonal.get() )->get_epetra_vector() )( 0 ) );
+
+    for ( sint Ik = 0; Ik < tInvDiagonal.MyLength(); Ik++ )
+    {
+        tInvDiagonal[ Ik ] = tInvDiagonal[ Ik ] != 0.0 ? 1.0 / tInvDiagonal[ Ik ] : 1.0;
+    }
+
+    std::string tPrecType = mParameterList.get< std::string >( "ifpack_prec_type" );
+
+    if ( tPrecType == "Jacobi" )
+    {
+        mDiagonalPrec = rcp( new Jacobi_Operator( tInvDiagonal, tOperator ) );
+    }
+    else
+    {
+        // estimate largest eigenvalue if not provided, with safety factor; the estimate applies
+        // the operator in every power iteration and is only repeated if it cannot be reused
+        real tLambdaMax = mParameterList.get< moris::real >( "chebyshev: max eigenvalue" );
+
+        if ( tLambdaMax < 0.0 )
+        {
+            if ( !aReuseEigenvalue || mChebyshevMaxEigenvalue < 0.0 )
+            {
+                mChebyshevMaxEigenvalue = 1.1 * estimate_max_eigenvalue(
+                        *tOperator,
+                        tInvDiagonal,
+                        mParameterList.get< moris::sint >( "chebyshev: eigenvalue iterations" ) );
+            }
+            else
+            {
+                MORIS_LOG_INFO( "Reusing Chebyshev eigenvalue estimate of previous solve" );
+            }
+
+            tLambdaMax = mChebyshevMaxEigenvalue;
+        }
+
+        Teuchos::RCP< Ifpack_Chebyshev > tChebyshev = rcp( new Ifpack_Chebyshev( tOperator ) );
+
+        Teuchos::ParameterList tChebyshevParameterlist;
+
+        tChebyshevParameterlist.set( "chebyshev: degree"                , mParameterList.get< moris::sint >( "chebyshev: degree" ) );
+        tChebyshevParameterlist.set( "chebyshev: ratio eigenvalue"      , mParameterList.get< moris::real >( "chebyshev: ratio eigenvalue" ) );
+        tChebyshevParameterlist.set( "chebyshev: max eigenvalue"        , tLambdaMax );
+        tChebyshevParameterlist.set( "chebyshev: zero starting solution", true );
+        tChebyshevParameterlist.set( "chebyshev: operator inv diagonal" , &tInvDiagonal );
+
+        IFPACK_CHK_ERR( tChebyshev->SetParameters( tChebyshevParameterlist ) );
+
+        IFPACK_CHK_ERR( tChebyshev->Initialize() );
+
+        IFPACK_CHK_ERR( tChebyshev->Compute() );
+
+        mDiagonalPrec = tChebyshev;
+    }
+
+    // stop timer
+    real tElapsedTime = tTimer.toc<moris::chronos::milliseconds>().wall;
+    moris::real tElapsedTimeMax = max_all( tElapsedTime );
+
+    if ( par_rank() == 0 )
+    {
+        MORIS_LOG_INFO( "SOL: Total time to build %s preconditioner is %5.3f seconds.",
+                tPrecType.c_str(),
+                ( double ) tElapsedTimeMax / 1000);
+    }
+
+    return 0;
+}
+
+//-------------------------------------------------------------------------------
+
 moris::sint Preconditioner_Trilinos::build_ml_preconditioner()
 {
     using Teuchos::RCP;
@@ -349,6 +629,9 @@ moris::sint Preconditioner_Trilinos::build_ml_preconditioner()
     MORIS_ERROR(mLinearSystem,
             "Preconditioner_Trilinos::build_ml_preconditioner - linear system not set.\n" );
 
+    MORIS_ERROR( !mLinearSystem->get_matrix()->is_matrix_free(),
+            "Preconditioner_Trilinos::build_ml_preconditioner - ML requires an assembled matrix.\n" );
+
     // ml parameter list
     ParameterList tMlParams;
 
@@ -479,3 +762,101 @@ moris::sint Preconditioner_Trilinos::compute_ml_preconditioner( bool tRecompute
 
 //-------------------------------------------------------------------------------
 
+//-------------------------------------------------------------------------------
+
+moris::sint Preconditioner_Trilinos::build_field_split_preconditioner()
+{
+    using Teuchos::rcp;
+
+    // check that linear system is set
+    MORIS_ERROR(mLinearSystem,
+            "Preconditioner_Trilinos::build_field_split_preconditioner - linear system not set.\n" );
+
+    MORIS_ERROR( !mLinearSystem->get_matrix()->is_matrix_free(),
+            "Preconditioner_Trilinos::build_field_split_preconditioner - matrix-free operators only support Jacobi and Chebyshev.\n" );
+
+    // start timer
+    tic tTimer;
+
+    // get dof types of blocks
+    moris::Cell< moris::Cell< enum MSI::Dof_Type > > tBlockDofTypes;
+
+    string_to_cell_of_cell(
+            mParameterList.get< std::string >( "field_split_blocks" ),
+            tBlockDofTypes,
+            MSI::get_msi_dof_type_map() );
+
+    // get matrix rows of each block, skipping constrained dofs
+    sol::Dist_Matrix*  tMatrix          = mLinearSystem->get_matrix();
+    Solver_Interface*  tSolverInterface = mLinearSystem->get_solver_input();
+
+    moris::Cell< Matrix< DDSMat > > tBlockRowIds( tBlockDofTypes.size() );
+
+    uint tNumBlockRows = 0;
+
+    for ( uint iBlock = 0; iBlock < tBlockDofTypes.size(); iBlock++ )
+    {
+        Matrix< DDSMat > tDofIds = tSolverInterface->get_my_local_global_map( tBlockDofTypes( iBlock ) );
+
+        Matrix< DDSMat > tRowIds;
+        tMatrix->translate_ids_to_row_ids( tDofIds, tRowIds );
+
+        tBlockRowIds( iBlock ).set_size( tRowIds.numel(), 1 );
+
+        uint tCounter = 0;
+
+        for ( uint Ik = 0; Ik < tRowIds.numel(); Ik++ )
+        {
+            if ( tRowIds( Ik ) >= 0 )
+            {
+                tBlockRowIds( iBlock )( tCounter++ ) = tRowIds( Ik );
+            }
+        }
+
+        tBlockRowIds( iBlock ).resize( tCounter, 1 );
+
+        tNumBlockRows += tCounter;
+    }
+
+    // the blocks need to partition the matrix rows
+    MORIS_ERROR( tNumBlockRows == ( uint ) tMatrix->get_matrix()->NumMyRows(),
+            "Preconditioner_Trilinos::build_field_split_preconditioner - field_split_blocks \"%s\" assigns %d rows "
+            "to blocks but %d unconstrained rows are owned by this processor; every solved dof type needs to be "
+            "listed in exactly one block.\n",
+            mParameterList.get< std::string >( "field_split_blocks" ).c_str(),
+            ( int ) tNumBlockRows,
+            ( int ) tMatrix->get_matrix()->NumMyRows() );
+
+    // Ifpack preconditioner of the diagonal blocks, defaults to ILU
+    std::string tBlockPrecType = mParameterList.get< std::string >( "ifpack_prec_type" );
+
+    if ( tBlockPrecType.empty() )
+    {
+        tBlockPrecType = "ILU";
+    }
+
+    Teuchos::ParameterList tIfpackParameterlist;
+
+    this->set_ifpack_parameters( tBlockPrecType, tIfpackParameterlist );
+
+    mFieldSplitPrec = rcp( new Preconditioner_Field_Split(
+            tMatrix->get_matrix(),
+            tBlockRowIds,
+            mParameterList.get< std::string >( "field_split_type" ),
+            tBlockPrecType,
+            tIfpackParameterlist,
+            mParameterList.get< moris::sint >( "overlap-level" ) ) );
+
+    // stop timer
+    real tElapsedTime = tTimer.toc<moris::chronos::milliseconds>().wall;
+    moris::real tElapsedTimeMax = max_all( tElapsedTime );
+
+    if ( par_rank() == 0 )
+    {
+        MORIS_LOG_INFO( "SOL: Total time to build field-split preconditioner with %d blocks is %5.3f seconds.",
+                ( int ) tBlockDofTypes.size(),
+                ( double ) tElapsedTimeMax / 1000);
+    }
+
+    return 0;
+}
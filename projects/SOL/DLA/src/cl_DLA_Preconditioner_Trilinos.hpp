@@ -42,6 +42,15 @@ namespace moris
 
             Teuchos::RCP< ML_Epetra::MultiLevelPreconditioner > mMlPrec;
 
+            // preconditioner built from the matrix diagonal only (Jacobi, Chebyshev)
+            Teuchos::RCP< Epetra_Operator > mDiagonalPrec;
+
+            // estimated largest eigenvalue of the Jacobi scaled operator, negative if not estimated yet
+            moris::real mChebyshevMaxEigenvalue = -1.0;
+
+            // field-split preconditioner for block structured matrices
+            Teuchos::RCP< Epetra_Operator > mFieldSplitPrec;
+
             //-------------------------------------------------------------------------------
 
             moris::sint build_ifpack_preconditioner();
@@ -60,6 +69,33 @@ namespace moris
 
             //-------------------------------------------------------------------------------
 
+            /*
+             * builds a Jacobi or Chebyshev preconditioner from the diagonal of the matrix;
+             * only requires the product with the operator and can be used for matrix-free operators
+             *
+             * @param[in] aReuseEigenvalue reuse the Chebyshev eigenvalue estimate of a previous build
+             */
+            moris::sint build_diagonal_preconditioner( bool aReuseEigenvalue = false );
+
+            //-------------------------------------------------------------------------------
+
+            /*
+             * builds a field-split preconditioner with one block per group of dof types listed in
+             * "field_split_blocks"; the diagonal blocks use the Ifpack preconditioner "ifpack_prec_type"
+             */
+            moris::sint build_field_split_preconditioner();
+
+            //-------------------------------------------------------------------------------
+
+            /*
+             * sets the parameters of an Ifpack preconditioner from the parameter list
+             */
+            void set_ifpack_parameters(
+                    const std::string&      aPrecType,
+                    Teuchos::ParameterList& aIfpackParameterlist );
+
+            //-------------------------------------------------------------------------------
+
           public:
             //-------------------------------------------------------------------------------
 
@@ -12,6 +12,13 @@
 #include "cl_SOL_Dist_Matrix.hpp"
 #include "cl_SOL_Dist_Vector.hpp"
 #include "cl_SOL_Warehouse.hpp"
+#include "cl_Communication_Tools.hpp"
+
+#include <algorithm>
+
+#ifdef MORIS_USE_OPENMP
+#include <omp.h>
+#endif
 
 using namespace moris;
 
@@ -31,6 +38,16 @@ Solver_Interface::build_graph( moris::sol::Dist_Matrix* aMat, bool aUseSparsityP
         return;
     }
 
+    // reuse the graph of a previous linear system with the same dof layout on all procs,
+    // reusing and rebuilding the graph call different collectives
+    if ( mReuseMatrixGraph && all_land( this->is_matrix_graph_cache_valid() ) )
+    {
+        if ( aMat->set_graph( mCachedGraph ) )
+        {
+            return;
+        }
+    }
+
     // Get local number of elements
     moris::uint numBlocks = this->get_num_my_blocks();
 
@@ -50,6 +67,39 @@ Solver_Interface::build_graph( moris::sol::Dist_Matrix* aMat, bool aUseSparsityP
 
     // global assembly to communicate entries
     aMat->initial_matrix_global_assembly();
+
+    // store graph for subsequent linear systems
+    if ( mReuseMatrixGraph )
+    {
+        mCachedGraph = aMat->get_graph();
+
+        mCachedGraphDofTypes       = this->get_requested_dof_types();
+        mCachedGraphDofIds         = this->get_my_local_global_map();
+        mCachedGraphConstrainedIds = this->get_constrained_Ids();
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------
+
+bool
+Solver_Interface::is_matrix_graph_cache_valid()
+{
+    if ( mCachedGraph == nullptr || mCachedGraphDofTypes.data() != this->get_requested_dof_types().data() )
+    {
+        return false;
+    }
+
+    // the dof layout changes with the mesh and the boundary conditions
+    Matrix< DDSMat > tDofIds         = this->get_my_local_global_map();
+    Matrix< DDUMat > tConstrainedIds = this->get_constrained_Ids();
+
+    if ( tDofIds.numel() != mCachedGraphDofIds.numel() || tConstrainedIds.numel() != mCachedGraphConstrainedIds.numel() )
+    {
+        return false;
+    }
+
+    return std::equal( tDofIds.data(), tDofIds.data() + tDofIds.numel(), mCachedGraphDofIds.data() )
+        && std::equal( tConstrainedIds.data(), tConstrainedIds.data() + tConstrainedIds.numel(), mCachedGraphConstrainedIds.data() );
 }
 
 //---------------------------------------------------------------------------------------------------------
@@ -127,6 +177,18 @@ Solver_Interface::assemble_RHS(
 
         this->initialize_set( Ii, false, aTimeContinuityOnlyFlag );
 
+        // get number of threads for this set
+        uint tNumThreads = this->get_num_assembly_threads( Ii );
+
+        if ( tNumThreads > 1 )
+        {
+            this->assemble_set_concurrently( Ii, tNumThreads, nullptr, aVectorRHS );
+
+            this->free_block_memory( Ii );
+
+            continue;
+        }
+
         for ( moris::uint Ik = 0; Ik < tNumEquationObjectOnSet; Ik++ )
         {
             this->get_element_topology( Ii, Ik, tElementTopology );
@@ -284,6 +346,9 @@ Solver_Interface::assemble_jacobian(
 
     this->report_beginning_of_assembly();
 
+    // assembly slots of equation objects for cached matrix assembly
+    this->compute_assembly_slot_offsets();
+
     // Loop over all local elements to build matrix graph
     for ( moris::uint Ii = 0; Ii < numBlocks; Ii++ )
     {
@@ -291,6 +356,18 @@ Solver_Interface::assemble_jacobian(
 
         this->initialize_set( Ii, false, aTimeContinuityOnlyFlag );
 
+        // get number of threads for this set
+        uint tNumThreads = this->get_num_assembly_threads( Ii );
+
+        if ( tNumThreads > 1 )
+        {
+            this->assemble_set_concurrently( Ii, tNumThreads, aMat, nullptr );
+
+            this->free_block_memory( Ii );
+
+            continue;
+        }
+
         for ( moris::uint Ik = 0; Ik < tNumEquationObjectOnSet; Ik++ )
         {
             this->get_element_topology( Ii, Ik, tElementTopology );
@@ -300,10 +377,7 @@ Solver_Interface::assemble_jacobian(
             // Fill element in distributed matrix
             if ( tElementMatrix.numel() > 0 )
             {
-                aMat->fill_matrix(
-                        tElementTopology.length(),
-                        tElementMatrix,
-                        tElementTopology );
+                this->fill_element_matrix( aMat, Ii, Ik, tElementTopology, tElementMatrix );
             }
         }
 
@@ -330,6 +404,9 @@ Solver_Interface::fill_matrix_and_RHS(
 
     this->report_beginning_of_assembly();
 
+    // assembly slots of equation objects for cached matrix assembly
+    this->compute_assembly_slot_offsets();
+
     // Loop over all local elements to build matrix graph
     for ( moris::uint Ii = 0; Ii < numBlocks; Ii++ )
     {
@@ -337,6 +414,18 @@ Solver_Interface::fill_matrix_and_RHS(
 
         this->initialize_set( Ii );
 
+        // get number of threads for this set
+        uint tNumThreads = this->get_num_assembly_threads( Ii );
+
+        if ( tNumThreads > 1 )
+        {
+            this->assemble_set_concurrently( Ii, tNumThreads, aMat, aVectorRHS );
+
+            this->free_block_memory( Ii );
+
+            continue;
+        }
+
         for ( moris::uint Ik = 0; Ik < tNumEquationObjectOnSet; Ik++ )
         {
             Matrix< DDSMat > tElementTopology;
@@ -349,10 +438,7 @@ Solver_Interface::fill_matrix_and_RHS(
             // Fill element in distributed matrix
             if ( tElementMatrix.numel() > 0 )
             {
-                aMat->fill_matrix(
-                        tElementTopology.length(),
-                        tElementMatrix,
-                        tElementTopology );
+                this->fill_element_matrix( aMat, Ii, Ik, tElementTopology, tElementMatrix );
             }
 
             // Loop over all RHS vectors
@@ -387,6 +473,192 @@ Solver_Interface::fill_matrix_and_RHS(
 
 //---------------------------------------------------------------------------------------------------------
 
+void
+Solver_Interface::compute_assembly_slot_offsets()
+{
+    if ( !mUseAssemblyCache )
+    {
+        return;
+    }
+
+    moris::uint tNumBlocks = this->get_num_my_blocks();
+
+    mSetAssemblySlotOffsets.resize( tNumBlocks + 1, 0 );
+
+    mSetAssemblySlotOffsets( 0 ) = 0;
+
+    for ( moris::uint Ii = 0; Ii < tNumBlocks; Ii++ )
+    {
+        mSetAssemblySlotOffsets( Ii + 1 ) = mSetAssemblySlotOffsets( Ii ) + this->get_num_equation_objects_on_set( Ii );
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------
+
+void
+Solver_Interface::fill_element_matrix(
+        moris::sol::Dist_Matrix* aMat,
+        const uint               aMyEquSetInd,
+        const uint               aMyElementInd,
+        const Matrix< DDSMat >&  aElementTopology,
+        const Matrix< DDRMat >&  aElementMatrix )
+{
+    if ( mUseAssemblyCache )
+    {
+        aMat->fill_matrix_cached(
+                mSetAssemblySlotOffsets( aMyEquSetInd ) + aMyElementInd,
+                aElementTopology.length(),
+                aElementMatrix,
+                aElementTopology );
+    }
+    else
+    {
+        aMat->fill_matrix(
+                aElementTopology.length(),
+                aElementMatrix,
+                aElementTopology );
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------
+
+uint
+Solver_Interface::get_num_assembly_threads( const uint aMyEquSetInd )
+{
+#ifdef MORIS_USE_OPENMP
+    // serial assembly if only one thread is requested or the set does not support it
+    if ( mNumAssemblyThreads < 2 || !this->is_concurrent_assembly_supported( aMyEquSetInd ) )
+    {
+        return 1;
+    }
+
+    // no nested parallel regions
+    if ( omp_in_parallel() )
+    {
+        return 1;
+    }
+
+    // do not use more threads than equation objects
+    uint tNumThreads = std::min( mNumAssemblyThreads, this->get_num_equation_objects_on_set( aMyEquSetInd ) );
+
+    return std::max( tNumThreads, (uint)1 );
+#else
+    return 1;
+#endif
+}
+
+//---------------------------------------------------------------------------------------------------------
+
+void
+Solver_Interface::assemble_set_concurrently(
+        const uint               aMyEquSetInd,
+        const uint               aNumThreads,
+        moris::sol::Dist_Matrix* aMat,
+        moris::sol::Dist_Vector* aVectorRHS )
+{
+    // get number of equation objects and RHS
+    uint tNumEquationObjectOnSet = this->get_num_equation_objects_on_set( aMyEquSetInd );
+    uint tNumRHS                 = this->get_num_rhs();
+
+    // let the set create its per-thread evaluation state
+    this->prepare_concurrent_assembly( aMyEquSetInd, aNumThreads );
+
+    // equation objects are processed in batches, each equation object of a batch has its own scratch buffer.
+    // Buffers are reused between batches such that only the first batch allocates memory.
+    uint tBatchSize = std::min( 16 * aNumThreads, tNumEquationObjectOnSet );
+
+    moris::Cell< Matrix< DDSMat > >         tElementTopology( tBatchSize );
+    moris::Cell< Matrix< DDRMat > >         tElementMatrix( tBatchSize );
+    moris::Cell< Cell< Matrix< DDRMat > > > tElementRHS( tBatchSize );
+
+    // index of the first equation object of the current batch
+    uint tBatchStart = 0;
+
+    // scatter the contribution stored in one scratch buffer into the distributed matrix and vector
+    auto tScatter = [ & ]( const uint aSlot ) {
+        // Fill element in distributed matrix
+        if ( aMat != nullptr && tElementMatrix( aSlot ).numel() > 0 )
+        {
+            this->fill_element_matrix(
+                    aMat,
+                    aMyEquSetInd,
+                    tBatchStart + aSlot,
+                    tElementTopology( aSlot ),
+                    tElementMatrix( aSlot ) );
+        }
+
+        // Fill elementRHS in distributed RHS
+        if ( aVectorRHS != nullptr && tElementRHS( aSlot ).size() > 0 )
+        {
+            MORIS_ASSERT( tElementRHS( aSlot ).size() == tNumRHS,
+                    "Number of RHS does not match cell with RHS vectors.\n" );
+
+            for ( moris::uint Ia = 0; Ia < tNumRHS; Ia++ )
+            {
+                if ( tElementRHS( aSlot )( Ia ).numel() > 0 )
+                {
+                    aVectorRHS->sum_into_global_values(
+                            tElementTopology( aSlot ),
+                            tElementRHS( aSlot )( Ia ),
+                            Ia );
+                }
+            }
+        }
+    };
+
+    for ( tBatchStart = 0; tBatchStart < tNumEquationObjectOnSet; tBatchStart += tBatchSize )
+    {
+        // number of equation objects in this batch
+        sint tNumInBatch = std::min( tBatchSize, tNumEquationObjectOnSet - tBatchStart );
+
+        // compute element contributions concurrently. The distributed matrix and vector are not
+        // thread safe (Epetra and PETSc), therefore scattering is serialized.
+#ifdef MORIS_USE_OPENMP
+#pragma omp parallel for num_threads( aNumThreads ) schedule( dynamic )
+#endif
+        for ( sint iSlot = 0; iSlot < tNumInBatch; iSlot++ )
+        {
+            uint tEquationObjectInd = tBatchStart + iSlot;
+
+            this->get_element_topology( aMyEquSetInd, tEquationObjectInd, tElementTopology( iSlot ) );
+
+            if ( aMat != nullptr && aVectorRHS != nullptr )
+            {
+                this->get_equation_object_operator_and_rhs(
+                        aMyEquSetInd, tEquationObjectInd, tElementMatrix( iSlot ), tElementRHS( iSlot ) );
+            }
+            else if ( aMat != nullptr )
+            {
+                this->get_equation_object_operator( aMyEquSetInd, tEquationObjectInd, tElementMatrix( iSlot ) );
+            }
+            else
+            {
+                this->get_equation_object_rhs( aMyEquSetInd, tEquationObjectInd, tElementRHS( iSlot ) );
+            }
+
+            // scatter in order of completion if reproducibility is not requested
+            if ( !mIsDeterministicAssembly )
+            {
+#ifdef MORIS_USE_OPENMP
+#pragma omp critical( moris_dla_assembly_scatter )
+#endif
+                tScatter( iSlot );
+            }
+        }
+
+        // scatter in the order of the equation objects, identical to serial assembly
+        if ( mIsDeterministicAssembly )
+        {
+            for ( sint iSlot = 0; iSlot < tNumInBatch; iSlot++ )
+            {
+                tScatter( iSlot );
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------
+
 void
 Solver_Interface::get_adof_ids_based_on_criteria(
         moris::Cell< moris::Matrix< IdMat > >& aCriteriaIds,
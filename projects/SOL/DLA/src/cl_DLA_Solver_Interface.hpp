@@ -18,6 +18,8 @@
 
 #include "cl_DLA_Geometric_Multigrid.hpp"
 
+#include <memory>
+
 #ifdef WITHGPERFTOOLS
 #include <gperftools/profiler.h>
 #endif
@@ -28,6 +30,7 @@ namespace moris
     {
         class Dist_Vector;
         class Dist_Matrix;
+        class Matrix_Graph;
         class SOL_Warehouse;
     }    // namespace sol
 
@@ -57,6 +60,81 @@ namespace moris
 
         bool mIsForwardAnalysis = true;
 
+        // number of threads used to compute element contributions during assembly
+        uint mNumAssemblyThreads = 1;
+
+        // flag to scatter element contributions in the order of the equation objects,
+        // i.e. assembly is bitwise reproducible independent of the number of threads
+        bool mIsDeterministicAssembly = true;
+
+        // flag to sum element matrices into the matrix storage using cached offsets
+        bool mUseAssemblyCache = false;
+
+        // running index of the first equation object of each set, used as assembly slot
+        moris::Cell< uint > mSetAssemblySlotOffsets;
+
+        // flag to reuse the matrix graph between linear systems with the same dof types
+        bool mReuseMatrixGraph = false;
+
+        // matrix graph of the last linear system and the dof layout it was built for
+        std::shared_ptr< sol::Matrix_Graph > mCachedGraph;
+        moris::Cell< enum MSI::Dof_Type >    mCachedGraphDofTypes;
+        moris::Matrix< DDSMat >              mCachedGraphDofIds;
+        moris::Matrix< DDUMat >              mCachedGraphConstrainedIds;
+
+        //------------------------------------------------------------------------------
+        /**
+         * checks if the cached matrix graph was built for the current requested dof types,
+         * owned dof ids and constrained dof ids
+         */
+        bool is_matrix_graph_cache_valid();
+
+        //------------------------------------------------------------------------------
+        /**
+         * computes the assembly slot of the first equation object on each set
+         */
+        void compute_assembly_slot_offsets();
+
+        //------------------------------------------------------------------------------
+        /**
+         * sums an element matrix into the distributed matrix
+         * @param[ in ] aMat             distributed matrix
+         * @param[ in ] aMyEquSetInd     set index
+         * @param[ in ] aMyElementInd    equation object index on set
+         * @param[ in ] aElementTopology element dof ids
+         * @param[ in ] aElementMatrix   element matrix
+         */
+        void fill_element_matrix(
+                moris::sol::Dist_Matrix* aMat,
+                const uint               aMyEquSetInd,
+                const uint               aMyElementInd,
+                const Matrix< DDSMat >&  aElementTopology,
+                const Matrix< DDRMat >&  aElementMatrix );
+
+        //------------------------------------------------------------------------------
+        /**
+         * returns the number of threads used to assemble the equation objects on a set.
+         * Falls back to 1 if not compiled with OpenMP or if the set cannot be evaluated concurrently.
+         * @param[ in ] aMyEquSetInd set index
+         */
+        uint get_num_assembly_threads( const uint aMyEquSetInd );
+
+        //------------------------------------------------------------------------------
+        /**
+         * computes the element contributions of all equation objects on a set concurrently
+         * and scatters them into the distributed matrix and/or vector.
+         * The set needs to be initialized before calling this function.
+         * @param[ in ] aMyEquSetInd set index
+         * @param[ in ] aNumThreads  number of threads
+         * @param[ in ] aMat         distributed matrix, nullptr if only the RHS is assembled
+         * @param[ in ] aVectorRHS   distributed RHS, nullptr if only the matrix is assembled
+         */
+        void assemble_set_concurrently(
+                const uint               aMyEquSetInd,
+                const uint               aNumThreads,
+                moris::sol::Dist_Matrix* aMat,
+                moris::sol::Dist_Vector* aVectorRHS );
+
       protected:
         moris::Cell< moris_id > mNonZeroDigonal;
         moris::Cell< moris_id > mNonZeroOffDigonal;
@@ -102,6 +180,87 @@ namespace moris
             return mIsForwardAnalysis;
         };
 
+        //------------------------------------------------------------------------------
+        /**
+         * sets the shared-memory assembly parameters
+         * @param[ in ] aNumThreads      number of threads used to compute element contributions
+         * @param[ in ] aIsDeterministic if true, element contributions are scattered in serial order
+         * @param[ in ] aUseCache        if true, element matrices are summed in using cached matrix offsets
+         */
+        void
+        set_assembly_parameters(
+                const uint aNumThreads,
+                const bool aIsDeterministic,
+                const bool aUseCache = false )
+        {
+            MORIS_ERROR( aNumThreads > 0,
+                    "Solver_Interface::set_assembly_parameters - number of assembly threads needs to be at least 1." );
+
+            mNumAssemblyThreads      = aNumThreads;
+            mIsDeterministicAssembly = aIsDeterministic;
+            mUseAssemblyCache        = aUseCache;
+        };
+
+        //------------------------------------------------------------------------------
+        /**
+         * sets if the matrix graph is reused by linear systems with the same requested dof types
+         * @param[ in ] aReuseMatrixGraph if true, the graph is cached after it has been built
+         */
+        void
+        set_reuse_matrix_graph( const bool aReuseMatrixGraph )
+        {
+            mReuseMatrixGraph = aReuseMatrixGraph;
+
+            this->reset_matrix_graph_cache();
+        };
+
+        //------------------------------------------------------------------------------
+        /**
+         * returns if the matrix graph is reused by linear systems with the same requested dof types
+         */
+        bool
+        get_reuse_matrix_graph() const
+        {
+            return mReuseMatrixGraph;
+        };
+
+        //------------------------------------------------------------------------------
+        /**
+         * deletes the cached matrix graph and sparsity pattern,
+         * needs to be called if the dof layout changes
+         */
+        virtual void
+        reset_matrix_graph_cache()
+        {
+            mCachedGraph = nullptr;
+            mCachedGraphDofTypes.clear();
+            mCachedGraphDofIds.set_size( 0, 0 );
+            mCachedGraphConstrainedIds.set_size( 0, 0 );
+        };
+
+        //------------------------------------------------------------------------------
+        /**
+         * returns if the equation objects on a set can be evaluated concurrently,
+         * i.e. if the set provides independent per-thread evaluation state
+         * @param[ in ] aMyEquSetInd set index
+         */
+        virtual bool
+        is_concurrent_assembly_supported( const uint aMyEquSetInd )
+        {
+            return false;
+        };
+
+        //------------------------------------------------------------------------------
+        /**
+         * prepares a set for concurrent evaluation of its equation objects
+         * @param[ in ] aMyEquSetInd set index
+         * @param[ in ] aNumThreads  number of threads evaluating the set
+         */
+        virtual void
+        prepare_concurrent_assembly(
+                const uint aMyEquSetInd,
+                const uint aNumThreads ){};
+
         //------------------------------------------------------------------------------
 
         virtual void
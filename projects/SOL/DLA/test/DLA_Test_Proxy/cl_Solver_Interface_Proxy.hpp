@@ -212,6 +212,14 @@ namespace moris
 
         // ----------------------------------------------------------------------------------------------
 
+        void
+        set_constrained_dofs( const Matrix< DDUMat >& aConstrainedDofs )
+        {
+            mMyConstraintDofs = aConstrainedDofs;
+        }
+
+        // ----------------------------------------------------------------------------------------------
+
         void
         get_equation_object_rhs(
                 const uint&               aMyElementInd,
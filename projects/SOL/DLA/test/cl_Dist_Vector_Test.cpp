@@ -21,6 +21,8 @@
 #include "cl_Vector_Epetra.hpp"
 #include "cl_SOL_Dist_Map.hpp" // DLA/src
 
+#include <cstdio>
+
 namespace moris
 {
     namespace sol
@@ -359,6 +361,63 @@ TEST_CASE("Import Dist Vector","[Import Dist Vector],[DistLinAlg]")
         delete tMapFree;
     }
 }
+TEST_CASE("HDF5 Dist Vector","[HDF5 Dist Vector],[DistLinAlg]")
+{
+    if ( par_size() == 4 )
+    {
+        // Build Input Class
+        Solver_Interface* tSolverInput = new Solver_Interface_Proxy( );
+
+        // Build matrix factory
+        sol::Matrix_Vector_Factory tMatFactory;
+
+        // Build map
+        Dist_Map* tMap = tMatFactory.create_map( tSolverInput->get_my_local_global_map(),
+                                                 tSolverInput->get_constrained_Ids() );
+
+        // vector with distinct values on every processor
+        Dist_Vector* tVectorA = tMatFactory.create_vector( tSolverInput, tMap, 1 );
+
+        Epetra_MultiVector* tEpetraVectorA = static_cast< Vector_Epetra* >( tVectorA )->get_epetra_vector();
+
+        for ( sint Ik = 0; Ik < tEpetraVectorA->MyLength(); Ik++ )
+        {
+            ( *tEpetraVectorA )[ 0 ][ Ik ] = 1.0 + 0.5 * tEpetraVectorA->Map().GID( Ik );
+        }
+
+        // save the distributed vector, every processor writes its part
+        std::string tFileName = "HDF5_Dist_Vector_Test.hdf5";
+
+        tVectorA->save_vector_to_HDF5( tFileName.c_str() );
+
+        // read it into a new vector on the same map, every processor reads its part
+        Dist_Vector* tVectorB = tMatFactory.create_vector( tSolverInput, tMap, 1 );
+
+        tVectorB->read_vector_from_HDF5( tFileName.c_str(), "LHS", 0 );
+
+        Epetra_MultiVector* tEpetraVectorB = static_cast< Vector_Epetra* >( tVectorB )->get_epetra_vector();
+
+        REQUIRE( tEpetraVectorB->MyLength() == tEpetraVectorA->MyLength() );
+        REQUIRE( tEpetraVectorB->Map().SameAs( tEpetraVectorA->Map() ) );
+
+        for ( sint Ik = 0; Ik < tEpetraVectorB->MyLength(); Ik++ )
+        {
+            CHECK( ( *tEpetraVectorB )[ 0 ][ Ik ] == ( *tEpetraVectorA )[ 0 ][ Ik ] );
+        }
+
+        // remove file once all processors have read it
+        barrier();
+
+        if ( par_rank() == 0 )
+        {
+            std::remove( tFileName.c_str() );
+        }
+
+        delete( tSolverInput );
+        delete( tVectorA );
+        delete( tVectorB );
+        delete tMap;
+    }
+}
 }
 }
-
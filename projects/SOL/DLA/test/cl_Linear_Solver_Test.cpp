@@ -221,6 +221,109 @@ namespace moris
             }
         }
 
+        TEST_CASE( "Linear System Graph Reuse", "[Linear System Graph Reuse],[Linear Solver],[DistLinAlg]" )
+        {
+            if ( par_size() == 1 )
+            {
+                Solver_Interface_Proxy* tSolverInterface = new Solver_Interface_Proxy( 1 );
+                tSolverInterface->set_reuse_matrix_graph( true );
+
+                Solver_Factory tSolFactory;
+
+                // build two linear systems for the same dof layout
+                Linear_Problem* tLinProblem1 = tSolFactory.create_linear_system( tSolverInterface, sol::MapType::Epetra );
+                Linear_Problem* tLinProblem2 = tSolFactory.create_linear_system( tSolverInterface, sol::MapType::Epetra );
+
+                tLinProblem1->assemble_jacobian();
+                tLinProblem2->assemble_jacobian();
+
+                // second matrix shares the cached graph
+                CHECK( tLinProblem1->get_matrix()->get_matrix()->Graph().DataPtr()
+                        == tLinProblem2->get_matrix()->get_matrix()->Graph().DataPtr() );
+
+                // both matrices have the same entries
+                tLinProblem1->get_free_solver_LHS()->random();
+
+                tLinProblem1->get_matrix()->mat_vec_product( *tLinProblem1->get_free_solver_LHS(), *tLinProblem1->get_solver_RHS(), false );
+                tLinProblem2->get_matrix()->mat_vec_product( *tLinProblem1->get_free_solver_LHS(), *tLinProblem2->get_solver_RHS(), false );
+
+                Matrix< DDRMat > tResult1;
+                Matrix< DDRMat > tResult2;
+                tLinProblem1->get_solver_RHS()->extract_copy( tResult1 );
+                tLinProblem2->get_solver_RHS()->extract_copy( tResult2 );
+
+                REQUIRE( tResult1.numel() == tResult2.numel() );
+                for ( uint Ik = 0; Ik < tResult1.numel(); Ik++ )
+                {
+                    CHECK( tResult1( Ik ) == tResult2( Ik ) );
+                }
+
+                // changing the constrained dofs changes the dof layout and rebuilds the graph
+                Matrix< DDUMat > tConstrainedDofs = { { 0 }, { 1 } };
+                tSolverInterface->set_constrained_dofs( tConstrainedDofs );
+
+                Linear_Problem* tLinProblem3 = tSolFactory.create_linear_system( tSolverInterface, sol::MapType::Epetra );
+
+                CHECK( tLinProblem1->get_matrix()->get_matrix()->Graph().DataPtr()
+                        != tLinProblem3->get_matrix()->get_matrix()->Graph().DataPtr() );
+                CHECK( tLinProblem3->get_matrix()->get_matrix()->NumGlobalRows()
+                        == tLinProblem1->get_matrix()->get_matrix()->NumGlobalRows() + 1 );
+
+                delete ( tLinProblem1 );
+                delete ( tLinProblem2 );
+                delete ( tLinProblem3 );
+                delete ( tSolverInterface );
+            }
+        }
+
+        TEST_CASE( "Linear System Graph Reuse Parallel", "[Linear System Graph Reuse Parallel],[Linear Solver],[DistLinAlg]" )
+        {
+            if ( par_size() == 4 )
+            {
+                Solver_Interface_Proxy* tSolverInterface = new Solver_Interface_Proxy();
+                tSolverInterface->set_reuse_matrix_graph( true );
+
+                Solver_Factory tSolFactory;
+
+                // build two linear systems for the same dof layout
+                Linear_Problem* tLinProblem1 = tSolFactory.create_linear_system( tSolverInterface, sol::MapType::Epetra );
+                Linear_Problem* tLinProblem2 = tSolFactory.create_linear_system( tSolverInterface, sol::MapType::Epetra );
+
+                // second matrix shares the cached graph on all procs
+                CHECK( tLinProblem1->get_matrix()->get_matrix()->Graph().DataPtr()
+                        == tLinProblem2->get_matrix()->get_matrix()->Graph().DataPtr() );
+
+                // change the dof layout on one proc only, all procs have to rebuild the graph together
+                if ( par_rank() == 2 )
+                {
+                    Matrix< DDUMat > tConstrainedDofs = { { 4 } };
+                    tSolverInterface->set_constrained_dofs( tConstrainedDofs );
+                }
+
+                Linear_Problem* tLinProblem3 = tSolFactory.create_linear_system( tSolverInterface, sol::MapType::Epetra );
+
+                CHECK( tLinProblem1->get_matrix()->get_matrix()->Graph().DataPtr()
+                        != tLinProblem3->get_matrix()->get_matrix()->Graph().DataPtr() );
+                CHECK( tLinProblem3->get_matrix()->get_matrix()->NumGlobalRows()
+                        == tLinProblem1->get_matrix()->get_matrix()->NumGlobalRows() - 1 );
+
+                // the rebuilt graph is cached and reused on all procs
+                Linear_Problem* tLinProblem4 = tSolFactory.create_linear_system( tSolverInterface, sol::MapType::Epetra );
+
+                CHECK( tLinProblem3->get_matrix()->get_matrix()->Graph().DataPtr()
+                        == tLinProblem4->get_matrix()->get_matrix()->Graph().DataPtr() );
+
+                tLinProblem4->assemble_jacobian();
+                CHECK( tLinProblem4->get_matrix()->get_matrix()->Filled() );
+
+                delete ( tLinProblem1 );
+                delete ( tLinProblem2 );
+                delete ( tLinProblem3 );
+                delete ( tLinProblem4 );
+                delete ( tSolverInterface );
+            }
+        }
+
 #ifdef MORIS_HAVE_PETSC
         TEST_CASE( "Linear System PETSc single RHS", "[Linear Solver single RHS],[Linear Solver],[DistLinAlg]" )
         {
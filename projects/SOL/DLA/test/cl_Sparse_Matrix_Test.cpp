@@ -19,6 +19,15 @@
 #include "cl_Solver_Interface_Proxy.hpp"       // DLA/src/
 #include "cl_SOL_Dist_Vector.hpp"              // DLA/src/
 #include "cl_SOL_Dist_Matrix.hpp"              // DLA/src/
+#include "cl_Block_Matrix_Epetra.hpp"          // SOL_CORE/src/
+#include "cl_DLA_Preconditioner_Field_Split.hpp"    // DLA/src/
+
+#include "Epetra_Vector.h"
+#include "Epetra_LinearProblem.h"
+#include "AztecOO.h"
+#include "Teuchos_ParameterList.hpp"
+
+#include <memory>
 
 #ifdef MORIS_HAVE_PETSC
 #include "cl_MatrixPETSc.hpp"    // DLA/src/
@@ -101,6 +110,88 @@ namespace moris
             }
         }
 
+        TEST_CASE( "Sparse Mat Cached Assembly", "[Sparse Mat Cached Assembly],[DistLinAlg]" )
+        {
+            // Determine process rank
+            size_t rank = par_rank();
+            size_t size = par_size();
+
+            if ( size == 4 )
+            {
+                // Build Input Class
+                Solver_Interface* tSolverInput = new Solver_Interface_Proxy();
+
+                // Build matrix factory
+                Matrix_Vector_Factory tMatFactory;
+
+                // Build map
+                Dist_Map* tLocalMap = tMatFactory.create_map( tSolverInput->get_my_local_global_map(),
+                        tSolverInput->get_constrained_Ids() );
+
+                // Create pointer to sparse matrix
+                sol::Dist_Matrix* tMat = tMatFactory.create_matrix( tSolverInput, tLocalMap );
+
+                // Build sparse matrix graph
+                for ( moris::uint Ii = 0; Ii < tSolverInput->get_num_my_elements(); Ii++ )
+                {
+                    Matrix< DDSMat > tElementTopology;
+                    tSolverInput->get_element_topology( Ii, tElementTopology );
+
+                    tMat->build_graph( tElementTopology.n_rows(), tElementTopology );
+                }
+
+                // Call Global Asemby to ship information between processes
+                tMat->matrix_global_assembly();
+
+                uint tNumElements = tSolverInput->get_num_my_elements();
+
+                // the second assembly reuses the cached offsets of the first one, the third one assembles
+                // the elements into other slots whose offsets need to be recomputed
+                for ( uint iAssembly = 0; iAssembly < 3; iAssembly++ )
+                {
+                    tMat->mat_put_scalar( 0.0 );
+
+                    // Fill element matrices into global matrix
+                    for ( uint Ii = 0; Ii < tSolverInput->get_num_my_elements(); Ii++ )
+                    {
+                        Matrix< DDSMat > tElementTopology;
+                        tSolverInput->get_element_topology( Ii, tElementTopology );
+
+                        Matrix< DDRMat > tElementMatrix;
+                        tSolverInput->get_equation_object_operator( Ii, tElementMatrix );
+
+                        uint tSlot = iAssembly < 2 ? Ii : ( Ii + 1 ) % tNumElements;
+
+                        tMat->fill_matrix_cached( tSlot, tElementTopology.n_rows(), tElementMatrix, tElementTopology );
+                    }
+
+                    // Call Global Asemby to ship information between processes
+                    tMat->matrix_global_assembly();
+
+                    // Set up output matrix
+                    sint tGlobalRow  = 8;
+                    sint tLength     = 13;
+                    sint tNumEntries = 5;
+
+                    moris::Matrix< DDRMat > tValues( tLength, 1, 0.0 );
+
+                    // Get matrix values
+                    tMat->get_matrix()->ExtractGlobalRowCopy( tGlobalRow, tLength, tNumEntries, tValues.data() );
+
+                    // Compare to values of standard assembly
+                    if ( rank == 0 )
+                    {
+                        CHECK( equal_to( tValues( 0, 0 ), 24 ) );
+                        CHECK( equal_to( tValues( 4, 0 ), -6 ) );
+                        CHECK( equal_to( tValues( 8, 0 ), -3 ) );
+                    }
+                }
+                delete ( tSolverInput );
+                delete ( tLocalMap );
+                delete ( tMat );
+            }
+        }
+
         TEST_CASE( "Scale Sparse Mat", "[Scale Sparse Mat],[DistLinAlg]" )
         {
             // Determine process rank
@@ -294,6 +385,122 @@ namespace moris
             }
         }
 
+        TEST_CASE( "Matrix Free Operator", "[Matrix Free Operator],[DistLinAlg]" )
+        {
+            // Determine process rank
+            size_t rank = par_rank();
+            size_t size = par_size();
+
+            if ( size == 4 )
+            {
+                // Build Input Classes, the proxy returns the element matrix only in the first pass over the blocks
+                Solver_Interface* tSolverInput     = new Solver_Interface_Proxy();
+                Solver_Interface* tSolverInputFree = new Solver_Interface_Proxy();
+
+                // Build matrix factory
+                Matrix_Vector_Factory tMatFactory;
+
+                // Build map
+                Dist_Map* tMap = tMatFactory.create_map( tSolverInput->get_my_local_global_map(),
+                        tSolverInput->get_constrained_Ids() );
+
+                // Create assembled sparse matrix and matrix-free operator
+                sol::Dist_Matrix* tMat      = tMatFactory.create_matrix( tSolverInput, tMap );
+                sol::Dist_Matrix* tOperator = tMatFactory.create_matrix_free_operator( tSolverInputFree, tMap );
+
+                CHECK( tOperator->is_matrix_free() );
+
+                // Build graphs
+                for ( moris::uint Ii = 0; Ii < tSolverInput->get_num_my_elements(); Ii++ )
+                {
+                    Matrix< DDSMat > tElementTopology;
+                    tSolverInput->get_element_topology( Ii, tElementTopology );
+
+                    tMat->build_graph( tElementTopology.n_rows(), tElementTopology );
+                    tOperator->build_graph( tElementTopology.n_rows(), tElementTopology );
+                }
+
+                tMat->matrix_global_assembly();
+                tOperator->initial_matrix_global_assembly();
+
+                // Fill element matrices, the matrix-free operator only assembles the diagonal
+                for ( uint Ii = 0; Ii < tSolverInput->get_num_my_elements(); Ii++ )
+                {
+                    Matrix< DDSMat > tElementTopology;
+                    tSolverInput->get_element_topology( Ii, tElementTopology );
+
+                    Matrix< DDRMat > tElementMatrix;
+                    tSolverInput->get_equation_object_operator( Ii, tElementMatrix );
+
+                    tMat->fill_matrix( tElementTopology.n_rows(), tElementMatrix, tElementTopology );
+                    tOperator->fill_matrix( tElementTopology.n_rows(), tElementMatrix, tElementTopology );
+                }
+
+                tMat->matrix_global_assembly();
+                tOperator->matrix_global_assembly();
+
+                // compare diagonals
+                sol::Dist_Vector* tDiagonal     = tMatFactory.create_vector( tSolverInput, tMap, 1 );
+                sol::Dist_Vector* tDiagonalFree = tMatFactory.create_vector( tSolverInput, tMap, 1 );
+
+                tMat->get_diagonal( *tDiagonal );
+                tOperator->get_diagonal( *tDiagonalFree );
+
+                moris::Matrix< DDRMat > tValues;
+                moris::Matrix< DDRMat > tValuesFree;
+
+                tDiagonal->extract_copy( tValues );
+                tDiagonalFree->extract_copy( tValuesFree );
+
+                REQUIRE( tValues.numel() == tValuesFree.numel() );
+
+                for ( uint Ik = 0; Ik < tValues.numel(); Ik++ )
+                {
+                    CHECK( equal_to( tValues( Ik ), tValuesFree( Ik ) ) );
+                }
+
+                // compare matrix-vector products
+                sol::Dist_Vector* tVectorX     = tMatFactory.create_vector( tSolverInput, tMap, 1 );
+                sol::Dist_Vector* tVectorY     = tMatFactory.create_vector( tSolverInput, tMap, 1 );
+                sol::Dist_Vector* tVectorYFree = tMatFactory.create_vector( tSolverInput, tMap, 1 );
+
+                tVectorX->random();
+
+                tMat->mat_vec_product( *tVectorX, *tVectorY, false );
+                tOperator->mat_vec_product( *tVectorX, *tVectorYFree, false );
+
+                tVectorY->extract_copy( tValues );
+                tVectorYFree->extract_copy( tValuesFree );
+
+                REQUIRE( tValues.numel() == tValuesFree.numel() );
+
+                for ( uint Ik = 0; Ik < tValues.numel(); Ik++ )
+                {
+                    CHECK( std::abs( tValues( Ik ) - tValuesFree( Ik ) ) < 1.0e-12 * ( 1.0 + std::abs( tValues( Ik ) ) ) );
+                }
+
+                // diagonal values of the standard assembly
+                if ( rank == 0 )
+                {
+                    tDiagonalFree->extract_copy( tValuesFree );
+
+                    CHECK( equal_to( tValuesFree( 2, 0 ), 48 ) );
+                    CHECK( equal_to( tValuesFree( 4, 0 ), 24 ) );
+                }
+
+                delete ( tSolverInput );
+                delete ( tSolverInputFree );
+                delete ( tMap );
+                delete ( tDiagonal );
+                delete ( tDiagonalFree );
+                delete ( tVectorX );
+                delete ( tVectorY );
+                delete ( tVectorYFree );
+                delete ( tMat );
+                delete ( tOperator );
+            }
+        }
+
 #ifdef MORIS_HAVE_PETSC
         TEST_CASE( "Get Matrix Values", "[Get_Matrix_Values],[DistLinAlg]" )
         {
@@ -519,5 +726,154 @@ namespace moris
                 delete tColMap;
             }
         }
+
+        TEST_CASE( "Block Matrix Epetra", "[Block Matrix Epetra],[DistLinAlg]" )
+        {
+            // Determine process rank
+            size_t size = par_size();
+
+            if ( size == 4 )
+            {
+                // Build Input Class
+                Solver_Interface* tSolverInput = new Solver_Interface_Proxy();
+
+                // Build matrix factory
+                Matrix_Vector_Factory tMatFactory;
+
+                // Build map
+                Dist_Map* tMap = tMatFactory.create_map( tSolverInput->get_my_local_global_map(),
+                        tSolverInput->get_constrained_Ids() );
+
+                // Create pointer to sparse matrix
+                sol::Dist_Matrix* tMat = tMatFactory.create_matrix( tSolverInput, tMap );
+
+                // Build sparse matrix graph
+                for ( moris::uint Ii = 0; Ii < tSolverInput->get_num_my_elements(); Ii++ )
+                {
+                    Matrix< DDSMat > tElementTopology;
+                    tSolverInput->get_element_topology( Ii, tElementTopology );
+
+                    tMat->build_graph( tElementTopology.n_rows(), tElementTopology );
+                }
+
+                // Call Global Asemby to ship information between processes
+                tMat->matrix_global_assembly();
+
+                // Fill element matrices into global matrix
+                for ( uint Ii = 0; Ii < tSolverInput->get_num_my_elements(); Ii++ )
+                {
+                    Matrix< DDSMat > tElementTopology;
+                    tSolverInput->get_element_topology( Ii, tElementTopology );
+
+                    Matrix< DDRMat > tElementMatrix;
+                    tSolverInput->get_equation_object_operator( Ii, tElementMatrix );
+
+                    tMat->fill_matrix( tElementTopology.n_rows(), tElementMatrix, tElementTopology );
+                }
+
+                // Call Global Asemby to ship information between processes
+                tMat->matrix_global_assembly();
+
+                // split matrix rows into blocks of even and odd ids, skipping constrained dofs
+                Matrix< DDSMat > tRowIds;
+                tMat->translate_ids_to_row_ids( tSolverInput->get_my_local_global_map(), tRowIds );
+
+                moris::Cell< Matrix< DDSMat > > tBlockRowIds( 2, Matrix< DDSMat >( 0, 1 ) );
+
+                for ( uint Ik = 0; Ik < tRowIds.numel(); Ik++ )
+                {
+                    if ( tRowIds( Ik ) >= 0 )
+                    {
+                        Matrix< DDSMat >& tIds = tBlockRowIds( tRowIds( Ik ) % 2 );
+
+                        tIds.resize( tIds.numel() + 1, 1 );
+                        tIds( tIds.numel() - 1 ) = tRowIds( Ik );
+                    }
+                }
+
+                Block_Matrix_Epetra tBlockMatrix( tMat->get_matrix(), tBlockRowIds );
+
+                REQUIRE( tBlockMatrix.get_num_blocks() == 2 );
+
+                // compare monolithic product with product of blocks
+                const Epetra_Map& tRowMap = tMat->get_matrix()->RowMap();
+
+                Epetra_Vector tX( tRowMap );
+                Epetra_Vector tY( tRowMap );
+                Epetra_Vector tYBlocks( tRowMap );
+
+                for ( int Ik = 0; Ik < tX.MyLength(); Ik++ )
+                {
+                    tX[ Ik ] = 1.0 + 0.1 * tRowMap.GID( Ik );
+                }
+
+                tMat->get_matrix()->Multiply( false, tX, tY );
+
+                for ( uint iRow = 0; iRow < 2; iRow++ )
+                {
+                    Epetra_Vector tBlockY( tBlockMatrix.get_block_map( iRow ), true );
+
+                    for ( uint iCol = 0; iCol < 2; iCol++ )
+                    {
+                        std::unique_ptr< Epetra_CrsMatrix > tBlock( tBlockMatrix.extract_block( iRow, iCol ) );
+
+                        Epetra_Vector tBlockX( tBlockMatrix.get_block_map( iCol ) );
+                        tBlockMatrix.extract_block_vector( tX, iCol, tBlockX );
+
+                        Epetra_Vector tProduct( tBlockMatrix.get_block_map( iRow ) );
+                        tBlock->Multiply( false, tBlockX, tProduct );
+
+                        tBlockY.Update( 1.0, tProduct, 1.0 );
+                    }
+
+                    tBlockMatrix.insert_block_vector( tBlockY, iRow, tYBlocks );
+                }
+
+                for ( int Ik = 0; Ik < tY.MyLength(); Ik++ )
+                {
+                    CHECK( equal_to( tY[ Ik ], tYBlocks[ Ik ] ) );
+                }
+
+                // Schur complement is defined on the second block
+                std::unique_ptr< Epetra_CrsMatrix > tSchur( tBlockMatrix.build_approximate_schur_complement() );
+
+                CHECK( tSchur->RowMap().SameAs( tBlockMatrix.get_block_map( 1 ) ) );
+
+                // solve with GMRES and each field-split type, the right hand side is the product computed above
+                for ( std::string tSplitType : { "additive", "multiplicative", "schur" } )
+                {
+                    Teuchos::ParameterList tBlockPrecParameters;
+
+                    dla::Preconditioner_Field_Split tPreconditioner(
+                            tMat->get_matrix(),
+                            tBlockRowIds,
+                            tSplitType,
+                            "ILU",
+                            tBlockPrecParameters,
+                            0 );
+
+                    Epetra_Vector tSol( tRowMap, true );
+                    Epetra_Vector tRHS( tY );
+
+                    Epetra_LinearProblem tProblem( tMat->get_matrix(), &tSol, &tRHS );
+
+                    AztecOO tSolver( tProblem );
+                    tSolver.SetAztecOption( AZ_solver, AZ_gmres );
+                    tSolver.SetAztecOption( AZ_output, AZ_none );
+                    tSolver.SetPrecOperator( &tPreconditioner );
+
+                    CHECK( tSolver.Iterate( 200, 1.0e-12 ) == 0 );
+
+                    for ( int Ik = 0; Ik < tSol.MyLength(); Ik++ )
+                    {
+                        CHECK( std::abs( tSol[ Ik ] - tX[ Ik ] ) < 1.0e-8 * std::abs( tX[ Ik ] ) );
+                    }
+                }
+
+                delete ( tSolverInput );
+                delete ( tMap );
+                delete ( tMat );
+            }
+        }
     }    // namespace sol
 }    // namespace moris
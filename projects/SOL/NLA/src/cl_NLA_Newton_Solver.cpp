@@ -92,6 +92,12 @@ Newton_Solver::solver_nonlinear_system( Nonlinear_Problem* aNonlinearProblem )
     // get option for computing residual and jacobian: separate or together
     bool tCombinedResJacAssembly = mParameterListNonlinearSolver.get< bool >( "NLA_combined_res_jac_assembly" );
 
+    // get option for keeping jacobian and preconditioner while the convergence rate is acceptable
+    bool tAdaptiveJacobianReuse = this->reuses_jacobian();
+
+    // linear solvers keep preconditioners and factorizations only if they may be reused
+    mNonlinearProblem->get_linearized_problem()->set_keep_preconditioner( tAdaptiveJacobianReuse );
+
     // set relaxation strategy
     Solver_Relaxation tRelaxationStrategy( mParameterListNonlinearSolver );
 
@@ -119,6 +125,12 @@ Newton_Solver::solver_nonlinear_system( Nonlinear_Problem* aNonlinearProblem )
             tRebuildJacobian = mParameterListNonlinearSolver.get< bool >( "NLA_rebuild_jacobian" );
         }
 
+        // keep jacobian of previous iteration or time step unless it needs to be rebuilt
+        if ( tAdaptiveJacobianReuse )
+        {
+            tRebuildJacobian = this->rebuild_jacobian( It );
+        }
+
         // For sensitivity analysis only: set current solution to LHS of linear system as residual is defined by A x - b
         if ( !mMyNonLinSolverManager->get_solver_interface()->get_is_forward_analysis() )
         {
@@ -145,7 +157,10 @@ Newton_Solver::solver_nonlinear_system( Nonlinear_Problem* aNonlinearProblem )
         }
         else
         {
-            mNonlinearProblem->build_linearized_problem( tRebuildJacobian, tCombinedResJacAssembly, It );
+            // combined assembly always rebuilds the jacobian; not used if the jacobian is kept
+            bool tCombinedAssembly = tCombinedResJacAssembly && ( tRebuildJacobian || !tAdaptiveJacobianReuse );
+
+            mNonlinearProblem->build_linearized_problem( tRebuildJacobian, tCombinedAssembly, It );
         }
 
         // check for convergence
@@ -158,6 +173,9 @@ Newton_Solver::solver_nonlinear_system( Nonlinear_Problem* aNonlinearProblem )
                 tMaxIts,
                 tHardBreak );
 
+        // rebuild kept jacobian if the convergence rate has degraded
+        bool tRebuildDegradedJacobian = tAdaptiveJacobianReuse && this->check_convergence_rate( It, tRebuildJacobian );
+
         // exit if convergence criterion is met
         if ( tIsConverged and tLoadFactor >= 1.0 )
         {
@@ -196,9 +214,32 @@ Newton_Solver::solver_nonlinear_system( Nonlinear_Problem* aNonlinearProblem )
                 mNonlinearProblem->get_linearized_problem()->set_free_solver_LHS( mNonlinearProblem->get_full_vector() );
             }
 
+            // assemble jacobian if kept jacobian does not converge well enough; residual is reassembled as well
+            // as the jacobian assembly may modify the right hand side
+            if ( tRebuildDegradedJacobian )
+            {
+                MORIS_LOG_INFO( "Rebuilding jacobian, convergence rate %6.2e", mConvergenceRate );
+
+                mNonlinearProblem->build_linearized_problem( true, tCombinedResJacAssembly, It );
+
+                tRebuildJacobian = true;
+            }
+
+            // reset age of a newly assembled jacobian
+            if ( tRebuildJacobian )
+            {
+                mJacobianAge = 0;
+            }
+
+            // preconditioners can be reused if the jacobian has been used in a previous linear solve
+            mNonlinearProblem->get_linearized_problem()->set_reuse_preconditioner( tAdaptiveJacobianReuse && mJacobianAge > 0 );
+
             // Solve linear system
             this->solve_linear_system( It, tHardBreak );
 
+            // count linear solves with current jacobian
+            mJacobianAge++;
+
             // Determine load factor
             tLoadControlStrategy.eval(
                     It,
@@ -235,6 +276,62 @@ Newton_Solver::solve_linear_system(
 
 //--------------------------------------------------------------------------------------------------------------------------
 
+bool
+Newton_Solver::reuses_jacobian()
+{
+    // jacobian is only kept in forward analysis
+    return mParameterListNonlinearSolver.get< bool >( "NLA_adaptive_jacobian_reuse" )
+        && mMyNonLinSolverManager->get_solver_interface()->get_is_forward_analysis();
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+bool
+Newton_Solver::rebuild_jacobian( const sint aIter )
+{
+    // build jacobian if none has been assembled into the matrix of the linear problem yet
+    if ( !mNonlinearProblem->get_linearized_problem()->is_jacobian_assembled() )
+    {
+        return true;
+    }
+
+    // rebuild jacobian if it has been used for the maximum number of linear solves
+    if ( mJacobianAge >= mParameterListNonlinearSolver.get< sint >( "NLA_jacobian_reuse_max_age" ) )
+    {
+        return true;
+    }
+
+    // in the first iteration of a new solve, rebuild jacobian if the previous solve converged too slowly with it
+    return aIter == 1 && mConvergenceRate > mParameterListNonlinearSolver.get< real >( "NLA_jacobian_reuse_max_rate" );
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+bool
+Newton_Solver::check_convergence_rate(
+        const sint aIter,
+        const bool aRebuildJacobian )
+{
+    // get residual norm computed by convergence check
+    real tResNorm = mMyNonLinSolverManager->get_residual_norm();
+
+    // compute ratio of residual norms of this and the previous iteration; residual norm of the previous
+    // solve is not comparable
+    if ( aIter > 1 )
+    {
+        mConvergenceRate = tResNorm / ( mPreviousResidualNorm + MORIS_REAL_EPS );
+
+        MORIS_LOG_SPEC( "ConvergenceRate", mConvergenceRate );
+    }
+
+    mPreviousResidualNorm = tResNorm;
+
+    // rebuild a kept jacobian if the convergence rate has degraded
+    return !aRebuildJacobian && mConvergenceRate > mParameterListNonlinearSolver.get< real >( "NLA_jacobian_reuse_max_rate" );
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
 void
 Newton_Solver::get_full_solution( Matrix< DDRMat >& LHSValues )
 {
@@ -29,6 +29,38 @@ namespace moris
         class Newton_Solver : public Nonlinear_Algorithm
         {
           private:
+            //! number of linear solves performed with the current jacobian (adaptive jacobian reuse)
+            sint mJacobianAge = 0;
+
+            //! residual norm of the previous Newton iteration (adaptive jacobian reuse)
+            real mPreviousResidualNorm = MORIS_REAL_MAX;
+
+            //! ratio of the residual norms of the last two Newton iterations (adaptive jacobian reuse)
+            real mConvergenceRate = MORIS_REAL_MAX;
+
+            /**
+             * @brief Decides before the assembly whether the jacobian kept from previous iterations or
+             * time steps needs to be rebuilt
+             *
+             * @param[in] aIter Number of newton iterations
+             */
+            bool rebuild_jacobian( const sint aIter );
+
+            //--------------------------------------------------------------------------------------------------
+
+            /**
+             * @brief Updates the convergence rate after the assembly of the residual and returns whether
+             * the kept jacobian needs to be rebuilt as the convergence rate has degraded
+             *
+             * @param[in] aIter            Number of newton iterations
+             * @param[in] aRebuildJacobian Flag whether the jacobian has been rebuilt in this iteration
+             */
+            bool check_convergence_rate(
+                    const sint aIter,
+                    const bool aRebuildJacobian );
+
+            //--------------------------------------------------------------------------------------------------
+
             /**
              * @brief Call for solve of linear system
              *
@@ -59,6 +91,8 @@ namespace moris
              */
             void solver_nonlinear_system( Nonlinear_Problem* aNonlinearProblem );
 
+            bool reuses_jacobian();
+
             void get_full_solution( moris::Matrix< DDRMat >& LHSValues );
 
             void get_solution( moris::Matrix< DDRMat >& LHSValues );
@@ -156,6 +156,18 @@ namespace moris
 
             Nonlinear_Solver* get_my_nonlin_solver();
 
+            //--------------------------------------------------------------------------------------------------
+
+            /**
+             * @brief Returns whether the algorithm reuses the jacobian across solves, i.e. whether the
+             * nonlinear problem should be kept between time steps
+             */
+            virtual bool
+            reuses_jacobian()
+            {
+                return false;
+            }
+
             virtual void
             set_my_time_solver_algorithm( std::shared_ptr< tsa::Time_Solver_Algorithm > aMyTimeSolverAlgorithm )
             {
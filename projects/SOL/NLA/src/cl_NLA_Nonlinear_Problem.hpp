@@ -157,6 +157,22 @@ namespace moris
 
             //--------------------------------------------------------------------------------------------------
 
+            /**
+             * @brief Sets the full solution vector, used if the nonlinear problem is kept for the next time step
+             *
+             * @param[in] aFullVector Full solution vector, not owned by the nonlinear problem
+             */
+            void
+            set_full_vector( sol::Dist_Vector* aFullVector )
+            {
+                MORIS_ASSERT( !mIsLeaderSystem,
+                        "Nonlinear_Problem::set_full_vector - full vector is owned by leader system.\n" );
+
+                mFullVector = aFullVector;
+            }
+
+            //--------------------------------------------------------------------------------------------------
+
             void extract_my_values(
                     const moris::uint&                      aNumIndices,
                     const moris::Matrix< DDSMat >&          aGlobalBlockRows,
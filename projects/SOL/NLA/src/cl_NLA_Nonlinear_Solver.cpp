@@ -318,6 +318,11 @@ Nonlinear_Solver::solve( sol::Dist_Vector* aFullVector )
                 false,
                 mSolverWarehouse->get_tpl_type() );
     }
+    else if ( mNonlinearProblem != nullptr && mNonlinearSolverAlgorithmList( 0 )->reuses_jacobian() )
+    {
+        // keep nonlinear problem of the previous solve such that its jacobian can be reused
+        mNonlinearProblem->set_full_vector( aFullVector );
+    }
     else
     {
         this->free_memory();
@@ -350,7 +355,11 @@ Nonlinear_Solver::solve( sol::Dist_Vector* aFullVector )
 
     mNonlinearSolverAlgorithmList( 0 )->solver_nonlinear_system( mNonlinearProblem );
 
-    this->free_memory();
+    // keep nonlinear problem for the next solve if the algorithm reuses the jacobian
+    if ( !mNonlinearSolverAlgorithmList( 0 )->reuses_jacobian() )
+    {
+        this->free_memory();
+    }
 }
 
 //-------------------------------------------------------------------------------------------------------
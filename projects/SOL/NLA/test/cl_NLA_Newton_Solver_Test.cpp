@@ -18,6 +18,7 @@
 #include "cl_DLA_Solver_Factory.hpp"
 #include "cl_DLA_Linear_Solver_Aztec.hpp"
 #include "cl_DLA_Linear_Solver.hpp"
+#include "cl_DLA_Linear_Problem.hpp"
 #include "cl_SOL_Dist_Vector.hpp"
 
 #include "fn_PRM_SOL_Parameters.hpp"
@@ -439,6 +440,64 @@ namespace moris
 
         //------------------------------------------------------------------------------
 
+        TEST_CASE( "Newton Solver Test Adaptive Jacobian Reuse", "[NLA],[NLA_Test_Adaptive_Jacobian_Reuse]" )
+        {
+            if ( par_size() == 1 )
+            {
+                Solver_Interface* tSolverInput = new NLA_Solver_Interface_Proxy( 2, 1, 1, 1, test_residual1, test_jacobian1, test_topo1 );
+
+                dla::Linear_Solver* tLinSolManager = new dla::Linear_Solver();
+                Nonlinear_Solver    tNonLinSolManager;
+                tNonLinSolManager.set_solver_interface( tSolverInput );
+
+                Nonlinear_Problem* tNonlinearProblem = new Nonlinear_Problem( tSolverInput );
+
+                Nonlinear_Solver_Factory tNonlinFactory;
+
+                std::shared_ptr< Nonlinear_Algorithm > tNonlLinSolverAlgorithm =
+                        tNonlinFactory.create_nonlinear_solver( NonlinearSolverType::NEWTON_SOLVER );
+
+                tNonlLinSolverAlgorithm->set_linear_solver( tLinSolManager );
+
+                // keep jacobian and factorization while the residual drops by at least a factor of 2
+                tNonlLinSolverAlgorithm->set_param( "NLA_max_iter" )                = 30;
+                tNonlLinSolverAlgorithm->set_param( "NLA_hard_break" )              = false;
+                tNonlLinSolverAlgorithm->set_param( "NLA_max_lin_solver_restarts" ) = 2;
+                tNonlLinSolverAlgorithm->set_param( "NLA_adaptive_jacobian_reuse" ) = true;
+                tNonlLinSolverAlgorithm->set_param( "NLA_jacobian_reuse_max_rate" ) = 0.5;
+
+                tNonLinSolManager.set_nonlinear_algorithm( tNonlLinSolverAlgorithm, 0 );
+
+                dla::Solver_Factory tSolFactory;
+
+                std::shared_ptr< dla::Linear_Solver_Algorithm > tLinSolver1 = tSolFactory.create_solver( sol::SolverType::AMESOS_IMPL );
+
+                tLinSolManager->set_linear_algorithm( 0, tLinSolver1 );
+
+                tNonLinSolManager.solve( tNonlinearProblem );
+
+                // jacobian has been assembled and the factorization is kept for the next solve
+                CHECK( tNonlinearProblem->get_linearized_problem()->is_jacobian_assembled() );
+                CHECK( tNonlinearProblem->get_linearized_problem()->get_keep_preconditioner() );
+
+                Matrix< DDSMat > tGlobalIndExtract( 2, 1, 0 );
+                tGlobalIndExtract( 1, 0 ) = 1;
+                moris::Cell< Matrix< DDRMat > > tMyValues;
+
+                tNonlLinSolverAlgorithm->extract_my_values( 2, tGlobalIndExtract, 0, tMyValues );
+
+                // same solution as with a jacobian rebuilt in every iteration
+                CHECK( equal_to( tMyValues( 0 )( 0, 0 ), 0.04011965, 1.0e+08 ) );
+                CHECK( equal_to( tMyValues( 0 )( 1, 0 ), 0.0154803, 1.0e+08 ) );
+
+                delete ( tNonlinearProblem );
+                delete ( tLinSolManager );
+                delete ( tSolverInput );
+            }
+        }
+
+        //------------------------------------------------------------------------------
+
 #ifdef MORIS_HAVE_PETSC
         TEST_CASE( "Newton Solver Test Petsc", "[NLA],[NLA_Test_Petsc]" )
         {
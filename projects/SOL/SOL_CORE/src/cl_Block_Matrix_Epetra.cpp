@@ -0,0 +1,309 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_Block_Matrix_Epetra.cpp
+ *
+ */
+
+#include "cl_Block_Matrix_Epetra.hpp"
+
+#include "cl_Logger.hpp"
+
+#include <map>
+#include <memory>
+
+#include "Epetra_Import.h"
+#include "Epetra_IntVector.h"
+#include "Epetra_Vector.h"
+
+using namespace moris;
+
+// ----------------------------------------------------------------------------------------------------------------------
+
+Block_Matrix_Epetra::Block_Matrix_Epetra(
+        const Epetra_CrsMatrix*                aMatrix,
+        const moris::Cell< Matrix< DDSMat > >& aBlockRowIds )
+        : mMatrix( aMatrix )
+{
+    MORIS_ERROR( mMatrix != nullptr && mMatrix->Filled(),
+            "Block_Matrix_Epetra::Block_Matrix_Epetra - matrix needs to be assembled and filled." );
+
+    const Epetra_Map& tRowMap = mMatrix->RowMap();
+
+    uint tNumBlocks = aBlockRowIds.size();
+
+    // block index of each local row, -1 for rows which have not been assigned
+    Epetra_IntVector tRowBlocks( tRowMap );
+    tRowBlocks.PutValue( -1 );
+
+    mBlockMaps.resize( tNumBlocks, nullptr );
+    mBlockLocalRows.resize( tNumBlocks );
+
+    for ( uint iBlock = 0; iBlock < tNumBlocks; iBlock++ )
+    {
+        const Matrix< DDSMat >& tIds = aBlockRowIds( iBlock );
+
+        mBlockLocalRows( iBlock ).set_size( tIds.numel(), 1 );
+
+        for ( uint iRow = 0; iRow < tIds.numel(); iRow++ )
+        {
+            int tLocalRow = tRowMap.LID( tIds( iRow ) );
+
+            MORIS_ERROR( tLocalRow >= 0,
+                    "Block_Matrix_Epetra::Block_Matrix_Epetra - row %d of block %d is not owned by this processor.",
+                    tIds( iRow ),
+                    iBlock );
+
+            MORIS_ERROR( tRowBlocks[ tLocalRow ] == -1,
+                    "Block_Matrix_Epetra::Block_Matrix_Epetra - row %d is assigned to more than one block.",
+                    tIds( iRow ) );
+
+            tRowBlocks[ tLocalRow ] = iBlock;
+
+            mBlockLocalRows( iBlock )( iRow ) = tLocalRow;
+        }
+
+        // block map with the global ids of the monolithic matrix
+        mBlockMaps( iBlock ) = new Epetra_Map(
+                -1,
+                tIds.numel(),
+                tIds.data(),
+                tRowMap.IndexBase(),
+                tRowMap.Comm() );
+    }
+
+    for ( int iRow = 0; iRow < tRowMap.NumMyElements(); iRow++ )
+    {
+        MORIS_ERROR( tRowBlocks[ iRow ] >= 0,
+                "Block_Matrix_Epetra::Block_Matrix_Epetra - row %d is not assigned to any block.",
+                tRowMap.GID( iRow ) );
+    }
+
+    // communicate block indices of ghosted columns
+    const Epetra_Map& tColMap = mMatrix->ColMap();
+
+    Epetra_IntVector tColumnBlocks( tColMap );
+    Epetra_Import    tImporter( tColMap, tRowMap );
+
+    tColumnBlocks.Import( tRowBlocks, tImporter, Insert );
+
+    mColumnBlocks.set_size( tColMap.NumMyElements(), 1 );
+
+    for ( int iCol = 0; iCol < tColMap.NumMyElements(); iCol++ )
+    {
+        mColumnBlocks( iCol ) = tColumnBlocks[ iCol ];
+    }
+}
+
+// ----------------------------------------------------------------------------------------------------------------------
+
+Block_Matrix_Epetra::~Block_Matrix_Epetra()
+{
+    for ( Epetra_Map* tMap : mBlockMaps )
+    {
+        delete tMap;
+    }
+}
+
+// ----------------------------------------------------------------------------------------------------------------------
+
+Epetra_CrsMatrix*
+Block_Matrix_Epetra::extract_block(
+        const uint aRowBlock,
+        const uint aColBlock ) const
+{
+    MORIS_ASSERT( aRowBlock < this->get_num_blocks() && aColBlock < this->get_num_blocks(),
+            "Block_Matrix_Epetra::extract_block - block index out of bounds." );
+
+    const Epetra_Map& tColMap = mMatrix->ColMap();
+
+    Epetra_CrsMatrix* tBlock = new Epetra_CrsMatrix( Copy, *mBlockMaps( aRowBlock ), 0 );
+
+    Matrix< DDRMat > tValues( mMatrix->MaxNumEntries(), 1 );
+    Matrix< DDSMat > tColumnIds( mMatrix->MaxNumEntries(), 1 );
+
+    const Matrix< DDSMat >& tLocalRows = mBlockLocalRows( aRowBlock );
+
+    for ( uint iRow = 0; iRow < tLocalRows.numel(); iRow++ )
+    {
+        int     tNumEntries;
+        double* tRowValues;
+        int*    tRowColumns;
+
+        mMatrix->ExtractMyRowView( tLocalRows( iRow ), tNumEntries, tRowValues, tRowColumns );
+
+        // collect entries with columns in the requested block
+        int tNumBlockEntries = 0;
+
+        for ( int iEntry = 0; iEntry < tNumEntries; iEntry++ )
+        {
+            if ( mColumnBlocks( tRowColumns[ iEntry ] ) == (sint)aColBlock )
+            {
+                tColumnIds( tNumBlockEntries ) = tColMap.GID( tRowColumns[ iEntry ] );
+                tValues( tNumBlockEntries )    = tRowValues[ iEntry ];
+
+                tNumBlockEntries++;
+            }
+        }
+
+        if ( tNumBlockEntries > 0 )
+        {
+            tBlock->InsertGlobalValues(
+                    mBlockMaps( aRowBlock )->GID( iRow ),
+                    tNumBlockEntries,
+                    tValues.data(),
+                    tColumnIds.data() );
+        }
+    }
+
+    tBlock->FillComplete( *mBlockMaps( aColBlock ), *mBlockMaps( aRowBlock ) );
+
+    return tBlock;
+}
+
+// ----------------------------------------------------------------------------------------------------------------------
+
+Epetra_CrsMatrix*
+Block_Matrix_Epetra::build_approximate_schur_complement() const
+{
+    MORIS_ERROR( this->get_num_blocks() == 2,
+            "Block_Matrix_Epetra::build_approximate_schur_complement - only implemented for two blocks." );
+
+    std::unique_ptr< Epetra_CrsMatrix > tA00( this->extract_block( 0, 0 ) );
+    std::unique_ptr< Epetra_CrsMatrix > tA01( this->extract_block( 0, 1 ) );
+    std::unique_ptr< Epetra_CrsMatrix > tA10( this->extract_block( 1, 0 ) );
+    std::unique_ptr< Epetra_CrsMatrix > tA11( this->extract_block( 1, 1 ) );
+
+    // inverse diagonal of A_00
+    Epetra_Vector tInvDiagonal( *mBlockMaps( 0 ) );
+    tA00->ExtractDiagonalCopy( tInvDiagonal );
+
+    for ( int iRow = 0; iRow < tInvDiagonal.MyLength(); iRow++ )
+    {
+        MORIS_ERROR( tInvDiagonal[ iRow ] != 0.0,
+                "Block_Matrix_Epetra::build_approximate_schur_complement - zero diagonal entry in row %d of block 0.",
+                mBlockMaps( 0 )->GID( iRow ) );
+
+        tInvDiagonal[ iRow ] = 1.0 / tInvDiagonal[ iRow ];
+    }
+
+    // diag(A_00)^-1 A_01
+    tA01->LeftScale( tInvDiagonal );
+
+    // import rows of scaled A_01 which are needed for the product with the local columns of A_10
+    Epetra_Import    tImporter( tA10->ColMap(), *mBlockMaps( 0 ) );
+    Epetra_CrsMatrix tScaledA01( Copy, tA10->ColMap(), 0 );
+
+    tScaledA01.Import( *tA01, tImporter, Insert );
+
+    // compute rows of the Schur complement
+    Epetra_CrsMatrix* tSchur = new Epetra_CrsMatrix( Copy, *mBlockMaps( 1 ), 0 );
+
+    Matrix< DDRMat > tValues;
+    Matrix< DDSMat > tColumnIds;
+
+    for ( int iRow = 0; iRow < mBlockMaps( 1 )->NumMyElements(); iRow++ )
+    {
+        std::map< int, real > tSchurRow;
+
+        int     tNumEntries;
+        double* tRowValues;
+        int*    tRowColumns;
+
+        // A_11
+        tA11->ExtractMyRowView( iRow, tNumEntries, tRowValues, tRowColumns );
+
+        for ( int iEntry = 0; iEntry < tNumEntries; iEntry++ )
+        {
+            tSchurRow[ tA11->ColMap().GID( tRowColumns[ iEntry ] ) ] += tRowValues[ iEntry ];
+        }
+
+        // - A_10 diag(A_00)^-1 A_01
+        tA10->ExtractMyRowView( iRow, tNumEntries, tRowValues, tRowColumns );
+
+        for ( int iEntry = 0; iEntry < tNumEntries; iEntry++ )
+        {
+            int     tNumScaledEntries = 0;
+            double* tScaledValues     = nullptr;
+            int*    tScaledColumns    = nullptr;
+
+            tScaledA01.ExtractGlobalRowView(
+                    tA10->ColMap().GID( tRowColumns[ iEntry ] ),
+                    tNumScaledEntries,
+                    tScaledValues,
+                    tScaledColumns );
+
+            for ( int iScaled = 0; iScaled < tNumScaledEntries; iScaled++ )
+            {
+                tSchurRow[ tScaledColumns[ iScaled ] ] -= tRowValues[ iEntry ] * tScaledValues[ iScaled ];
+            }
+        }
+
+        tValues.set_size( tSchurRow.size(), 1 );
+        tColumnIds.set_size( tSchurRow.size(), 1 );
+
+        uint tCounter = 0;
+
+        for ( const auto& tEntry : tSchurRow )
+        {
+            tColumnIds( tCounter ) = tEntry.first;
+            tValues( tCounter )    = tEntry.second;
+
+            tCounter++;
+        }
+
+        if ( tCounter > 0 )
+        {
+            tSchur->InsertGlobalValues(
+                    mBlockMaps( 1 )->GID( iRow ),
+                    tCounter,
+                    tValues.data(),
+                    tColumnIds.data() );
+        }
+    }
+
+    tSchur->FillComplete( *mBlockMaps( 1 ), *mBlockMaps( 1 ) );
+
+    return tSchur;
+}
+
+// ----------------------------------------------------------------------------------------------------------------------
+
+void
+Block_Matrix_Epetra::extract_block_vector(
+        const Epetra_MultiVector& aVector,
+        const uint                aBlock,
+        Epetra_MultiVector&       aBlockVector ) const
+{
+    const Matrix< DDSMat >& tLocalRows = mBlockLocalRows( aBlock );
+
+    for ( int iVec = 0; iVec < aVector.NumVectors(); iVec++ )
+    {
+        for ( uint iRow = 0; iRow < tLocalRows.numel(); iRow++ )
+        {
+            aBlockVector[ iVec ][ iRow ] = aVector[ iVec ][ tLocalRows( iRow ) ];
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------------------------------------------------
+
+void
+Block_Matrix_Epetra::insert_block_vector(
+        const Epetra_MultiVector& aBlockVector,
+        const uint                aBlock,
+        Epetra_MultiVector&       aVector ) const
+{
+    const Matrix< DDSMat >& tLocalRows = mBlockLocalRows( aBlock );
+
+    for ( int iVec = 0; iVec < aVector.NumVectors(); iVec++ )
+    {
+        for ( uint iRow = 0; iRow < tLocalRows.numel(); iRow++ )
+        {
+            aVector[ iVec ][ tLocalRows( iRow ) ] = aBlockVector[ iVec ][ iRow ];
+        }
+    }
+}
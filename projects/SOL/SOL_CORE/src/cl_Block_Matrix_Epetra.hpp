@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_Block_Matrix_Epetra.hpp
+ *
+ */
+
+#ifndef SRC_DISTLINALG_CL_BLOCK_MATRIX_EPETRA_HPP_
+#define SRC_DISTLINALG_CL_BLOCK_MATRIX_EPETRA_HPP_
+
+// MORIS header files.
+#include "cl_Matrix.hpp"
+#include "linalg_typedefs.hpp"
+#include "cl_Cell.hpp"
+
+// TPL header files
+#include "Epetra_CrsMatrix.h"
+#include "Epetra_MultiVector.h"
+#include "Epetra_Map.h"
+
+namespace moris
+{
+    /**
+     * Block view of an assembled Epetra matrix, e.g. for multi-physics problems with one block
+     * per group of dof types. Each block is defined by the global row ids owned by this processor.
+     * The blocks have to partition the rows of the matrix; the global ids of the blocks are the
+     * ones of the monolithic matrix such that no renumbering is needed.
+     *
+     * Sub-blocks are extracted as Epetra_CrsMatrix objects with block row and domain maps and can be
+     * used to build field-split preconditioners. Block vectors are local copies of the corresponding
+     * entries of a monolithic vector.
+     */
+    class Block_Matrix_Epetra
+    {
+      private:
+        // monolithic matrix, needs to be filled
+        const Epetra_CrsMatrix* mMatrix = nullptr;
+
+        // row maps of the blocks
+        moris::Cell< Epetra_Map* > mBlockMaps;
+
+        // local row indices in the monolithic matrix for each block
+        moris::Cell< Matrix< DDSMat > > mBlockLocalRows;
+
+        // block index of each local column of the monolithic matrix
+        Matrix< DDSMat > mColumnBlocks;
+
+      public:
+        //---------------------------------------------------------------------------------
+
+        /**
+         * constructor
+         *
+         * @param aMatrix Assembled and filled monolithic matrix
+         * @param aBlockRowIds Global row ids owned by this processor, one list per block
+         */
+        Block_Matrix_Epetra(
+                const Epetra_CrsMatrix*                aMatrix,
+                const moris::Cell< Matrix< DDSMat > >& aBlockRowIds );
+
+        //---------------------------------------------------------------------------------
+
+        ~Block_Matrix_Epetra();
+
+        //---------------------------------------------------------------------------------
+
+        uint
+        get_num_blocks() const
+        {
+            return mBlockMaps.size();
+        }
+
+        //---------------------------------------------------------------------------------
+
+        const Epetra_Map&
+        get_block_map( const uint aBlock ) const
+        {
+            return *mBlockMaps( aBlock );
+        }
+
+        //---------------------------------------------------------------------------------
+
+        const Epetra_CrsMatrix&
+        get_matrix() const
+        {
+            return *mMatrix;
+        }
+
+        //---------------------------------------------------------------------------------
+
+        /**
+         * extracts sub-block A_ij of the monolithic matrix; the caller takes ownership
+         *
+         * @param aRowBlock Block index i
+         * @param aColBlock Block index j
+         * @return Filled matrix with row map of block i and domain map of block j
+         */
+        Epetra_CrsMatrix* extract_block(
+                const uint aRowBlock,
+                const uint aColBlock ) const;
+
+        //---------------------------------------------------------------------------------
+
+        /**
+         * builds the approximate Schur complement S = A_11 - A_10 diag(A_00)^-1 A_01 of a two block
+         * matrix; the caller takes ownership
+         *
+         * @return Filled matrix with row and domain map of block 1
+         */
+        Epetra_CrsMatrix* build_approximate_schur_complement() const;
+
+        //---------------------------------------------------------------------------------
+
+        /**
+         * copies the entries of a block from a monolithic vector
+         *
+         * @param aVector Vector with the row map of the monolithic matrix
+         * @param aBlock Block index
+         * @param aBlockVector Vector with the map of the block
+         */
+        void extract_block_vector(
+                const Epetra_MultiVector& aVector,
+                const uint                aBlock,
+                Epetra_MultiVector&       aBlockVector ) const;
+
+        //---------------------------------------------------------------------------------
+
+        /**
+         * copies the entries of a block vector into a monolithic vector
+         *
+         * @param aBlockVector Vector with the map of the block
+         * @param aBlock Block index
+         * @param aVector Vector with the row map of the monolithic matrix
+         */
+        void insert_block_vector(
+                const Epetra_MultiVector& aBlockVector,
+                const uint                aBlock,
+                Epetra_MultiVector&       aVector ) const;
+    };
+}    // namespace moris
+
+#endif /* SRC_DISTLINALG_CL_BLOCK_MATRIX_EPETRA_HPP_ */
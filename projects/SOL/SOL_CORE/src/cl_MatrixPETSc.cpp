@@ -350,3 +350,20 @@ Matrix_PETSc::build_graph(
     // note: if there is a problem with this routine turn this option off at the cost of performance
     // MatSetOption(mPETScMat,  MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_FALSE);
 }
+
+// ----------------------------------------------------------------------------
+
+void
+Matrix_PETSc::translate_ids_to_row_ids(
+        const Matrix< DDSMat >& aDofIds,
+        Matrix< DDSMat >&       aRowIds )
+{
+    // create copy of vector with moris IDs; will be overwritten in AOApplicationToPetsc
+    aRowIds = aDofIds;
+
+    // map moris IDs into petsc IDs
+    AOApplicationToPetsc(
+            mMap->get_petsc_map(),
+            aRowIds.numel(),
+            aRowIds.data() );
+}
@@ -152,6 +152,18 @@ namespace moris
                 Cell< moris_id >& aNonZeroDiagonal,
                 Cell< moris_id >& aNonZeroOffDiagonal ) override;
 
+        // ----------------------------------------------------------------------------
+
+        /**
+         * @brief translates moris dof ids into PETSc row ids using the application ordering of the map
+         *
+         * @param aDofIds moris dof ids
+         * @param aRowIds PETSc row ids
+         */
+        void translate_ids_to_row_ids(
+                const Matrix< DDSMat >& aDofIds,
+                Matrix< DDSMat >&       aRowIds ) override;
+
         // void BuildSparseGraph(int numElements = 5);
 
         // Mat get_petsc_matrix()       { return mPETScMat; }
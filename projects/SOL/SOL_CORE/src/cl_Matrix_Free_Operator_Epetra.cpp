@@ -0,0 +1,446 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_Matrix_Free_Operator_Epetra.cpp
+ *
+ */
+
+#include "cl_Matrix_Free_Operator_Epetra.hpp"
+#include "cl_DLA_Solver_Interface.hpp"
+
+#include "Epetra_MultiVector.h"
+
+#include <algorithm>
+
+using namespace moris;
+
+// ----------------------------------------------------------------------------------------------------------------------
+
+Matrix_Free_Operator_Epetra::Matrix_Free_Operator_Epetra(
+        Solver_Interface* aInput,
+        sol::Dist_Map*    aMap,
+        bool              aPointMap )
+        : sol::Dist_Matrix( aMap )
+        , mSolverInterface( aInput )
+        , mMatBuildWithPointMap( aPointMap )
+{
+    mDiagonal = new Epetra_FEVector( this->get_row_map() );
+}
+
+// ----------------------------------------------------------------------------------------------------------------------
+
+Matrix_Free_Operator_Epetra::~Matrix_Free_Operator_Epetra()
+{
+    delete mDiagonal;
+    delete mImporter;
+    delete mOverlappingMap;
+}
+
+// ----------------------------------------------------------------------------------------------------------------------
+
+const Epetra_Map&
+Matrix_Free_Operator_Epetra::get_row_map() const
+{
+    if ( mMatBuildWithPointMap )
+    {
+        return *mMap->get_epetra_point_map();
+    }
+
+    return *mMap->get_epetra_map();
+}
+
+// ----------------------------------------------------------------------------------------------------------------------
+
+void
+Matrix_Free_Operator_Epetra::translate_ids(
+        const moris::Matrix< DDSMat >& aEleDofConnectivity,
+        moris::Matrix< IdMat >&        aRowIds,
+        const bool                     aIsBuildGraph ) const
+{
+    if ( mMatBuildWithPointMap )
+    {
+        mMap->translate_ids_to_free_point_ids( aEleDofConnectivity, aRowIds, aIsBuildGraph );
+    }
+    else
+    {
+        aRowIds = aEleDofConnectivity;
+    }
+}
+
+// ----------------------------------------------------------------------------------------------------------------------
+
+void
+Matrix_Free_Operator_Epetra::fill_matrix(
+        const moris::uint&             aNumMyDofs,
+        const moris::Matrix< DDRMat >& aA_val,
+        const moris::Matrix< DDSMat >& aEleDofConnectivity )
+{
+    Matrix< IdMat > tRowIds;
+    this->translate_ids( aEleDofConnectivity, tRowIds, true );
+
+    // collect diagonal entries of free dofs, element matrix is stored column major
+    Matrix< IdMat >  tFreeRowIds( aNumMyDofs, 1 );
+    Matrix< DDRMat > tDiagonalValues( aNumMyDofs, 1 );
+
+    uint tNumFreeDofs = 0;
+
+    for ( uint Ik = 0; Ik < aNumMyDofs; Ik++ )
+    {
+        // skip dofs which are not rows of the matrix
+        if ( tRowIds( Ik ) < 0 || tRowIds( Ik ) == MORIS_ID_MAX
+                || ( mOverlappingMap != nullptr && !mOverlappingMap->MyGID( tRowIds( Ik ) ) ) )
+        {
+            continue;
+        }
+
+        tFreeRowIds( tNumFreeDofs )     = tRowIds( Ik );
+        tDiagonalValues( tNumFreeDofs ) = aA_val.data()[ Ik * aNumMyDofs + Ik ];
+        tNumFreeDofs++;
+    }
+
+    int tError = mDiagonal->SumIntoGlobalValues(
+            tNumFreeDofs,
+            tFreeRowIds.data(),
+            tDiagonalValues.data() );
+
+    MORIS_ERROR( tError >= 0,
+            "Matrix_Free_Operator_Epetra::fill_matrix - summing diagonal values failed" );
+}
+
+// ----------------------------------------------------------------------------------------------------------------------
+
+void
+Matrix_Free_Operator_Epetra::insert_values(
+        const Matrix< DDSMat >& aRowIDs,
+        const Matrix< DDSMat >& aColumnIDs,
+        const Matrix< DDRMat >& aMatrixValues )
+{
+    MORIS_ERROR( false, "Matrix_Free_Operator_Epetra::insert_values - matrix entries are not stored" );
+}
+
+// ----------------------------------------------------------------------------------------------------------------------
+
+void
+Matrix_Free_Operator_Epetra::sum_into_values(
+        const Matrix< DDSMat >& aRowIDs,
+        const Matrix< DDSMat >& aColumnIDs,
+        const Matrix< DDRMat >& aMatrixValues )
+{
+    MORIS_ERROR( false, "Matrix_Free_Operator_Epetra::sum_into_values - matrix entries are not stored" );
+}
+
+// ----------------------------------------------------------------------------------------------------------------------
+
+void
+Matrix_Free_Operator_Epetra::get_matrix_values(
+        const moris::Matrix< DDSMat >& aRequestedIds,
+        moris::Matrix< DDRMat >&       aValues )
+{
+    MORIS_ERROR( false, "Matrix_Free_Operator_Epetra::get_matrix_values - matrix entries are not stored" );
+}
+
+// ----------------------------------------------------------------------------------------------------------------------
+
+void
+Matrix_Free_Operator_Epetra::matrix_global_assembly()
+{
+    // ship diagonal entries of shared dofs to their owners
+    int tError = mDiagonal->GlobalAssemble();
+
+    MORIS_ERROR( tError == 0,
+            "Matrix_Free_Operator_Epetra::matrix_global_assembly - assembly of diagonal failed" );
+}
+
+// ----------------------------------------------------------------------------------------------------------------------
+
+void
+Matrix_Free_Operator_Epetra::initial_matrix_global_assembly()
+{
+    // collect unique row ids of all element dofs on this processor
+    std::vector< int > tIds;
+
+    for ( uint Ie = 0; Ie < mElementRowIds.size(); Ie++ )
+    {
+        for ( uint Ik = 0; Ik < mElementRowIds( Ie ).numel(); Ik++ )
+        {
+            if ( mElementRowIds( Ie )( Ik ) >= 0 && mElementRowIds( Ie )( Ik ) != MORIS_ID_MAX )
+            {
+                tIds.push_back( mElementRowIds( Ie )( Ik ) );
+            }
+        }
+    }
+
+    std::sort( tIds.begin(), tIds.end() );
+    tIds.erase( std::unique( tIds.begin(), tIds.end() ), tIds.end() );
+
+    // remove ids which are not rows of the matrix (collective)
+    const Epetra_Map& tRowMap = this->get_row_map();
+
+    std::vector< int > tOwners( tIds.size() );
+    std::vector< int > tLocalIds( tIds.size() );
+
+    tRowMap.RemoteIDList( (int)tIds.size(), tIds.data(), tOwners.data(), tLocalIds.data() );
+
+    uint tNumIds = 0;
+    for ( uint Ik = 0; Ik < tIds.size(); Ik++ )
+    {
+        if ( tOwners[ Ik ] >= 0 )
+        {
+            tIds[ tNumIds++ ] = tIds[ Ik ];
+        }
+    }
+    tIds.resize( tNumIds );
+
+    // build overlapping map and importer
+    delete mImporter;
+    delete mOverlappingMap;
+
+    mOverlappingMap = new Epetra_Map( -1, (int)tIds.size(), tIds.data(), 0, tRowMap.Comm() );
+    mImporter       = new Epetra_Import( *mOverlappingMap, tRowMap );
+
+    // translate element row ids into local indices of the overlapping map
+    mElementLocalIndices.resize( mElementRowIds.size() );
+
+    for ( uint Ie = 0; Ie < mElementRowIds.size(); Ie++ )
+    {
+        uint tNumDofs = mElementRowIds( Ie ).numel();
+
+        mElementLocalIndices( Ie ).set_size( tNumDofs, 1, -1 );
+
+        for ( uint Ik = 0; Ik < tNumDofs; Ik++ )
+        {
+            if ( mElementRowIds( Ie )( Ik ) >= 0 && mElementRowIds( Ie )( Ik ) != MORIS_ID_MAX )
+            {
+                mElementLocalIndices( Ie )( Ik ) = mOverlappingMap->LID( mElementRowIds( Ie )( Ik ) );
+            }
+        }
+    }
+
+    mElementRowIds.clear();
+
+    mDiagonal->PutScalar( 0.0 );
+}
+
+// ----------------------------------------------------------------------------------------------------------------------
+
+void
+Matrix_Free_Operator_Epetra::dirichlet_BC_vector(
+        moris::Matrix< DDUMat >&       aDirichletBCVec,
+        const moris::Matrix< DDUMat >& aMyConstraintDofs )
+{
+    MORIS_ERROR( false, "Matrix_Free_Operator_Epetra::dirichlet_BC_vector - not implemented" );
+}
+
+// ----------------------------------------------------------------------------------------------------------------------
+
+void
+Matrix_Free_Operator_Epetra::build_graph(
+        const moris::uint&             aNumMyDofs,
+        const moris::Matrix< DDSMat >& aElementTopology )
+{
+    Matrix< IdMat > tRowIds;
+    this->translate_ids( aElementTopology, tRowIds, true );
+
+    mElementRowIds.push_back( tRowIds );
+}
+
+// ----------------------------------------------------------------------------------------------------------------------
+
+void
+Matrix_Free_Operator_Epetra::get_diagonal( sol::Dist_Vector& aDiagVec ) const
+{
+    int tError = dynamic_cast< Vector_Epetra& >( aDiagVec ).get_epetra_vector()->Update( 1.0, *mDiagonal, 0.0 );
+
+    MORIS_ERROR( tError == 0,
+            "Matrix_Free_Operator_Epetra::get_diagonal - copying diagonal failed" );
+}
+
+// ----------------------------------------------------------------------------------------------------------------------
+
+void
+Matrix_Free_Operator_Epetra::mat_put_scalar( const moris::real& aValue )
+{
+    mDiagonal->PutScalar( aValue );
+}
+
+// ----------------------------------------------------------------------------------------------------------------------
+
+void
+Matrix_Free_Operator_Epetra::sparse_mat_left_scale( const sol::Dist_Vector& aScaleVector )
+{
+    MORIS_ERROR( false, "Matrix_Free_Operator_Epetra::sparse_mat_left_scale - matrix entries are not stored" );
+}
+
+// ----------------------------------------------------------------------------------------------------------------------
+
+void
+Matrix_Free_Operator_Epetra::sparse_mat_right_scale( const sol::Dist_Vector& aScaleVector )
+{
+    MORIS_ERROR( false, "Matrix_Free_Operator_Epetra::sparse_mat_right_scale - matrix entries are not stored" );
+}
+
+// ----------------------------------------------------------------------------------------------------------------------
+
+void
+Matrix_Free_Operator_Epetra::replace_diagonal_values( const sol::Dist_Vector& aDiagVec )
+{
+    MORIS_ERROR( false, "Matrix_Free_Operator_Epetra::replace_diagonal_values - matrix entries are not stored" );
+}
+
+// ----------------------------------------------------------------------------------------------------------------------
+
+void
+Matrix_Free_Operator_Epetra::apply_element_operators(
+        const Epetra_MultiVector& aX,
+        Epetra_MultiVector&       aY,
+        const bool                aUseTranspose ) const
+{
+    MORIS_ERROR( mImporter != nullptr,
+            "Matrix_Free_Operator_Epetra::apply_element_operators - graph has not been built" );
+
+    int tNumVectors = aX.NumVectors();
+
+    // import input entries of all element dofs
+    Epetra_MultiVector tXOverlap( *mOverlappingMap, tNumVectors );
+    Epetra_MultiVector tYOverlap( *mOverlappingMap, tNumVectors );
+
+    tXOverlap.Import( aX, *mImporter, Insert );
+
+    Matrix< DDRMat > tElementMatrix;
+
+    // running index of the equation object, same order as in build_graph()
+    uint tElementIndex = 0;
+
+    uint tNumBlocks = mSolverInterface->get_num_my_blocks();
+
+    for ( uint Ii = 0; Ii < tNumBlocks; Ii++ )
+    {
+        uint tNumEquationObjectOnSet = mSolverInterface->get_num_equation_objects_on_set( Ii );
+
+        mSolverInterface->initialize_set( Ii, false );
+
+        for ( uint Ik = 0; Ik < tNumEquationObjectOnSet; Ik++ )
+        {
+            MORIS_ASSERT( tElementIndex < mElementLocalIndices.size(),
+                    "Matrix_Free_Operator_Epetra::apply_element_operators - more equation objects than in graph" );
+
+            const Matrix< DDSMat >& tLocalIndices = mElementLocalIndices( tElementIndex++ );
+
+            mSolverInterface->get_equation_object_operator( Ii, Ik, tElementMatrix );
+
+            if ( tElementMatrix.numel() == 0 )
+            {
+                continue;
+            }
+
+            uint tNumDofs = tLocalIndices.numel();
+
+            MORIS_ASSERT( tElementMatrix.numel() == tNumDofs * tNumDofs,
+                    "Matrix_Free_Operator_Epetra::apply_element_operators - element matrix does not match topology" );
+
+            // element matrix is stored column major
+            const real* tValues = tElementMatrix.data();
+
+            for ( sint iVec = 0; iVec < tNumVectors; iVec++ )
+            {
+                const real* tX = tXOverlap[ iVec ];
+                real*       tY = tYOverlap[ iVec ];
+
+                for ( uint iRow = 0; iRow < tNumDofs; iRow++ )
+                {
+                    if ( tLocalIndices( iRow ) < 0 )
+                    {
+                        continue;
+                    }
+
+                    real tSum = 0.0;
+
+                    for ( uint iCol = 0; iCol < tNumDofs; iCol++ )
+                    {
+                        if ( tLocalIndices( iCol ) < 0 )
+                        {
+                            continue;
+                        }
+
+                        real tValue = aUseTranspose ? tValues[ iRow * tNumDofs + iCol ] : tValues[ iCol * tNumDofs + iRow ];
+
+                        tSum += tValue * tX[ tLocalIndices( iCol ) ];
+                    }
+
+                    tY[ tLocalIndices( iRow ) ] += tSum;
+                }
+            }
+        }
+
+        mSolverInterface->free_block_memory( Ii );
+    }
+
+    // sum contributions of shared dofs on their owners
+    aY.PutScalar( 0.0 );
+
+    aY.Export( tYOverlap, *mImporter, Add );
+}
+
+// ----------------------------------------------------------------------------------------------------------------------
+
+int
+Matrix_Free_Operator_Epetra::Apply(
+        const Epetra_MultiVector& aX,
+        Epetra_MultiVector&       aY ) const
+{
+    this->apply_element_operators( aX, aY, mUseTranspose );
+
+    return 0;
+}
+
+// ----------------------------------------------------------------------------------------------------------------------
+
+void
+Matrix_Free_Operator_Epetra::mat_vec_product(
+        const moris::sol::Dist_Vector& aInputVec,
+        moris::sol::Dist_Vector&       aResult,
+        const bool                     aUseTranspose )
+{
+    this->apply_element_operators(
+            *dynamic_cast< const Vector_Epetra& >( aInputVec ).get_epetra_vector(),
+            *dynamic_cast< Vector_Epetra& >( aResult ).get_epetra_vector(),
+            aUseTranspose );
+}
+
+// ----------------------------------------------------------------------------------------------------------------------
+
+void
+Matrix_Free_Operator_Epetra::print() const
+{
+    std::cout << "Matrix_Free_Operator_Epetra, diagonal:" << std::endl;
+    std::cout << *mDiagonal << std::endl;
+}
+
+// ----------------------------------------------------------------------------------------------------------------------
+
+void
+Matrix_Free_Operator_Epetra::save_matrix_to_matlab_file( const char* aFilename )
+{
+    MORIS_ERROR( false, "Matrix_Free_Operator_Epetra::save_matrix_to_matlab_file - matrix entries are not stored" );
+}
+
+// ----------------------------------------------------------------------------------------------------------------------
+
+void
+Matrix_Free_Operator_Epetra::save_matrix_to_matrix_market_file( const char* aFilename )
+{
+    MORIS_ERROR( false, "Matrix_Free_Operator_Epetra::save_matrix_to_matrix_market_file - matrix entries are not stored" );
+}
+
+// ----------------------------------------------------------------------------------------------------------------------
+
+void
+Matrix_Free_Operator_Epetra::save_matrix_map_to_matrix_market_file( const char* aFilename )
+{
+    EpetraExt::BlockMapToMatrixMarketFile( aFilename, this->get_row_map() );
+}
+
+// ----------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_Matrix_Free_Operator_Epetra.hpp
+ *
+ */
+
+#ifndef SRC_DISTLINALG_CL_MATRIX_FREE_OPERATOR_EPETRA_HPP_
+#define SRC_DISTLINALG_CL_MATRIX_FREE_OPERATOR_EPETRA_HPP_
+
+// MORIS header files.
+#include "cl_Matrix.hpp"
+#include "linalg_typedefs.hpp"
+
+#include "cl_Map_Epetra.hpp"
+#include "cl_SOL_Dist_Matrix.hpp"
+#include "cl_Vector_Epetra.hpp"
+
+// TPL header files
+#include "Epetra_Operator.h"
+#include "Epetra_FEVector.h"
+#include "Epetra_Import.h"
+
+namespace moris
+{
+    /**
+     * Distributed matrix which does not store its entries. The product with a vector is computed by
+     * looping over the equation objects of the solver interface and applying the element matrices,
+     * which are recomputed in every product. Only the diagonal is assembled, e.g. for Jacobi or
+     * Chebyshev preconditioning.
+     *
+     * The matrix is also an Epetra_Operator such that it can be passed to Belos and AztecOO.
+     * Preconditioners requiring matrix entries (ILU, ML, Amesos) cannot be used.
+     */
+    class Matrix_Free_Operator_Epetra
+            : public sol::Dist_Matrix
+            , public Epetra_Operator
+    {
+      private:
+        // solver interface providing the element matrices
+        Solver_Interface* mSolverInterface = nullptr;
+
+        // flag whether the matrix is built on the point map
+        const bool mMatBuildWithPointMap = false;
+
+        // assembled diagonal
+        Epetra_FEVector* mDiagonal = nullptr;
+
+        // row ids of the element dofs collected while building the graph, one entry per equation object
+        moris::Cell< Matrix< IdMat > > mElementRowIds;
+
+        // local indices of the element dofs in the overlapping map, -1 for dofs not in the matrix
+        moris::Cell< Matrix< DDSMat > > mElementLocalIndices;
+
+        // map of all rows touched by equation objects of this processor and importer from the row map
+        Epetra_Map*    mOverlappingMap = nullptr;
+        Epetra_Import* mImporter       = nullptr;
+
+        // flag whether the transpose is applied by Apply()
+        bool mUseTranspose = false;
+
+        //------------------------------------------------------------------------------
+
+        /**
+         * returns the row map of the matrix
+         */
+        const Epetra_Map& get_row_map() const;
+
+        //------------------------------------------------------------------------------
+
+        /**
+         * translates element dof ids into row ids of the matrix
+         *
+         * @param aEleDofConnectivity Element dof ids
+         * @param aRowIds Row ids, MORIS_ID_MAX or -1 for dofs not in the matrix
+         * @param aIsBuildGraph Flag passed to the dof translator
+         */
+        void translate_ids(
+                const moris::Matrix< DDSMat >& aEleDofConnectivity,
+                moris::Matrix< IdMat >&        aRowIds,
+                const bool                     aIsBuildGraph ) const;
+
+        //------------------------------------------------------------------------------
+
+        /**
+         * computes aY = A * aX or aY = A^T * aX by applying the element matrices
+         */
+        void apply_element_operators(
+                const Epetra_MultiVector& aX,
+                Epetra_MultiVector&       aY,
+                const bool                aUseTranspose ) const;
+
+        //------------------------------------------------------------------------------
+
+      public:
+        //------------------------------------------------------------------------------
+
+        Matrix_Free_Operator_Epetra(
+                Solver_Interface* aInput,
+                sol::Dist_Map*    aMap,
+                bool              aPointMap = false );
+
+        //------------------------------------------------------------------------------
+
+        ~Matrix_Free_Operator_Epetra();
+
+        //------------------------------------------------------------------------------
+        // sol::Dist_Matrix interface
+        //------------------------------------------------------------------------------
+
+        /**
+         * Sums the diagonal of an element matrix into the assembled diagonal.
+         */
+        void fill_matrix(
+                const moris::uint&             aNumMyDofs,
+                const moris::Matrix< DDRMat >& aA_val,
+                const moris::Matrix< DDSMat >& aEleDofConnectivity );
+
+        void insert_values(
+                const Matrix< DDSMat >& aRowIDs,
+                const Matrix< DDSMat >& aColumnIDs,
+                const Matrix< DDRMat >& aMatrixValues );
+
+        void sum_into_values(
+                const Matrix< DDSMat >& aRowIDs,
+                const Matrix< DDSMat >& aColumnIDs,
+                const Matrix< DDRMat >& aMatrixValues );
+
+        void get_matrix_values(
+                const moris::Matrix< DDSMat >& aRequestedIds,
+                moris::Matrix< DDRMat >&       aValues );
+
+        void matrix_global_assembly();
+
+        /**
+         * Builds the overlapping map of the element dofs. Requires build_graph() to be called for
+         * all equation objects in the order in which the solver interface loops over them.
+         */
+        void initial_matrix_global_assembly();
+
+        void dirichlet_BC_vector(
+                moris::Matrix< DDUMat >&       aDirichletBCVec,
+                const moris::Matrix< DDUMat >& aMyConstraintDofs );
+
+        /**
+         * Stores the element dof ids of the next equation object.
+         */
+        void build_graph(
+                const moris::uint&             aNumMyDofs,
+                const moris::Matrix< DDSMat >& aElementTopology );
+
+        void get_diagonal( moris::sol::Dist_Vector& aDiagVec ) const;
+
+        /**
+         * Sets all entries of the assembled diagonal to a value.
+         */
+        void mat_put_scalar( const moris::real& aValue );
+
+        void sparse_mat_left_scale( const moris::sol::Dist_Vector& aScaleVector );
+
+        void sparse_mat_right_scale( const moris::sol::Dist_Vector& aScaleVector );
+
+        void replace_diagonal_values( const moris::sol::Dist_Vector& aDiagVec );
+
+        void mat_vec_product(
+                const moris::sol::Dist_Vector& aInputVec,
+                moris::sol::Dist_Vector&       aResult,
+                const bool                     aUseTranspose );
+
+        void print() const;
+
+        void save_matrix_to_matlab_file( const char* aFilename );
+
+        void save_matrix_to_matrix_market_file( const char* aFilename );
+
+        void save_matrix_map_to_matrix_market_file( const char* aFilename );
+
+        Epetra_Operator*
+        get_operator()
+        {
+            return this;
+        }
+
+        bool
+        is_matrix_free() const
+        {
+            return true;
+        }
+
+        //------------------------------------------------------------------------------
+        // Epetra_Operator interface
+        //------------------------------------------------------------------------------
+
+        int
+        SetUseTranspose( bool aUseTranspose )
+        {
+            mUseTranspose = aUseTranspose;
+            return 0;
+        }
+
+        int Apply(
+                const Epetra_MultiVector& aX,
+                Epetra_MultiVector&       aY ) const;
+
+        int
+        ApplyInverse(
+                const Epetra_MultiVector& aX,
+                Epetra_MultiVector&       aY ) const
+        {
+            return -1;
+        }
+
+        double
+        NormInf() const
+        {
+            return 0.0;
+        }
+
+        const char*
+        Label() const
+        {
+            return "Matrix_Free_Operator_Epetra";
+        }
+
+        bool
+        UseTranspose() const
+        {
+            return mUseTranspose;
+        }
+
+        bool
+        HasNormInf() const
+        {
+            return false;
+        }
+
+        const Epetra_Comm&
+        Comm() const
+        {
+            return this->get_row_map().Comm();
+        }
+
+        const Epetra_Map&
+        OperatorDomainMap() const
+        {
+            return this->get_row_map();
+        }
+
+        const Epetra_Map&
+        OperatorRangeMap() const
+        {
+            return this->get_row_map();
+        }
+    };
+}    // namespace moris
+
+#endif /* SRC_DISTLINALG_CL_MATRIX_FREE_OPERATOR_EPETRA_HPP_ */
@@ -37,6 +37,7 @@
 #endif
 
 #include "cl_SOL_Enums.hpp"
+#include "cl_SOL_Matrix_Graph.hpp"
 namespace moris
 {
     namespace sol
@@ -82,6 +83,26 @@ namespace moris
                     const moris::Matrix< DDRMat >& aA_val,
                     const moris::Matrix< DDSMat >& aEleDofConnectivity ) = 0;
 
+            /**
+             * Sums an element matrix into the matrix. The assembly slot identifies the equation object
+             * such that implementations can cache the location of the element entries in the matrix
+             * storage. The element dof connectivity of a slot must not change for the lifetime of the matrix.
+             *
+             * @param aAssemblySlot Running index of the equation object over all sets
+             * @param aNumDofs Number of element dofs
+             * @param aA_val Element matrix
+             * @param aEleDofConnectivity Element dof ids
+             */
+            virtual void
+            fill_matrix_cached(
+                    const moris::uint              aAssemblySlot,
+                    const moris::uint&             aNumDofs,
+                    const moris::Matrix< DDRMat >& aA_val,
+                    const moris::Matrix< DDSMat >& aEleDofConnectivity )
+            {
+                this->fill_matrix( aNumDofs, aA_val, aEleDofConnectivity );
+            }
+
             /**
              * Inserts values into the matrix at locations corresponding to the given row and column IDs.
              *
@@ -126,6 +147,29 @@ namespace moris
                     const moris::uint&             aNumDofs,
                     const moris::Matrix< DDSMat >& aEleDofConnectivity ) = 0;
 
+            /**
+             * Returns the finalized graph of the matrix such that it can be reused by other matrices
+             *
+             * @return Graph, nullptr if not supported
+             */
+            virtual std::shared_ptr< Matrix_Graph >
+            get_graph()
+            {
+                return nullptr;
+            }
+
+            /**
+             * Creates the matrix from a graph built previously, replaces build_graph() and initial_matrix_global_assembly()
+             *
+             * @param aGraph Finalized matrix graph
+             * @return true if the graph was used, false if it is not compatible with this matrix
+             */
+            virtual bool
+            set_graph( const std::shared_ptr< Matrix_Graph >& aGraph )
+            {
+                return false;
+            }
+
             virtual void get_diagonal( moris::sol::Dist_Vector& aDiagVec ) const = 0;
 
             virtual void mat_put_scalar( const moris::real& aValue ) = 0;
@@ -157,6 +201,28 @@ namespace moris
                 return mEpetraMat;
             }
 
+            /**
+             * Returns the operator to be used by iterative solvers. For assembled matrices this is the
+             * Epetra matrix, matrix-free implementations return an operator applying the element matrices.
+             *
+             * @return Epetra operator
+             */
+            virtual Epetra_Operator*
+            get_operator()
+            {
+                return mEpetraMat;
+            }
+
+            /**
+             * Returns whether the matrix entries are stored. If not, only get_operator(), mat_vec_product()
+             * and get_diagonal() can be used.
+             */
+            virtual bool
+            is_matrix_free() const
+            {
+                return false;
+            }
+
 #ifdef MORIS_HAVE_PETSC
             Mat
             get_petsc_matrix()
@@ -180,6 +246,24 @@ namespace moris
             {
                 MORIS_ERROR( false, "build_graph does not have an implementation in the base class" );
             }
+
+            //---------------------------------------------------------------------------------
+
+            /**
+             * @brief translates dof ids into the global row ids of the matrix, e.g. to build
+             * row maps of sub-blocks for field-split preconditioners. Dofs which are not a row
+             * owned by this processor (constrained or not owned dofs) are marked with -1.
+             *
+             * @param aDofIds dof ids
+             * @param aRowIds global row ids of the matrix
+             */
+            virtual void
+            translate_ids_to_row_ids(
+                    const Matrix< DDSMat >& aDofIds,
+                    Matrix< DDSMat >&       aRowIds )
+            {
+                MORIS_ERROR( false, "translate_ids_to_row_ids does not have an implementation in the base class" );
+            }
         };
     }    // namespace sol
 }    // namespace moris
@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_SOL_Matrix_Graph.hpp
+ *
+ */
+
+#ifndef SRC_DISTLINALG_CL_SOL_MATRIX_GRAPH_HPP_
+#define SRC_DISTLINALG_CL_SOL_MATRIX_GRAPH_HPP_
+
+namespace moris
+{
+    namespace sol
+    {
+        /**
+         * Finalized sparsity graph of a distributed matrix. The graph is created and
+         * consumed by the matrix implementation, other classes only pass it on.
+         */
+        class Matrix_Graph
+        {
+          public:
+            // ---------------------------------------------------------------------------------------------------------
+            Matrix_Graph(){};
+
+            // ---------------------------------------------------------------------------------------------------------
+            virtual ~Matrix_Graph(){};
+        };
+    }    // namespace sol
+}    // namespace moris
+
+#endif /* SRC_DISTLINALG_CL_SOL_MATRIX_GRAPH_HPP_ */
@@ -11,6 +11,7 @@
 #include "cl_SOL_Matrix_Vector_Factory.hpp"
 
 #include "cl_Sparse_Matrix_EpetraFECrs.hpp"
+#include "cl_Matrix_Free_Operator_Epetra.hpp"
 #include "cl_Vector_Epetra.hpp"
 #include "cl_Map_Epetra.hpp"
 #include "cl_SOL_Dist_Map.hpp"
@@ -70,6 +71,32 @@ namespace moris
 
         //-------------------------------------------------------------------------------------------
 
+        Dist_Matrix*
+        sol::Matrix_Vector_Factory::create_matrix_free_operator(
+                Solver_Interface* aInput,
+                Dist_Map*         aMap,
+                bool              aPointMap )
+        {
+            Dist_Matrix* tOperator = nullptr;
+
+            switch ( mMapType )
+            {
+                case MapType::Epetra:
+                {
+                    tOperator = new Matrix_Free_Operator_Epetra( aInput, aMap, aPointMap );
+                    break;
+                }
+                default:
+                {
+                    MORIS_ERROR( false, "Matrix-free operators are only implemented for Epetra." );
+                    break;
+                }
+            }
+            return tOperator;
+        }
+
+        //-------------------------------------------------------------------------------------------
+
         Dist_Matrix*
         sol::Matrix_Vector_Factory::create_matrix(
                 Dist_Map* aRowMap,
@@ -40,6 +40,20 @@ namespace moris
                     bool              aPointMap   = false,
                     bool              aBuildGraph = false );
 
+            /**
+             * Creates a matrix-free operator which applies the element matrices of the solver interface
+             * in every matrix-vector product and only assembles the diagonal
+             *
+             * @param aInput    Solver interface providing the element matrices
+             * @param aMap      Distributed map
+             * @param aPointMap Flag whether matrix is built on the point map
+             * @return Distributed matrix
+             */
+            Dist_Matrix *create_matrix_free_operator(
+                    Solver_Interface *aInput,
+                    Dist_Map         *aMap,
+                    bool              aPointMap = false );
+
             Dist_Matrix *create_matrix(
                     Dist_Map *aRowMap,
                     Dist_Map *aColMap );
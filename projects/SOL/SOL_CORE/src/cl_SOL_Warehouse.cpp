@@ -87,6 +87,7 @@ SOL_Warehouse::initialize()
     mTPLType = static_cast< moris::sol::MapType >( mParameterlist( 6 )( 0 ).get< moris::uint >( "SOL_TPL_Type" ) );
 
     mOperatorToMatlab      = mParameterlist( 6 )( 0 ).get< std::string >( "SOL_save_operator_to_matlab" );
+    mMatrixFree            = mParameterlist( 6 )( 0 ).get< bool >( "SOL_matrix_free" );
     mSaveFinalSolVecToFile = mParameterlist( 6 )( 0 ).get< std::string >( "SOL_save_final_sol_vec_to_file" );
 
     mLoadSolVecFromFile    = mParameterlist( 6 )( 0 ).get< std::string >( "SOL_load_sol_vec_from_file" );
@@ -96,6 +97,24 @@ SOL_Warehouse::initialize()
     mFilenameInitialGuess = mParameterlist( 6 )( 0 ).get< std::string >( "TSA_Initial_Sol_Vec" );
 
     mSaveFinalAdjointVecToFile = mParameterlist( 6 )( 0 ).get< std::string >( "SOL_save_final_adjoint_vec_to_file" );
+    mCheckpointPerOptIteration = mParameterlist( 6 )( 0 ).get< bool >( "SOL_checkpoint_per_opt_iteration" );
+
+    // pass assembly parameters to the solver interface
+    if ( mSolverInterface != nullptr )
+    {
+        sint tNumAssemblyThreads = mParameterlist( 6 )( 0 ).get< sint >( "SOL_assembly_num_threads" );
+
+        MORIS_ERROR( tNumAssemblyThreads > 0,
+                "SOL_Warehouse::initialize - SOL_assembly_num_threads needs to be at least 1." );
+
+        mSolverInterface->set_assembly_parameters(
+                static_cast< uint >( tNumAssemblyThreads ),
+                mParameterlist( 6 )( 0 ).get< bool >( "SOL_deterministic_assembly" ),
+                mParameterlist( 6 )( 0 ).get< bool >( "SOL_assembly_use_cache" ) );
+
+        mSolverInterface->set_reuse_matrix_graph(
+                mParameterlist( 6 )( 0 ).get< bool >( "SOL_reuse_matrix_graph" ) );
+    }
 
 #ifdef MORIS_HAVE_PETSC
     if ( mTPLType == moris::sol::MapType::Petsc )
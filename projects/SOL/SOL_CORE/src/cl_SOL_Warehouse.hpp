@@ -95,6 +95,9 @@ namespace moris
             // save operator to matlab string
             std::string mOperatorToMatlab = std::string( "" );
 
+            // flag whether the Jacobian is applied matrix-free
+            bool mMatrixFree = false;
+
             // save final solution vector to file string
             std::string mSaveFinalSolVecToFile = std::string( "" );
 
@@ -110,6 +113,9 @@ namespace moris
             // save final adjoint vector to file string
             std::string mSaveFinalAdjointVecToFile = std::string( "" );
 
+            // flag whether final solution and adjoint vectors are saved per optimization iteration
+            bool mCheckpointPerOptIteration = false;
+
             // load initial guess solution vector from file
             std::string mFilenameInitialGuess = std::string( "" );
 
@@ -246,6 +252,14 @@ namespace moris
 
             //--------------------------------------------------------------------------------------------------------
 
+            bool
+            get_matrix_free()
+            {
+                return mMatrixFree;
+            }
+
+            //--------------------------------------------------------------------------------------------------------
+
             const std::string&
             get_save_final_sol_vec_to_file()
             {
@@ -262,6 +276,14 @@ namespace moris
 
             //--------------------------------------------------------------------------------------------------------
 
+            bool
+            get_checkpoint_per_opt_iteration()
+            {
+                return mCheckpointPerOptIteration;
+            }
+
+            //--------------------------------------------------------------------------------------------------------
+
             const std::string&
             get_load_sol_vec_from_file()
             {
@@ -10,6 +10,8 @@
 
 #include "cl_Sparse_Matrix_EpetraFECrs.hpp"
 
+#include <algorithm>
+
 extern moris::Comm_Manager gMorisComm;
 
 using namespace moris;
@@ -131,6 +133,229 @@ void Sparse_Matrix_EpetraFECrs::fill_matrix(
 
 // ----------------------------------------------------------------------------------------------------------------------
 
+void Sparse_Matrix_EpetraFECrs::fill_matrix_cached(
+        const moris::uint               aAssemblySlot,
+        const moris::uint             & aNumMyDofs,
+        const moris::Matrix< DDRMat > & aA_val,
+        const moris::Matrix< DDSMat > & aEleDofConnectivity )
+{
+    // local structure is only fixed once the graph is finalized
+    if( !mIsCsrAccessible )
+    {
+        this->initialize_csr_access();
+
+        if( !mIsCsrAccessible )
+        {
+            this->fill_matrix( aNumMyDofs, aA_val, aEleDofConnectivity );
+            return;
+        }
+    }
+
+    // grow list of assembly maps geometrically if needed
+    if( aAssemblySlot >= mElementAssemblyMaps.size() )
+    {
+        mElementAssemblyMaps.resize( std::max< moris::size_t >( aAssemblySlot + 1, 2 * mElementAssemblyMaps.size() ) );
+    }
+
+    Element_Assembly_Map & tAssemblyMap = mElementAssemblyMaps( aAssemblySlot );
+
+    // compute offsets the first time this slot is assembled or if its element dofs changed
+    if( !tAssemblyMap.mIsBuilt || !this->has_same_dof_ids( tAssemblyMap, aNumMyDofs, aEleDofConnectivity ) )
+    {
+        this->build_element_assembly_map( tAssemblyMap, aNumMyDofs, aEleDofConnectivity );
+    }
+
+    // sum locally owned entries directly into the CSR value array
+    const real * tElementValues = aA_val.data();
+
+    const uint tNumLocalEntries = tAssemblyMap.mValueOffsets.numel();
+
+    for( uint Ik = 0; Ik < tNumLocalEntries; Ik++ )
+    {
+        mCsrValues[ tAssemblyMap.mValueOffsets( Ik ) ] += tElementValues[ tAssemblyMap.mElementEntries( Ik ) ];
+    }
+
+    // sum entries of rows owned by other processors row by row
+    const uint tNumNonlocalRows = tAssemblyMap.mNonlocalRows.numel();
+
+    if( tNumNonlocalRows > 0 )
+    {
+        const uint tNumFreeColumns = tAssemblyMap.mFreeColumns.numel();
+
+        // scratch buffer is only reallocated if it needs to grow
+        if( mNonlocalRowValues.numel() < tNumFreeColumns )
+        {
+            mNonlocalRowValues.set_size( tNumFreeColumns, 1 );
+        }
+
+        for( uint Ir = 0; Ir < tNumNonlocalRows; Ir++ )
+        {
+            const uint tRow = tAssemblyMap.mNonlocalRows( Ir );
+
+            // gather row of column major element matrix
+            for( uint Ic = 0; Ic < tNumFreeColumns; Ic++ )
+            {
+                mNonlocalRowValues( Ic ) = tElementValues[ tAssemblyMap.mFreeColumns( Ic ) * aNumMyDofs + tRow ];
+            }
+
+            mEpetraMat->SumIntoGlobalValues(
+                    tAssemblyMap.mNonlocalRowIds( Ir ),
+                    tNumFreeColumns,
+                    mNonlocalRowValues.data(),
+                    tAssemblyMap.mFreeColumnIds.data() );
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------------------------------------------------
+
+void Sparse_Matrix_EpetraFECrs::initialize_csr_access()
+{
+    // the graph is finalized in initial_matrix_global_assembly()
+    if( mEpetraMat == nullptr || !mEpetraMat->Filled() )
+    {
+        return;
+    }
+
+    // direct access is only possible if the matrix is stored in contiguous arrays
+    int tError = mEpetraMat->ExtractCrsDataPointers( mCsrRowOffsets, mCsrColumns, mCsrValues );
+
+    mIsCsrAccessible = ( tError == 0 );
+}
+
+// ----------------------------------------------------------------------------------------------------------------------
+
+void Sparse_Matrix_EpetraFECrs::build_element_assembly_map(
+        Element_Assembly_Map          & aAssemblyMap,
+        const moris::uint             & aNumMyDofs,
+        const moris::Matrix< DDSMat > & aEleDofConnectivity )
+{
+    // get free ids of element dofs, constrained dofs are marked with negative ids
+    Matrix< IdMat > tFreeIds;
+
+    if( mMatBuildWithPointMap )
+    {
+        mMap->translate_ids_to_free_point_ids( aEleDofConnectivity, tFreeIds, true );
+    }
+    else
+    {
+        tFreeIds = aEleDofConnectivity;
+    }
+
+    // collect free element dofs and their local column indices
+    Matrix< DDUMat > tFreeColumns( aNumMyDofs, 1 );
+    Matrix< DDSMat > tFreeColumnIds( aNumMyDofs, 1 );
+    Matrix< DDSMat > tLocalColumns( aNumMyDofs, 1 );
+
+    uint tNumFreeDofs = 0;
+
+    for( uint Ic = 0; Ic < aNumMyDofs; Ic++ )
+    {
+        if( tFreeIds( Ic ) < 0 )
+        {
+            continue;
+        }
+
+        tFreeColumns( tNumFreeDofs )   = Ic;
+        tFreeColumnIds( tNumFreeDofs ) = tFreeIds( Ic );
+        tLocalColumns( tNumFreeDofs )  = mEpetraMat->LCID( tFreeIds( Ic ) );
+
+        tNumFreeDofs++;
+    }
+
+    // allocate maximal size of maps
+    aAssemblyMap.mValueOffsets.set_size( tNumFreeDofs * tNumFreeDofs, 1 );
+    aAssemblyMap.mElementEntries.set_size( tNumFreeDofs * tNumFreeDofs, 1 );
+    aAssemblyMap.mNonlocalRows.set_size( tNumFreeDofs, 1 );
+    aAssemblyMap.mNonlocalRowIds.set_size( tNumFreeDofs, 1 );
+
+    uint tNumLocalEntries = 0;
+    uint tNumNonlocalRows = 0;
+
+    for( uint Ir = 0; Ir < tNumFreeDofs; Ir++ )
+    {
+        const uint tRow      = tFreeColumns( Ir );
+        const int  tLocalRow = mEpetraMat->LRID( tFreeColumnIds( Ir ) );
+
+        // rows owned by other processors are summed in through the FE interface
+        if( tLocalRow < 0 )
+        {
+            aAssemblyMap.mNonlocalRows( tNumNonlocalRows )   = tRow;
+            aAssemblyMap.mNonlocalRowIds( tNumNonlocalRows ) = tFreeColumnIds( Ir );
+
+            tNumNonlocalRows++;
+            continue;
+        }
+
+        const int* tRowBegin = mCsrColumns + mCsrRowOffsets[ tLocalRow ];
+        const int* tRowEnd   = mCsrColumns + mCsrRowOffsets[ tLocalRow + 1 ];
+
+        for( uint Ic = 0; Ic < tNumFreeDofs; Ic++ )
+        {
+            // find local column in row, column indices are sorted once the graph is finalized
+            const int* tEntry = std::lower_bound( tRowBegin, tRowEnd, tLocalColumns( Ic ) );
+
+            // entries not in the graph are ignored, consistent with SumIntoGlobalValues()
+            if( tLocalColumns( Ic ) < 0 || tEntry == tRowEnd || *tEntry != tLocalColumns( Ic ) )
+            {
+                continue;
+            }
+
+            aAssemblyMap.mValueOffsets( tNumLocalEntries )   = tEntry - mCsrColumns;
+            aAssemblyMap.mElementEntries( tNumLocalEntries ) = tFreeColumns( Ic ) * aNumMyDofs + tRow;
+
+            tNumLocalEntries++;
+        }
+    }
+
+    aAssemblyMap.mValueOffsets.resize( tNumLocalEntries, 1 );
+    aAssemblyMap.mElementEntries.resize( tNumLocalEntries, 1 );
+    aAssemblyMap.mNonlocalRows.resize( tNumNonlocalRows, 1 );
+    aAssemblyMap.mNonlocalRowIds.resize( tNumNonlocalRows, 1 );
+
+    // free columns are only needed to sum in rows owned by other processors
+    if( tNumNonlocalRows > 0 )
+    {
+        tFreeColumns.resize( tNumFreeDofs, 1 );
+        tFreeColumnIds.resize( tNumFreeDofs, 1 );
+
+        aAssemblyMap.mFreeColumns   = tFreeColumns;
+        aAssemblyMap.mFreeColumnIds = tFreeColumnIds;
+    }
+
+    aAssemblyMap.mDofIds  = aEleDofConnectivity;
+    aAssemblyMap.mIsBuilt = true;
+}
+
+// ----------------------------------------------------------------------------------------------------------------------
+
+bool Sparse_Matrix_EpetraFECrs::has_same_dof_ids(
+        const Element_Assembly_Map    & aAssemblyMap,
+        const moris::uint             & aNumMyDofs,
+        const moris::Matrix< DDSMat > & aEleDofConnectivity ) const
+{
+    if( aAssemblyMap.mDofIds.numel() != aNumMyDofs )
+    {
+        return false;
+    }
+
+    return std::equal( aEleDofConnectivity.data(), aEleDofConnectivity.data() + aNumMyDofs, aAssemblyMap.mDofIds.data() );
+}
+
+// ----------------------------------------------------------------------------------------------------------------------
+
+void Sparse_Matrix_EpetraFECrs::reset_assembly_cache()
+{
+    mElementAssemblyMaps.clear();
+
+    mCsrRowOffsets   = nullptr;
+    mCsrColumns      = nullptr;
+    mCsrValues       = nullptr;
+    mIsCsrAccessible = false;
+}
+
+// ----------------------------------------------------------------------------------------------------------------------
+
 void Sparse_Matrix_EpetraFECrs::insert_values(
         const Matrix<DDSMat>& aRowIDs,
         const Matrix<DDSMat>& aColumnIDs,
@@ -181,6 +406,9 @@ void Sparse_Matrix_EpetraFECrs::initial_matrix_global_assembly()
         mEpetraMat = new Epetra_FECrsMatrix( Copy, *mEpetraGraph );
         delete( mEpetraGraph);
         mEpetraGraph = nullptr;
+
+        // local structure changed, cached element offsets are invalid
+        this->reset_assembly_cache();
     }
     else
     {
@@ -270,6 +498,50 @@ void Sparse_Matrix_EpetraFECrs::build_graph(
 
 // ----------------------------------------------------------------------------------------------------------------------
 
+std::shared_ptr< sol::Matrix_Graph > Sparse_Matrix_EpetraFECrs::get_graph()
+{
+    // graph is only fixed once the matrix is filled
+    if( mEpetraMat == nullptr || !mEpetraMat->Filled() )
+    {
+        return nullptr;
+    }
+
+    return std::make_shared< Matrix_Graph_Epetra >( mEpetraMat->Graph() );
+}
+
+// ----------------------------------------------------------------------------------------------------------------------
+
+bool Sparse_Matrix_EpetraFECrs::set_graph( const std::shared_ptr< sol::Matrix_Graph > & aGraph )
+{
+    // only matrices built from a graph can be created from a cached Epetra graph
+    const Matrix_Graph_Epetra * tGraph = dynamic_cast< const Matrix_Graph_Epetra * >( aGraph.get() );
+
+    if( !mBuildGraph || tGraph == nullptr || mEpetraGraph == nullptr )
+    {
+        return false;
+    }
+
+    // check that the graph was built for the same row distribution (collective)
+    const Epetra_Map* tRowMap = mMatBuildWithPointMap ? mMap->get_epetra_point_map() : mMap->get_epetra_map();
+
+    if( !tGraph->mGraph.RowMap().SameAs( *tRowMap ) )
+    {
+        return false;
+    }
+
+    mEpetraMat = new Epetra_FECrsMatrix( Copy, tGraph->mGraph );
+
+    // empty graph created in the constructor is not needed anymore
+    delete( mEpetraGraph );
+    mEpetraGraph = nullptr;
+
+    this->reset_assembly_cache();
+
+    return true;
+}
+
+// ----------------------------------------------------------------------------------------------------------------------
+
 void Sparse_Matrix_EpetraFECrs::mat_put_scalar( const moris::real & aValue )
 {
     mEpetraMat->PutScalar( aValue );
@@ -380,3 +652,34 @@ void Sparse_Matrix_EpetraFECrs::save_matrix_map_to_matrix_market_file( const cha
     EpetraExt::BlockMapToMatrixMarketFile( aFilename, *mMap->get_epetra_map() );
 }
 
+
+// ----------------------------------------------------------------------------------------------------------------------
+
+void Sparse_Matrix_EpetraFECrs::translate_ids_to_row_ids(
+        const moris::Matrix< DDSMat > & aDofIds,
+              moris::Matrix< DDSMat > & aRowIds )
+{
+    // get free ids of dofs, constrained dofs are marked with negative ids
+    if( mMatBuildWithPointMap )
+    {
+        Matrix< IdMat > tFreeIds;
+        mMap->translate_ids_to_free_point_ids( aDofIds, tFreeIds, true );
+
+        aRowIds = tFreeIds;
+    }
+    else
+    {
+        aRowIds = aDofIds;
+    }
+
+    // mark dofs which are not a row owned by this processor
+    const Epetra_Map & tRowMap = mEpetraMat->RowMap();
+
+    for( uint Ik = 0; Ik < aRowIds.numel(); Ik++ )
+    {
+        if( aRowIds( Ik ) < 0 || !tRowMap.MyGID( aRowIds( Ik ) ) )
+        {
+            aRowIds( Ik ) = -1;
+        }
+    }
+}
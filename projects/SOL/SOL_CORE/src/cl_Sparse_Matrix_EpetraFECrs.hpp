@@ -24,6 +24,18 @@
 
 namespace moris
 {
+// finalized Epetra graph shared between matrices with the same structure
+class Matrix_Graph_Epetra : public sol::Matrix_Graph
+{
+public:
+    // copy shares the graph data with the matrix it was taken from
+    Epetra_CrsGraph mGraph;
+
+    Matrix_Graph_Epetra( const Epetra_CrsGraph & aGraph )
+            : mGraph( aGraph )
+    {};
+};
+
 // Project header files
 class Sparse_Matrix_EpetraFECrs : public sol::Dist_Matrix
 {
@@ -35,9 +47,76 @@ private:
     const bool mMatBuildWithPointMap =  false;
     const bool mBuildGraph =  false;
 
+    // location of the entries of one element matrix in the matrix storage
+    struct Element_Assembly_Map
+    {
+        // element dof ids the map was built for, used to detect changed connectivities
+        Matrix< DDSMat > mDofIds;
+
+        // offsets into the local CSR value array and corresponding column major element matrix entries
+        Matrix< DDSMat > mValueOffsets;
+        Matrix< DDUMat > mElementEntries;
+
+        // rows owned by other processors, summed in through the Epetra_FECrsMatrix interface
+        Matrix< DDUMat > mNonlocalRows;
+        Matrix< DDSMat > mNonlocalRowIds;
+        Matrix< DDUMat > mFreeColumns;
+        Matrix< DDSMat > mFreeColumnIds;
+
+        bool mIsBuilt = false;
+    };
+
+    // cached element assembly maps, one per assembly slot
+    moris::Cell< Element_Assembly_Map > mElementAssemblyMaps;
+
+    // local CSR structure of the matrix, valid once the graph is finalized
+    int*    mCsrRowOffsets = nullptr;
+    int*    mCsrColumns    = nullptr;
+    double* mCsrValues     = nullptr;
+
+    // flag whether local CSR structure can be accessed directly
+    bool mIsCsrAccessible = false;
+
+    // scratch buffer for off-processor rows
+    Matrix< DDRMat > mNonlocalRowValues;
+
     void dirichlet_BC_vector(       moris::Matrix< DDUMat > & aDirichletBCVec,
                               const moris::Matrix< DDUMat > & aMyConstraintDofs );
 
+    /**
+     * extracts pointers to the local CSR structure of the finalized matrix
+     */
+    void initialize_csr_access();
+
+    /**
+     * computes the location of the entries of an element matrix in the matrix storage
+     *
+     * @param aAssemblyMap Element assembly map to be filled
+     * @param aNumMyDofs Number of element dofs
+     * @param aEleDofConnectivity Element dof ids
+     */
+    void build_element_assembly_map(
+            Element_Assembly_Map          & aAssemblyMap,
+            const moris::uint             & aNumMyDofs,
+            const moris::Matrix< DDSMat > & aEleDofConnectivity );
+
+    /**
+     * checks if an element assembly map was built for the given element dof ids
+     *
+     * @param aAssemblyMap Element assembly map
+     * @param aNumMyDofs Number of element dofs
+     * @param aEleDofConnectivity Element dof ids
+     */
+    bool has_same_dof_ids(
+            const Element_Assembly_Map    & aAssemblyMap,
+            const moris::uint             & aNumMyDofs,
+            const moris::Matrix< DDSMat > & aEleDofConnectivity ) const;
+
+    /**
+     * deletes all cached element assembly maps
+     */
+    void reset_assembly_cache();
+
 protected:
 
 public:
@@ -62,6 +141,21 @@ public:
                       const moris::Matrix< DDRMat > & aA_val,
                       const moris::Matrix< DDSMat > & aEleDofConnectivity );
 
+    /**
+     * Sums an element matrix directly into the local CSR value array using cached offsets.
+     * Falls back to fill_matrix() if the matrix graph is not finalized yet.
+     *
+     * @param aAssemblySlot Running index of the equation object over all sets
+     * @param aNumMyDofs Number of element dofs
+     * @param aA_val Element matrix
+     * @param aEleDofConnectivity Element dof ids
+     */
+    void fill_matrix_cached(
+            const moris::uint               aAssemblySlot,
+            const moris::uint             & aNumMyDofs,
+            const moris::Matrix< DDRMat > & aA_val,
+            const moris::Matrix< DDSMat > & aEleDofConnectivity );
+
     /**
      * Inserts values into the matrix at locations corresponding to the given row and column IDs.
      *
@@ -97,6 +191,10 @@ public:
     void build_graph( const moris::uint             & aNumMyDof,
                       const moris::Matrix< DDSMat > & aElementTopology );
 
+    std::shared_ptr< sol::Matrix_Graph > get_graph();
+
+    bool set_graph( const std::shared_ptr< sol::Matrix_Graph > & aGraph );
+
     void get_diagonal( moris::sol::Dist_Vector & aDiagVec ) const;
 
     void mat_put_scalar( const moris::real & aValue );
@@ -119,6 +217,10 @@ public:
 
     void save_matrix_map_to_matrix_market_file( const char* aFilename );
 
+    void translate_ids_to_row_ids(
+            const moris::Matrix< DDSMat > & aDofIds,
+                  moris::Matrix< DDSMat > & aRowIds );
+
 };
 }
 
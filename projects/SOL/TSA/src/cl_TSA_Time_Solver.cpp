@@ -439,7 +439,7 @@ Time_Solver::solve()
         if ( not mSolverWarehouse->get_save_final_sol_vec_to_file().empty() )
         {
             // get path to solution file
-            std::string tSolVecPath = mSolverWarehouse->get_save_final_sol_vec_to_file();
+            std::string tSolVecPath = this->get_checkpoint_file_name( mSolverWarehouse->get_save_final_sol_vec_to_file() );
 
             // detect file type
             std::string tType = tSolVecPath.substr( tSolVecPath.find_last_of( "." ) + 1, tSolVecPath.length() );
@@ -493,7 +493,7 @@ Time_Solver::solve_sensitivity()
     // output solution vector to file
     if ( not mSolverWarehouse->get_save_final_adjoint_vec_to_file().empty() )
     {
-        std::string tSolVecPath = mSolverWarehouse->get_save_final_adjoint_vec_to_file();
+        std::string tSolVecPath = this->get_checkpoint_file_name( mSolverWarehouse->get_save_final_adjoint_vec_to_file() );
 
         // detect file type
         std::string tType = tSolVecPath.substr( tSolVecPath.find_last_of( "." ) + 1, tSolVecPath.length() );
@@ -537,13 +537,40 @@ Time_Solver::initialize_sol_vec()
         if ( tType == "hdf5" || tType == "h5" )
         {
             // log/print that the initial guess is read from file
-            MORIS_LOG_INFO( "Reading initial guess for solution vector from file: ", tStrInitialGuess.c_str() );
+            MORIS_LOG_INFO( "Reading initial guess for solution vector from file: %s", tStrInitialGuess.c_str() );
+
+            // check whether the file is a distributed vector written by save_vector_to_HDF5()
+            hid_t tFileID = H5Fopen( tStrInitialGuess.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT );
+
+            MORIS_ERROR( tFileID >= 0,
+                    "Time_Solver::initialize_sol_vec() - Could not open HDF5 file %s.",
+                    tStrInitialGuess.c_str() );
+
+            bool tIsDistributedVector = dataset_exists( tFileID, "LHS" );
+            bool tHasMapForNumProcs   = dataset_exists( tFileID, "map-" + std::to_string( par_size() ) );
+
+            close_hdf5_file( tFileID );
+
+            if ( tIsDistributedVector )
+            {
+                // the map of the current vector is used, thus the dof ids need to be the same as when the file was written,
+                // i.e. same mesh, same discretization and same number of processors
+                MORIS_ERROR( tHasMapForNumProcs,
+                        "Time_Solver::initialize_sol_vec() - %s has not been written with %d processors.",
+                        tStrInitialGuess.c_str(),
+                        par_size() );
+
+                // every processor reads its part of the vector
+                mFullVector( 1 )->read_vector_from_HDF5( tStrInitialGuess.c_str(), "LHS", 0 );
+
+                return;
+            }
 
             // FIXME: this option doesn't work in parallel, only for serial debugging purposes
             MORIS_ERROR( par_size() == 1, "Time_Solver::initialize_sol_vec() - Restarting from hdf5 file only possible in serial." );
 
             // read HDF5 file to moris matrix
-            hid_t            tFileID = open_hdf5_file( tStrInitialGuess );
+            tFileID = open_hdf5_file( tStrInitialGuess );
             herr_t           tStatus = 0;
             Matrix< DDRMat > tInitialGuess;
             load_matrix_from_hdf5_file( tFileID, "SolVec", tInitialGuess, tStatus );
@@ -687,6 +714,34 @@ Time_Solver::initialize_prev_sol_vec()
 
 //--------------------------------------------------------------------------------------------------------------------------
 
+std::string
+Time_Solver::get_checkpoint_file_name( const std::string& aPath )
+{
+    if ( not mSolverWarehouse->get_checkpoint_per_opt_iteration() )
+    {
+        return aPath;
+    }
+
+    // get iteration from global clock
+    uint tOptIter = gLogger.get_iteration( "OPT", "Manager", "Perform" );
+
+    // find the extension in the file name only, dots in directory names and leading dots are ignored
+    std::size_t tNamePos = aPath.find_last_of( "/" );
+    tNamePos             = ( tNamePos == std::string::npos ) ? 0 : tNamePos + 1;
+
+    std::size_t tExtPos = aPath.find_last_of( "." );
+
+    if ( tExtPos == std::string::npos || tExtPos <= tNamePos )
+    {
+        tExtPos = aPath.length();
+    }
+
+    // insert iteration before file extension, e.g. SolVec.hdf5 -> SolVec_Iter_3.hdf5
+    return aPath.substr( 0, tExtPos ) + "_Iter_" + std::to_string( tOptIter ) + aPath.substr( tExtPos );
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
 void
 Time_Solver::prepare_sol_vec_for_next_time_step()
 {
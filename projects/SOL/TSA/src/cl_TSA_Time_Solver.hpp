@@ -353,6 +353,15 @@ namespace moris
              */
             void initialize_prev_sol_vec();
 
+            //--------------------------------------------------------------------------------------------------
+            /**
+             * @brief returns the path of a final solution or adjoint vector file. If checkpointing per
+             * optimization iteration is requested, the iteration is appended to the file name
+             *
+             * @param[in] aPath path given in the solver warehouse parameter list
+             */
+            std::string get_checkpoint_file_name( const std::string& aPath );
+
             //--------------------------------------------------------------------------------------------------
             /**
              * @brief create new sol vec for next time step
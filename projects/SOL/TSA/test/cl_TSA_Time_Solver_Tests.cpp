@@ -23,10 +23,11 @@
 #include "cl_TSA_Monolithic_Time_Solver.hpp"
 #include "cl_TSA_Solver_Interface_Proxy.hpp"
 #include "cl_TSA_Time_Solver.hpp"
+#include "cl_SOL_Warehouse.hpp"
 #undef protected
 #undef private
 
-#include "cl_SOL_Warehouse.hpp"
+#include "cl_Logger.hpp"
 #include "cl_NLA_Nonlinear_Solver.hpp"
 #include "cl_NLA_Nonlinear_Algorithm.hpp"
 #include "cl_NLA_Nonlinear_Solver_Factory.hpp"
@@ -96,6 +97,28 @@ namespace moris
                 delete( tSolverInput );
             }
             }
+
+        TEST_CASE("TimeSolverCheckpointFileName","[TSA],[TimeSolverCheckpointFileName]")
+        {
+            sol::SOL_Warehouse tSolverWarehouse;
+
+            Time_Solver tTimeSolver;
+            tTimeSolver.set_solver_warehouse( &tSolverWarehouse );
+
+            // without checkpointing the path is not changed
+            CHECK( tTimeSolver.get_checkpoint_file_name( "SolVec.hdf5" ) == "SolVec.hdf5" );
+
+            // with checkpointing the optimization iteration is inserted before the extension of the file name
+            tSolverWarehouse.mCheckpointPerOptIteration = true;
+
+            std::string tIter = "_Iter_" + std::to_string( gLogger.get_iteration( "OPT", "Manager", "Perform" ) );
+
+            CHECK( tTimeSolver.get_checkpoint_file_name( "SolVec.hdf5" ) == "SolVec" + tIter + ".hdf5" );
+            CHECK( tTimeSolver.get_checkpoint_file_name( "./run.1/SolVec.h5" ) == "./run.1/SolVec" + tIter + ".h5" );
+            CHECK( tTimeSolver.get_checkpoint_file_name( "SolVec" ) == "SolVec" + tIter );
+            CHECK( tTimeSolver.get_checkpoint_file_name( "./run.1/SolVec" ) == "./run.1/SolVec" + tIter );
+            CHECK( tTimeSolver.get_checkpoint_file_name( "run/.SolVec" ) == "run/.SolVec" + tIter );
+        }
     }
 }
 
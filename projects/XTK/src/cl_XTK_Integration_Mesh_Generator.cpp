@@ -459,16 +459,10 @@ namespace xtk
 
         aMeshGenerationData.mAllIntersectedBgCellInds.reserve( tNumCells );
 
-        // Initialize geometric query
-        Geometric_Query_XTK tGeometricQuery;
+        // classify all cells against all geometries at once, kept for finding the non-intersected cells later
+        this->classify_background_cells( aCutIntegrationMesh, aBackgroundMesh, aMeshGenerationData.mBackgroundCellIsIntersected );
 
-        // say I am just interested in a yes or no answer
-        tGeometricQuery.set_query_type( moris::ge::Query_Type::INTERSECTION_NO_LOCATION );
-
-        // large coord matrix that I want to keep in scope for a long time avoid copying coordinate all the time.
-        tGeometricQuery.set_coordinates_matrix( &aCutIntegrationMesh->mVertexCoordinates );
-
-        tGeometricQuery.set_query_entity_rank( EntityRank::ELEMENT );
+        Matrix< DDBMat > const & tIsIntersected = aMeshGenerationData.mBackgroundCellIsIntersected;
 
         // reserve memory for list of indices of intersected background cells
         // size estimate: tNumCells / tNumGeometries
@@ -477,23 +471,13 @@ namespace xtk
             aMeshGenerationData.mIntersectedBackgroundCellIndex( iGeom ).reserve( tNumCells / tNumGeometries );
         }
 
-        // iterate through all cells
+        // commit the intersected cells in cell order
         for ( moris::uint iCell = 0; iCell < tNumCells; iCell++ )
         {
-            // setup geometric query with this current cell information
-            tGeometricQuery.set_parent_cell( &aBackgroundMesh->get_mtk_cell( (moris_index)iCell ) );
-            tGeometricQuery.set_query_cell( &aBackgroundMesh->get_mtk_cell( (moris_index)iCell ) );
-
             // iterate through all geometries for current cell
             for ( moris::size_t iGeom = 0; iGeom < tNumGeometries; iGeom++ )
             {
-                // current index for this geometry
-                moris_index tGeometryIndex = mActiveGeometries( iGeom );
-
-                // tell the query which geometric index we are working on
-                tGeometricQuery.set_geometric_index( tGeometryIndex );
-
-                if ( mXTKModel->get_geom_engine()->geometric_query( &tGeometricQuery ) )
+                if ( tIsIntersected( iCell, iGeom ) )
                 {
                     // add background cell to the list for iGEOM
                     aMeshGenerationData.mIntersectedBackgroundCellIndex( iGeom ).push_back( iCell );
@@ -535,16 +519,13 @@ namespace xtk
         // initialize memory for the list of non-intersected cells
         aMeshGenerationData.mAllNonIntersectedBgCellInds.reserve( tNumCells );
 
-        // Initialize geometric query
-        Geometric_Query_XTK tGeometricQuery;
-
-        // say I am just interested in a yes or no answer
-        tGeometricQuery.set_query_type( moris::ge::Query_Type::INTERSECTION_NO_LOCATION );
-
-        // large coord matrix that I want to keep in scope for a long time avoid copying coordinate all the time.
-        tGeometricQuery.set_coordinates_matrix( &aCutIntegrationMesh->mVertexCoordinates );
+        // the background cells were classified when determining the intersected cells
+        if ( aMeshGenerationData.mBackgroundCellIsIntersected.n_rows() != tNumCells )
+        {
+            this->classify_background_cells( aCutIntegrationMesh, aBackgroundMesh, aMeshGenerationData.mBackgroundCellIsIntersected );
+        }
 
-        tGeometricQuery.set_query_entity_rank( EntityRank::ELEMENT );
+        Matrix< DDBMat > const & tIsIntersected = aMeshGenerationData.mBackgroundCellIsIntersected;
 
         // iterate through all cells
         for ( moris::uint iCell = 0; iCell < tNumCells; iCell++ )
@@ -552,21 +533,10 @@ namespace xtk
             // assume the cell is non-cut
             bool tCellIsCut = false;
 
-            // setup geometric query with this current cell information
-            tGeometricQuery.set_parent_cell( &aBackgroundMesh->get_mtk_cell( (moris_index)iCell ) );
-            tGeometricQuery.set_query_cell( &aBackgroundMesh->get_mtk_cell( (moris_index)iCell ) );
-
-            // iterate through all geometries for current cell and check if it gets cut by any of the geometries
+            // check if the cell gets cut by any of the geometries
             for ( moris::size_t iGeom = 0; iGeom < tNumGeometries; iGeom++ )
             {
-                // current index for this geometry
-                moris_index tGeometryIndex = mActiveGeometries( iGeom );
-
-                // tell the query which geometric index we are working on
-                tGeometricQuery.set_geometric_index( tGeometryIndex );
-
-                // set to true if cell is cut by current or any previous geometry
-                tCellIsCut = tCellIsCut || mXTKModel->get_geom_engine()->geometric_query( &tGeometricQuery );
+                tCellIsCut = tCellIsCut || tIsIntersected( iCell, iGeom );
             }
 
             // if the cell is not cut by any geometry, store the cell's index
@@ -585,6 +555,83 @@ namespace xtk
 
     // ----------------------------------------------------------------------------------
 
+    void
+    Integration_Mesh_Generator::classify_background_cells(
+            Cut_Integration_Mesh* aCutIntegrationMesh,
+            moris::mtk::Mesh*     aBackgroundMesh,
+            Matrix< DDBMat >&     aIsIntersected )
+    {
+        Tracer tTracer( "XTK", "Integration_Mesh_Generator", "Classify background cells", mXTKModel->mVerboseLevel, 1 );
+
+        uint tNumGeometries = mActiveGeometries.numel();
+        uint tNumCells      = aBackgroundMesh->get_num_elems();
+
+        aIsIntersected.set_size( tNumCells, tNumGeometries );
+
+        if ( tNumCells == 0 )
+        {
+            return;
+        }
+
+        // cell to vertex connectivity in compressed row format, cells may have different numbers of vertices
+        Matrix< DDUMat > tCellVertexOffsets( tNumCells + 1, 1 );
+        tCellVertexOffsets( 0 ) = 0;
+
+        for ( moris::uint iCell = 0; iCell < tNumCells; iCell++ )
+        {
+            tCellVertexOffsets( iCell + 1 ) = tCellVertexOffsets( iCell )
+                                            + aBackgroundMesh->get_mtk_cell( (moris_index)iCell ).get_number_of_vertices();
+        }
+
+        Matrix< IndexMat > tCellVertexIndices( tCellVertexOffsets( tNumCells ), 1 );
+
+        for ( moris::uint iCell = 0; iCell < tNumCells; iCell++ )
+        {
+            Matrix< IndexMat > tVertexIndices = aBackgroundMesh->get_mtk_cell( (moris_index)iCell ).get_vertex_inds();
+
+            for ( moris::uint iV = 0; iV < tVertexIndices.numel(); iV++ )
+            {
+                tCellVertexIndices( tCellVertexOffsets( iCell ) + iV ) = tVertexIndices( iV );
+            }
+        }
+
+        // flat vertex coordinates, one row per background vertex index
+        uint tNumVertices = aBackgroundMesh->get_num_nodes();
+        uint tSpatialDim  = aBackgroundMesh->get_spatial_dim();
+
+        Matrix< DDRMat > tVertexCoordinates( tNumVertices, tSpatialDim );
+
+        for ( moris::uint iVertex = 0; iVertex < tNumVertices; iVertex++ )
+        {
+            Matrix< DDRMat > const & tCoordinates = *aCutIntegrationMesh->mVertexCoordinates( iVertex );
+
+            for ( moris::uint iDim = 0; iDim < tSpatialDim; iDim++ )
+            {
+                tVertexCoordinates( iVertex, iDim ) = tCoordinates( iDim );
+            }
+        }
+
+        // classify cells against each geometry
+        Matrix< DDBMat > tIsIntersected;
+
+        for ( moris::size_t iGeom = 0; iGeom < tNumGeometries; iGeom++ )
+        {
+            mXTKModel->get_geom_engine()->determine_intersected_cells(
+                    mActiveGeometries( iGeom ),
+                    tCellVertexOffsets,
+                    tCellVertexIndices,
+                    tVertexCoordinates,
+                    tIsIntersected );
+
+            for ( moris::uint iCell = 0; iCell < tNumCells; iCell++ )
+            {
+                aIsIntersected( iCell, iGeom ) = tIsIntersected( iCell );
+            }
+        }
+    }
+
+    // ----------------------------------------------------------------------------------
+
     void
     Integration_Mesh_Generator::commit_new_ig_cells_to_cut_mesh(
             Integration_Mesh_Generation_Data* aMeshGenerationData,
@@ -52,6 +52,9 @@ namespace xtk
         // all non-intersected background cells needed to triangulate all BG-cells in post
         moris::Cell< moris_index > mAllNonIntersectedBgCellInds;
 
+        // intersection flags of the background cells, one row per cell and one column per active geometry
+        Matrix< DDBMat > mBackgroundCellIsIntersected;
+
         // // this maps from the background cell index to the child mesh index
         // std::unordered_map< moris_index, moris_index > mIntersectedBackgroundCellIndexToChildMeshIndex;
 
@@ -368,6 +371,22 @@ namespace xtk
 
         // ----------------------------------------------------------------------------------
 
+        /**
+         * @brief classifies all background cells against all active geometries in one pass. Each geometry is
+         * evaluated once per background vertex and the cells are classified in parallel by the geometry engine.
+         *
+         * @param aCutIntegrationMesh cut integration mesh holding the background vertex coordinates
+         * @param aBackgroundMesh background mesh
+         * @param aIsIntersected intersection flags, one row per background cell and one column per active geometry
+         */
+        void
+        classify_background_cells(
+                Cut_Integration_Mesh* aCutIntegrationMesh,
+                moris::mtk::Mesh*     aBackgroundMesh,
+                Matrix< DDBMat >&     aIsIntersected );
+
+        // ----------------------------------------------------------------------------------
+
         void
         deduce_interfaces(
                 Cut_Integration_Mesh*                       aCutIntegrationMesh,